@@ -1103,106 +1103,6 @@ int ExittoLinux(CONFIGENTRY *config) {
 }
 	
 
-void startLinux(void* initrdStart, unsigned long initrdSize, const char* appendLine)
-{
-	int nAta=0;
-	// turn off USB
-	BootStopUSB();
-	setup( (void *)KERNEL_SETUP, initrdStart, initrdSize, appendLine);
-        
-	if(tsaHarddiskInfo[0].m_bCableConductors == 80) {
-		if(tsaHarddiskInfo[0].m_wAtaRevisionSupported&2) nAta=1;
-		if(tsaHarddiskInfo[0].m_wAtaRevisionSupported&4) nAta=2;
-		if(tsaHarddiskInfo[0].m_wAtaRevisionSupported&8) nAta=3;
-		if(tsaHarddiskInfo[0].m_wAtaRevisionSupported&16) nAta=4;
-		if(tsaHarddiskInfo[0].m_wAtaRevisionSupported&32) nAta=5;
-	} else {
-		// force the HDD into a good mode 0x40 ==UDMA | 2 == UDMA2
-		nAta=2; // best transfer mode without 80-pin cable
-	}
-	// nAta=1;
-	BootIdeSetTransferMode(0, 0x40 | nAta);
-	BootIdeSetTransferMode(1, 0x40 | nAta);
-	// BootIdeSetTransferMode(0, 0x04);
-
-	// orangeness, people seem to like that colour
-       
-	I2cSetFrontpanelLed(
-		I2C_LED_GREEN0 | I2C_LED_GREEN1 | I2C_LED_GREEN2 | I2C_LED_GREEN3 |
-		I2C_LED_RED0 | I2C_LED_RED1 | I2C_LED_RED2 | I2C_LED_RED3
-	);
-	         
-	// Set framebuffer address to final location (for vesafb driver)
-	(*(unsigned int*)0xFD600800) = (0xf0000000 | ((xbox_ram*0x100000) - FRAMEBUFFER_SIZE));
-	
-	// disable interrupts
-	asm volatile ("cli\n");
-	
-	// clear idt area
-	memset((void*)IDT_LOC,0x0,1024*8);
-	
-	__asm __volatile__ (
-	"wbinvd\n"
-	
-	// Flush the TLB
-	"xor %eax, %eax \n"
-	"mov %eax, %cr3 \n"
-	
-	// Load IDT table (0xB0000 = IDT_LOC)
-	"lidt 	0xB0000\n"
-	
-	// DR6/DR7: Clear the debug registers
-	"xor %eax, %eax \n"
-	"mov %eax, %dr6 \n"
-	"mov %eax, %dr7 \n"
-	"mov %eax, %dr0 \n"
-	"mov %eax, %dr1 \n"
-	"mov %eax, %dr2 \n"
-	"mov %eax, %dr3 \n"
-	
-	// Kill the LDT, if any
-	"xor	%eax, %eax \n"
-	"lldt %ax \n"
-        
-	// Reload CS as 0010 from the new GDT using a far jump
-	".byte 0xEA       \n"   // jmp far 0010:reload_cs
-	".long reload_cs_exit  \n"
-	".word 0x0010  \n"
-	
-	".align 16  \n"
-	"reload_cs_exit: \n"
-
-	// CS is now a valid entry in the GDT.  Set SS, DS, and ES to valid
-	// descriptors, but clear FS and GS as they are not necessary.
-
-	// Set SS, DS, and ES to a data32 segment with maximum limit.
-	"movw $0x0018, %ax \n"
-	"mov %eax, %ss \n"
-	"mov %eax, %ds \n"
-	"mov %eax, %es \n"
-
-	// Clear FS and GS
-	"xor %eax, %eax \n"
-	"mov %eax, %fs \n"
-	"mov %eax, %gs \n"
-
-	// Set the stack pointer to give us a valid stack
-	"movl $0x03BFFFFC, %esp \n"
-	
-	"xor 	%ebx, %ebx \n"
-	"xor 	%eax, %eax \n"
-	"xor 	%ecx, %ecx \n"
-	"xor 	%edx, %edx \n"
-	"xor 	%edi, %edi \n"
-	"movl 	$0x90000, %esi\n"       // kernel setup area
-	"ljmp 	$0x10, $0x100000\n"     // Jump to Kernel protected mode entry
-	);
-	
-	// We are not longer here, we are already in the Linux loader, we never come back here
-	
-	// See you again in Linux then	
-	while(1);
-}
 
 
 
@@ -56,8 +56,14 @@ void FlashEEPROM16(void);
 
 int FATXListDir(FATXPartition *partition, int clusterId, char **res, int reslen, char *prefix);
 int FATXFindDir(FATXPartition *partition, int clusterId, char *dir);
+int _FATXFindFile(FATXPartition* partition,char* filename,int clusterId, FATXFILEINFO *fileinfo);
+int sprintf(char * buf, const char *fmt, ...);
 extern void etherboot(void);
 
+// how much of the flash gets saved by BackupFlashAndEEPROM
+#define BACKUP_FLASH_SIZE	(1024*1024)
+#define BACKUP_MAX_FILES	1000
+
 void FlashBIOS(void){
 	int n;
 
@@ -223,7 +229,7 @@ void HddFlash(){
 	if (n > 0) {
 		int res;
 		FATXFILEINFO fileinfo;
-		res = LoadFATXFilefixed(partition, alts[n]+2, &fileinfo, (BYTE*)0x100000);
+		res = LoadFATXFilefixed(partition, alts[n]+2, &fileinfo, (BYTE*)FLASH_STAGING_START);
 		if (!res) {
 			printk("Loading failed :(   Halting\n");
 			while(1)
@@ -259,7 +265,7 @@ void HddFlash(){
 			return false;
 		}
 		
-		res = BootReflashAndReset((BYTE*)0x100000,offset,fileinfo.fileSize);
+		res = BootReflashAndReset((BYTE*)FLASH_STAGING_START,offset,fileinfo.fileSize);
 		printk("flash failed: %d\n",res);
 	}
 
@@ -267,6 +273,86 @@ void HddFlash(){
 
 }
 
+// Save the current flash contents and EEPROM to C:\BIOS\backup
+// as flashNNN.bin / eepromNNN.bin, using the first free NNN
+
+int BackupFlashAndEEPROM(void){
+	FATXPartition *partition;
+	FATXFILEINFO fileinfo;
+	int bioscluster;
+	int backupcluster;
+	char szFlash[FATX_FILENAME_MAX+1];
+	char szEeprom[FATX_FILENAME_MAX+1];
+	BYTE *pbFlash;
+	int n;
+	int res = false;
+
+	partition = OpenFATXPartition(0,SECTOR_SYSTEM,SYSTEM_SIZE);
+	if (partition == NULL) {
+		printk("No FATX partition, skipping backup\n");
+		return false;
+	}
+
+	bioscluster = FATXFindDir(partition, FATX_ROOT_FAT_CLUSTER, "bios");
+	if (bioscluster == -1 || bioscluster == 1) {
+		bioscluster = FATXFindDir(partition, FATX_ROOT_FAT_CLUSTER, "Bios");
+	}
+	if (bioscluster == -1 || bioscluster == 1) {
+		bioscluster = FATXFindDir(partition, FATX_ROOT_FAT_CLUSTER, "BIOS");
+	}
+	if (bioscluster == -1 || bioscluster == 1) {
+		bioscluster = FATXCreateDirectory(partition, FATX_ROOT_FAT_CLUSTER, "BIOS");
+	}
+	if (bioscluster == -1) {
+		printk("Unable to create C:\\BIOS, skipping backup\n");
+		CloseFATXPartition(partition);
+		return false;
+	}
+
+	backupcluster = FATXFindDir(partition, bioscluster, "backup");
+	if (backupcluster == -1 || backupcluster == 1) {
+		backupcluster = FATXCreateDirectory(partition, bioscluster, "backup");
+	}
+	if (backupcluster == -1) {
+		printk("Unable to create C:\\BIOS\\backup, skipping backup\n");
+		CloseFATXPartition(partition);
+		return false;
+	}
+
+	for (n = 0; n < BACKUP_MAX_FILES; n++) {
+		sprintf(szFlash, "flash%03d.bin", n);
+		sprintf(szEeprom, "eeprom%03d.bin", n);
+		if (!_FATXFindFile(partition, szFlash, backupcluster, &fileinfo) &&
+		    !_FATXFindFile(partition, szEeprom, backupcluster, &fileinfo)) {
+			break;
+		}
+	}
+	if (n == BACKUP_MAX_FILES) {
+		printk("C:\\BIOS\\backup is full, skipping backup\n");
+		CloseFATXPartition(partition);
+		return false;
+	}
+
+	// take a snapshot, the flash is about to be erased
+	pbFlash = malloc(BACKUP_FLASH_SIZE);
+	if (pbFlash != NULL) {
+		memcpy(pbFlash, (void *)LPCFlashadress, BACKUP_FLASH_SIZE);
+		BootEepromReadEntireEEPROM();
+
+		VIDEO_ATTR=0xffc8c8c8;
+		printk("Backing up to C:\\BIOS\\backup\\%s, %s\n", szFlash, szEeprom);
+		res = FATXWriteFile(partition, backupcluster, szFlash, pbFlash, BACKUP_FLASH_SIZE) &&
+		      FATXWriteFile(partition, backupcluster, szEeprom, (BYTE *)&eeprom, EEPROM_SIZE);
+		if (!res) {
+			printk("Backup failed\n");
+		}
+		free(pbFlash);
+	}
+
+	CloseFATXPartition(partition);
+	return res;
+}
+
 extern void ClearScreen (void);
 
 int CDFlash(void){
@@ -365,17 +451,25 @@ selectinsert:
     
 	{
 		static const char * const filenames[]={"/BIOS.BIN","/LINUXBIO.BIN","/XECUTER.BIN","/LINUX.BIN","/CROMWELL.BIN","/BIOSUPD1.BIN",NULL};
+		ISO_FILE isf;
+		DWORD dwTicks;
 		int len;
 		int i=-1;
 		do {
+			int nFound;
 			i++;
-			if(filenames[i]==NULL){
+			// one scan of the root directory finds the first candidate present
+			if(BootIso9660GetFileDetailsFirstOf(1, &filenames[i], &nFound, &isf)){
 				printk("No Bios Update found... Halting!");
 				while(1);
 			}
-			len=BootIso9660GetFile(1, filenames[i],
-					       (BYTE *)0x100000,
-					       0x100000, 0x0);
+			i+=nFound;
+			dwTicks=IoInputDword(0x8008); // ACPI timer, 3579545Hz
+			len=BootIso9660ReadFile(1, &isf,
+					       (BYTE *)FLASH_STAGING_START,
+					       FLASH_STAGING_SIZE, 0x0);
+			// the timer counts in 24 bits, wrapping every 4.69s
+			dwTicks=(IoInputDword(0x8008)-dwTicks)&0xffffff;
 			
 		} while (len<1024);
 		
@@ -384,9 +478,15 @@ selectinsert:
 		printk("Found BiosUpdate: ");
 		VIDEO_ATTR=0xffc8c800;
 		printk("%s (%dk)\n",filenames[i],len>>10);
+		{
+			DWORD dwMs=dwTicks/3580;
+			if(dwMs==0) dwMs=1;
+			VIDEO_ATTR=0xffc8c8c8;
+			printk("Loaded in %dms (%dkB/s)\n", dwMs, ((len>>10)*1000)/dwMs);
+		}
 		
 		{
-			int res = BootReflashAndReset((BYTE*)0x100000,0,len);
+			int res = BootReflashAndReset((BYTE*)FLASH_STAGING_START,0,len);
 			printk("flash failed: %d\n",res);
 		}
 		
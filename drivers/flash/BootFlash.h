@@ -62,6 +62,7 @@ typedef struct {
  	// requires pof->m_pbMemoryMappedStartAddress set to start address of flash in memory on entry
 
 int BootReflashAndReset(BYTE *pbNewData, DWORD dwStartOffset, DWORD dwLength);
+int BackupFlashAndEEPROM(void);
 void BootReflashAndReset_RAM(BYTE *pbNewData, DWORD dwStartOffset, DWORD dwLength);
 
 bool BootFlashGetDescriptor( OBJECT_FLASH *pof, KNOWN_FLASH_TYPE * pkft );
@@ -231,6 +231,8 @@ int BootReflashAndReset(BYTE *pbNewData, DWORD dwStartOffset, DWORD dwLength)
 	OBJECT_FLASH of;
 	bool fMore=true;
 
+	// keep a copy of what we are about to overwrite
+	BackupFlashAndEEPROM();
 	
 	// prep our flash object with start address and params
 	of.m_pbMemoryMappedStartAddress=(BYTE *)LPCFlashadress;
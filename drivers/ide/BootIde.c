@@ -16,6 +16,9 @@
 
 
 #define IDE_SECTOR_SIZE 		0x200
+#define IDE_MAX_SECTORS_PER_COMMAND	256
+#define ATAPI_BLOCK_SIZE		2048
+#define ATAPI_MAX_BLOCKS_PER_COMMAND	256
 #define IDE_BASE1             		(0x1F0u) /* primary controller */
 
 #define IDE_REG_EXTENDED_OFFSET   	(0x200u)
@@ -595,6 +598,9 @@ int DriveSecurityChange(unsigned uIoBase, int driveId, ide_command_t ide_cmd, ch
 	tsIdeCommandParams tsicp1 = IDE_DEFAULT_COMMAND;
 
 	memset(ide_cmd_data,0x00,512);
+
+	// the lock state decides what can be read, drop any mounted partitions
+	FATXInvalidatePartitions(driveId);
 	
 	//Password is only 20 bytes long - the rest is 0-padded.
 	memcpy(&ide_cmd_data[2],password,20);
@@ -656,6 +662,10 @@ int DriveSecurityChange(unsigned uIoBase, int driveId, ide_command_t ide_cmd, ch
 
 int BootIdeInit(void)
 {
+	// anything mounted before the reset is stale now
+	FATXInvalidatePartitions(0);
+	FATXInvalidatePartitions(1);
+
 	memset(&tsaHarddiskInfo[0],0x00,sizeof(struct tsHarddiskInfo));
 	memset(&tsaHarddiskInfo[1],0x00,sizeof(struct tsHarddiskInfo));
 	
@@ -819,6 +829,69 @@ void BootIdeAtapiPrintkFriendlyError(int nDriveIndex)
 }
 
 
+/* -------------------------------------------------------------------------------- */
+
+/////////////////////////////////////////////////
+//  BootIdeSetupAtaTransfer
+//
+//  Fill in the sector count and address of an ATA read or write of nSectors sectors
+//  starting at block, as CHS, 28-bit LBA or 48-bit LBA, and set up the control register
+//  Returns nonzero if the transfer needs 48-bit LBA, that is the EXT command
+
+static int BootIdeSetupAtaTransfer(int nDriveIndex, unsigned uIoBase, tsIdeCommandParams * ptsicp, unsigned int block, int nSectors)
+{
+	unsigned int track;
+
+	if (tsaHarddiskInfo[nDriveIndex].m_wCountHeads > 8) 
+	{
+		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x0a);
+	} else {
+		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x02);
+	}
+
+	/* a count of 0 in the low byte means 256 sectors */
+	ptsicp->m_bCountSector = nSectors & 0xff;
+
+	if( (block + nSectors - 1) >= 0x10000000 ) 
+	{ 	
+		/* 48-bit LBA access required for this block */ 
+		
+		ptsicp->m_bCountSectorExt = (nSectors >> 8) & 0xff;
+		
+		 /* This routine can have a max LBA of 32 bits (due to unsigned int data type used for block parameter) */   
+		
+		ptsicp->m_wCylinderExt = 0; /* 47:32 */   
+		ptsicp->m_bSectorExt = (block >> 24) & 0xff; /* 31:24 */   
+		ptsicp->m_wCylinder = (block >> 8) & 0xffff; /* 23:8 */   
+		ptsicp->m_bSector = block & 0xff; /* 7:0 */   
+		ptsicp->m_bDrivehead = IDE_DH_DRIVE(nDriveIndex) | IDE_DH_LBA;   
+		return 1;
+	}
+
+	// Looks Like we do not have LBA 48 need
+	if (tsaHarddiskInfo[nDriveIndex].m_bLbaMode == IDE_DH_CHS) 
+	{ 
+
+		track = block / tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack;
+	
+		ptsicp->m_bSector = 1+(block % tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack);
+		ptsicp->m_wCylinder = track / tsaHarddiskInfo[nDriveIndex].m_wCountHeads;
+		ptsicp->m_bDrivehead = IDE_DH_DEFAULT |
+			IDE_DH_HEAD(track % tsaHarddiskInfo[nDriveIndex].m_wCountHeads) |
+			IDE_DH_DRIVE(nDriveIndex) |
+			IDE_DH_CHS;
+	} else {
+
+		ptsicp->m_bSector = block & 0xff; /* lower byte of block (lba) */
+		ptsicp->m_wCylinder = (block >> 8) & 0xffff; /* middle 2 bytes of block (lba) */
+		ptsicp->m_bDrivehead = IDE_DH_DEFAULT | /* set bits that must be on */
+			((block >> 24) & 0x0f) | /* lower nibble of byte 3 of block */
+			IDE_DH_DRIVE(nDriveIndex) |
+			IDE_DH_LBA;
+	}
+	return 0;
+}
+
 /* -------------------------------------------------------------------------------- */
 
 /////////////////////////////////////////////////
@@ -833,7 +906,6 @@ int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int
 	tsIdeCommandParams tsicp = IDE_DEFAULT_COMMAND;
 	unsigned uIoBase;
 	unsigned char baBufferSector[IDE_SECTOR_SIZE];
-	unsigned int track;
 	int status;
 	unsigned char ideReadCommand = IDE_CMD_READ_MULTI_RETRY; /* 48-bit LBA */
 	
@@ -858,9 +930,9 @@ int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int
 		int nReturn;
 
 		IoInputByte(IDE_REG_STATUS(uIoBase));
-		if(IoInputByte(IDE_REG_STATUS(uIoBase)&1)) 
+		if(IoInputByte(IDE_REG_STATUS(uIoBase)) & 1) 
 		{ 	// sticky error
-			if(IoInputByte(IDE_REG_ERROR(uIoBase)&0x20)) 
+			if(IoInputByte(IDE_REG_ERROR(uIoBase)) & 0x20) 
 			{ 	// needs attention
 				if(BootIdeAtapiAdditionalSenseCode(nDriveIndex, &ba[0], 2048)<12) 
 				{ 	// needed as it clears NEED ATTENTION
@@ -919,56 +991,11 @@ int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int
 		return 0;
 	}
 
-	if (tsaHarddiskInfo[nDriveIndex].m_wCountHeads > 8) 
+	if(BootIdeSetupAtaTransfer(nDriveIndex, uIoBase, &tsicp, block, 1)) 
 	{
-		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x0a);
-	} else {
-		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x02);
+		ideReadCommand = IDE_CMD_READ_EXT;
 	}
 
-	tsicp.m_bCountSector = 1;
-
-	
-	
-	if( block >= 0x10000000 ) 
-	{ 	
-		/* 48-bit LBA access required for this block */ 
-		
-		tsicp.m_bCountSectorExt = 0;   
-		
-		 /* This routine can have a max LBA of 32 bits (due to unsigned int data type used for block parameter) */   
-		
-		tsicp.m_wCylinderExt = 0; /* 47:32 */   
-		tsicp.m_bSectorExt = (block >> 24) & 0xff; /* 31:24 */   
-		tsicp.m_wCylinder = (block >> 8) & 0xffff; /* 23:8 */   
-		tsicp.m_bSector = block & 0xff; /* 7:0 */   
-		tsicp.m_bDrivehead = IDE_DH_DRIVE(nDriveIndex) | IDE_DH_LBA;   
-		ideReadCommand = IDE_CMD_READ_EXT;   
-    
-	} else {
-        	// Looks Like we do not have LBA 48 need
-        	if (tsaHarddiskInfo[nDriveIndex].m_bLbaMode == IDE_DH_CHS) 
-        	{ 
-
-			track = block / tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack;
-        	
-			tsicp.m_bSector = 1+(block % tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack);
-			tsicp.m_wCylinder = track / tsaHarddiskInfo[nDriveIndex].m_wCountHeads;
-			tsicp.m_bDrivehead = IDE_DH_DEFAULT |
-				IDE_DH_HEAD(track % tsaHarddiskInfo[nDriveIndex].m_wCountHeads) |
-				IDE_DH_DRIVE(nDriveIndex) |
-				IDE_DH_CHS;
-		} else {
-
-			tsicp.m_bSector = block & 0xff; /* lower byte of block (lba) */
-			tsicp.m_wCylinder = (block >> 8) & 0xffff; /* middle 2 bytes of block (lba) */
-			tsicp.m_bDrivehead = IDE_DH_DEFAULT | /* set bits that must be on */
-				((block >> 24) & 0x0f) | /* lower nibble of byte 3 of block */
-				IDE_DH_DRIVE(nDriveIndex) |
-				IDE_DH_LBA;
-		}
-        }       
-        
 	if(BootIdeIssueAtaCommand(uIoBase, ideReadCommand, &tsicp)) 
 	{
 		//printk("ide error %02X...\n", IoInputByte(IDE_REG_ERROR(uIoBase)));
@@ -1016,25 +1043,153 @@ int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int
 
 
 /////////////////////////////////////////////////
-//  BootIdeWriteSector
+//  BootIdeAtapiReadBlocks
 //
-// !!!!! EXPERIMENTAL
+//  Read nBlocks consecutive 2048-byte blocks from a CD/DVD drive with READ(10),
+//  up to 256 blocks per packet
+//  The drive hands the data over in DRQ pieces of at most the 2048 byte count limit
+//  set up by BootIdeIssueAtapiPacketCommandAndPacket
 
-int BootIdeWriteSector(int nDriveIndex, void * pbBuffer, unsigned int block) 
+int BootIdeAtapiReadBlocks(int nDriveIndex, void * pbBuffer, unsigned int block, int nBlocks)
+{
+	unsigned uIoBase;
+	BYTE *pb = (BYTE *)pbBuffer;
+	BYTE ba[12];
+
+	if ((nDriveIndex < 0) || (nDriveIndex >= 2) ||
+	    (tsaHarddiskInfo[nDriveIndex].m_fDriveExists == 0) ||
+	    !tsaHarddiskInfo[nDriveIndex].m_fAtapi)
+	{
+		printk("unknown drive\n");
+		return 1;
+	}
+
+	uIoBase = tsaHarddiskInfo[nDriveIndex].m_fwPortBase;
+
+	IoInputByte(IDE_REG_STATUS(uIoBase));
+	if(IoInputByte(IDE_REG_STATUS(uIoBase)) & 1) 
+	{ 	// sticky error
+		if(IoInputByte(IDE_REG_ERROR(uIoBase)) & 0x20) 
+		{ 	// needs attention, reading the sense data clears it
+			BYTE baSense[256];
+			BootIdeAtapiAdditionalSenseCode(nDriveIndex, &baSense[0], sizeof(baSense));
+		}
+	}
+
+	while(nBlocks > 0) {
+		int nThisTime = (nBlocks > ATAPI_MAX_BLOCKS_PER_COMMAND) ? ATAPI_MAX_BLOCKS_PER_COMMAND : nBlocks;
+		int nBytesLeft = nThisTime * ATAPI_BLOCK_SIZE;
+
+		BootIdeWaitNotBusy(uIoBase);
+
+		memset(ba, 0, sizeof(ba));
+		ba[0]=0x28; 
+		ba[2]=block>>24; 
+		ba[3]=block>>16; 
+		ba[4]=block>>8; 
+		ba[5]=block; 
+		ba[7]=nThisTime>>8; 
+		ba[8]=nThisTime;
+
+		// this also waits for the first DRQ
+		if(BootIdeIssueAtapiPacketCommandAndPacket(nDriveIndex, &ba[0])) return 1;
+
+		while(nBytesLeft > 0) {
+			int nReturn;
+
+			if(BootIdeWaitDataReady(uIoBase)) return 1;
+
+			nReturn=IoInputByte(IDE_REG_CYLINDER_LSB(uIoBase));
+			nReturn |=IoInputByte(IDE_REG_CYLINDER_MSB(uIoBase))<<8;
+			if((nReturn==0) || (nReturn>nBytesLeft)) return 1;
+
+			if(BootIdeReadData(uIoBase, pb, nReturn)) return 1;
+			pb += nReturn;
+			nBytesLeft -= nReturn;
+		}
+
+		block += nThisTime;
+		nBlocks -= nThisTime;
+	}
+
+	return 0;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/////////////////////////////////////////////////
+//  BootIdeReadSectors
+//
+//  Read nSectors consecutive 512-byte sectors starting at block straight into pbBuffer
+//  Up to 256 sectors are requested per ATA command, one DRQ block per sector
+//  Hard disks only, CD/DVD drives are read with BootIdeAtapiReadBlocks
+
+int BootIdeReadSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors) 
 {
 	tsIdeCommandParams tsicp = IDE_DEFAULT_COMMAND;
 	unsigned uIoBase;
-	unsigned int track;
 	int status;
-	unsigned char ideWriteCommand = IDE_CMD_WRITE_MULTI_RETRY; 
+	int nThisTime;
+	unsigned char ideReadCommand;
+	BYTE *pb = (BYTE *)pbBuffer;
 	
-	if(!tsaHarddiskInfo[nDriveIndex].m_fDriveExists) return 4;
+	if ((nDriveIndex < 0) || (nDriveIndex >= 2) ||
+	    (tsaHarddiskInfo[nDriveIndex].m_fDriveExists == 0))
+	{
+		printk("unknown drive\n");
+		return 1;
+	}
+
+	if(tsaHarddiskInfo[nDriveIndex].m_fAtapi) return 1;
 
 	uIoBase = tsaHarddiskInfo[nDriveIndex].m_fwPortBase;
 
-	tsicp.m_bDrivehead = IDE_DH_DEFAULT | IDE_DH_HEAD(0) | IDE_DH_CHS | IDE_DH_DRIVE(nDriveIndex);
-	IoOutputByte(IDE_REG_DRIVEHEAD(uIoBase), tsicp.m_bDrivehead);
+	while(nSectors > 0) {
+		nThisTime = (nSectors > IDE_MAX_SECTORS_PER_COMMAND) ? IDE_MAX_SECTORS_PER_COMMAND : nSectors;
+
+		tsicp = (tsIdeCommandParams)IDE_DEFAULT_COMMAND;
+		tsicp.m_bDrivehead = IDE_DH_DEFAULT | IDE_DH_HEAD(0) | IDE_DH_CHS | IDE_DH_DRIVE(nDriveIndex);
+		IoOutputByte(IDE_REG_DRIVEHEAD(uIoBase), tsicp.m_bDrivehead);
+
+		ideReadCommand = BootIdeSetupAtaTransfer(nDriveIndex, uIoBase, &tsicp, block, nThisTime) ?
+			IDE_CMD_READ_EXT : IDE_CMD_READ_MULTI_RETRY;
+
+		if(BootIdeIssueAtaCommand(uIoBase, ideReadCommand, &tsicp)) 
+		{
+			//printk("ide error %02X...\n", IoInputByte(IDE_REG_ERROR(uIoBase)));
+			return 1;
+		}
+
+		// the drive raises DRQ once per sector
+		block += nThisTime;
+		nSectors -= nThisTime;
+		while(nThisTime--) {
+			status = BootIdeReadData(uIoBase, pb, IDE_SECTOR_SIZE);
+			if(status) return status;
+			pb += IDE_SECTOR_SIZE;
+		}
+	}
+
+	return 0;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/////////////////////////////////////////////////
+//  BootIdeWriteSectors
+//
+//  Write nSectors consecutive 512-byte sectors starting at block
+//  Up to 256 sectors are sent per ATA command, one DRQ block per sector
 
+int BootIdeWriteSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors) 
+{
+	tsIdeCommandParams tsicp = IDE_DEFAULT_COMMAND;
+	unsigned uIoBase;
+	int status;
+	int nThisTime;
+	unsigned char ideWriteCommand;
+	BYTE *pb = (BYTE *)pbBuffer;
+	
 	if ((nDriveIndex < 0) || (nDriveIndex >= 2) ||
 	    (tsaHarddiskInfo[nDriveIndex].m_fDriveExists == 0))
 	{
@@ -1042,68 +1197,77 @@ int BootIdeWriteSector(int nDriveIndex, void * pbBuffer, unsigned int block)
 		return 1;
 	}
 
-	if (tsaHarddiskInfo[nDriveIndex].m_wCountHeads > 8) 
-	{
-		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x0a);
-	} else {
-		IoOutputByte(IDE_REG_CONTROL(uIoBase), 0x02);
-	}
+	if(tsaHarddiskInfo[nDriveIndex].m_fAtapi) return 1;
 
-	tsicp.m_bCountSector = 1;
+	uIoBase = tsaHarddiskInfo[nDriveIndex].m_fwPortBase;
 
-	
-	
-	if( block >= 0x10000000 ) 
-	{ 	
-		/* 48-bit LBA access required for this block */ 
-		
-		tsicp.m_bCountSectorExt = 0;   
-		
-		 /* This routine can have a max LBA of 32 bits (due to unsigned int data type used for block parameter) */   
-		
-		tsicp.m_wCylinderExt = 0; /* 47:32 */   
-		tsicp.m_bSectorExt = (block >> 24) & 0xff; /* 31:24 */   
-		tsicp.m_wCylinder = (block >> 8) & 0xffff; /* 23:8 */   
-		tsicp.m_bSector = block & 0xff; /* 7:0 */   
-		tsicp.m_bDrivehead = IDE_DH_DRIVE(nDriveIndex) | IDE_DH_LBA;   
-		ideWriteCommand = IDE_CMD_WRITE_MULTI_RETRY;
-    
-	} else {
-        	// Looks Like we do not have LBA 48 need
-        	if (tsaHarddiskInfo[nDriveIndex].m_bLbaMode == IDE_DH_CHS) 
-        	{ 
-
-			track = block / tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack;
-        	
-			tsicp.m_bSector = 1+(block % tsaHarddiskInfo[nDriveIndex].m_wCountSectorsPerTrack);
-			tsicp.m_wCylinder = track / tsaHarddiskInfo[nDriveIndex].m_wCountHeads;
-			tsicp.m_bDrivehead = IDE_DH_DEFAULT |
-				IDE_DH_HEAD(track % tsaHarddiskInfo[nDriveIndex].m_wCountHeads) |
-				IDE_DH_DRIVE(nDriveIndex) |
-				IDE_DH_CHS;
-		} else {
+	while(nSectors > 0) {
+		nThisTime = (nSectors > IDE_MAX_SECTORS_PER_COMMAND) ? IDE_MAX_SECTORS_PER_COMMAND : nSectors;
+
+		tsicp = (tsIdeCommandParams)IDE_DEFAULT_COMMAND;
+		tsicp.m_bDrivehead = IDE_DH_DEFAULT | IDE_DH_HEAD(0) | IDE_DH_CHS | IDE_DH_DRIVE(nDriveIndex);
+		IoOutputByte(IDE_REG_DRIVEHEAD(uIoBase), tsicp.m_bDrivehead);
+
+		ideWriteCommand = BootIdeSetupAtaTransfer(nDriveIndex, uIoBase, &tsicp, block, nThisTime) ?
+			IDE_CMD_WRITE_EXT : IDE_CMD_WRITE_MULTI_RETRY;
 
-			tsicp.m_bSector = block & 0xff; /* lower byte of block (lba) */
-			tsicp.m_wCylinder = (block >> 8) & 0xffff; /* middle 2 bytes of block (lba) */
-			tsicp.m_bDrivehead = IDE_DH_DEFAULT | /* set bits that must be on */
-				((block >> 24) & 0x0f) | /* lower nibble of byte 3 of block */
-				IDE_DH_DRIVE(nDriveIndex) |
-				IDE_DH_LBA;
+		if(BootIdeIssueAtaCommand(uIoBase, ideWriteCommand, &tsicp)) 
+		{
+			//printk("ide error %02X...\n", IoInputByte(IDE_REG_ERROR(uIoBase)));
+			return 1;
 		}
-        }       
-        
-	if(BootIdeIssueAtaCommand(uIoBase, ideWriteCommand, &tsicp)) 
+
+		// the drive raises DRQ once per sector
+		block += nThisTime;
+		nSectors -= nThisTime;
+		while(nThisTime--) {
+			status = BootIdeWriteData(uIoBase, pb, IDE_SECTOR_SIZE);
+			if(status) return status;
+			pb += IDE_SECTOR_SIZE;
+		}
+	}
+
+	return 0;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/////////////////////////////////////////////////
+//  BootIdeWriteSector
+//
+//  Write a single 512-byte sector
+
+int BootIdeWriteSector(int nDriveIndex, void * pbBuffer, unsigned int block) 
+{
+	return BootIdeWriteSectors(nDriveIndex, pbBuffer, block, 1);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/////////////////////////////////////////////////
+//  BootIdeFlushCache
+//
+//  Make sure everything written so far has reached the platters
+
+int BootIdeFlushCache(int nDriveIndex)
+{
+	tsIdeCommandParams tsicp = IDE_DEFAULT_COMMAND;
+	unsigned uIoBase;
+
+	if ((nDriveIndex < 0) || (nDriveIndex >= 2) ||
+	    (tsaHarddiskInfo[nDriveIndex].m_fDriveExists == 0) ||
+	    tsaHarddiskInfo[nDriveIndex].m_fAtapi)
 	{
-		//printk("ide error %02X...\n", IoInputByte(IDE_REG_ERROR(uIoBase)));
 		return 1;
 	}
-	
-	status = BootIdeWriteData(uIoBase, pbBuffer, IDE_SECTOR_SIZE);
-	
 
-	return status;
-}
+	uIoBase = tsaHarddiskInfo[nDriveIndex].m_fwPortBase;
+
+	tsicp.m_bDrivehead = IDE_DH_DEFAULT | IDE_DH_HEAD(0) | IDE_DH_CHS | IDE_DH_DRIVE(nDriveIndex);
+	IoOutputByte(IDE_REG_DRIVEHEAD(uIoBase), tsicp.m_bDrivehead);
 
+	return BootIdeIssueAtaCommand(uIoBase, IDE_CMD_FLUSH_CACHE, &tsicp);
+}
 
 
 
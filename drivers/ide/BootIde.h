@@ -14,6 +14,7 @@ typedef enum {
 	IDE_CMD_READ_EXT = 0x24, /* 48-bit LBA */
     	
     	IDE_CMD_WRITE_MULTI_RETRY = 0x30,
+    	IDE_CMD_WRITE_EXT = 0x34, /* 48-bit LBA */
     	
 	IDE_CMD_DRIVE_DIAG = 0x90,
 	IDE_CMD_SET_PARAMS = 0x91,
@@ -21,6 +22,7 @@ typedef enum {
 	                                     IDE_CMD_STANDBY_IMMEDIATE2 */
 	IDE_CMD_SET_MULTIMODE = 0xC6,
 	IDE_CMD_STANDBY_IMMEDIATE2 = 0xE0,
+	IDE_CMD_FLUSH_CACHE = 0xE7,
 	
 	//Get info commands
 	IDE_CMD_IDENTIFY = 0xEC,
@@ -68,5 +70,10 @@ typedef struct {
 int BootIdeInit(void);
 int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int byte_offset, int n_bytes) ;
 int BootIdeReadData(unsigned uIoBase, void * buf, size_t size);
+int BootIdeReadSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeAtapiReadBlocks(int nDriveIndex, void * pbBuffer, unsigned int block, int nBlocks);
+int BootIdeWriteSector(int nDriveIndex, void * pbBuffer, unsigned int block);
+int BootIdeWriteSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeFlushCache(int nDriveIndex);
 
 #endif
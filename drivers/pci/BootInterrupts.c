@@ -329,6 +329,7 @@ void IntHandlerCSmc(void)
 				case 2: // CDROM TRAY IS STARTING OPENING
 					traystate=ETS_OPEN_OR_OPENING;
 					DVD_TRAY_STATE = DVD_OPENING;
+					BootIso9660InvalidateCache(); // whatever comes back may be another disc
 					I2CTransmitWord(0x10, 0x0d02);
 					bprintf("SMC Interrupt %d: CDROM starting opening\n", nCountInterruptsSmc);
 					break;
@@ -356,6 +357,7 @@ void IntHandlerCSmc(void)
 
 				case 5: // BUTTON PRESSED REQUESTING TRAY OPEN
 					traystate=ETS_OPEN_OR_OPENING;
+					BootIso9660InvalidateCache();
 					I2CTransmitWord(0x10, 0x0d04);
 					I2CTransmitWord(0x10, 0x0c00);
 					bprintf("SMC Interrupt %d: CDROM tray opening by Button press\n", nCountInterruptsSmc);
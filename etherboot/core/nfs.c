@@ -57,10 +57,9 @@ static void rpc_printerror(struct rpc_t *rpc)
 }
 
 /**************************************************************************
-AWAIT_RPC - Wait for an rpc packet
+RPC_REPLY - The rpc reply to port ival in the packet, or NULL
 **************************************************************************/
-static int await_rpc(int ival, void *ptr,
-	unsigned short ptype, struct iphdr *ip, struct udphdr *udp)
+static struct rpc_t *rpc_reply(int ival, struct iphdr *ip, struct udphdr *udp)
 {
 	struct rpc_t *rpc;
 	if (!udp) 
@@ -72,10 +71,22 @@ static int await_rpc(int ival, void *ptr,
 	if (nic.packetlen < ETH_HLEN + sizeof(struct iphdr) + sizeof(struct udphdr) + 8)
 		return 0;
 	rpc = (struct rpc_t *)&nic.packet[ETH_HLEN];
-	if (*(unsigned long *)ptr != ntohl(rpc->u.reply.id))
-		return 0;
 	if (MSG_REPLY != ntohl(rpc->u.reply.type))
 		return 0;
+	return rpc;
+}
+
+/**************************************************************************
+AWAIT_RPC - Wait for an rpc packet
+**************************************************************************/
+static int await_rpc(int ival, void *ptr,
+	unsigned short ptype, struct iphdr *ip, struct udphdr *udp)
+{
+	struct rpc_t *rpc = rpc_reply(ival, ip, udp);
+	if (!rpc)
+		return 0;
+	if (*(unsigned long *)ptr != ntohl(rpc->u.reply.id))
+		return 0;
 	return 1;
 }
 
@@ -413,16 +424,59 @@ static int nfs_lookup(int server, int port, char *fh, char *path, char *nfh,
 	return -1;
 }
 
+/**************************************************************************
+NFS_READ_CALL - Build a READ request, returns its length
+**************************************************************************/
+static int nfs_read_call(struct rpc_t *buf, unsigned long id, char *fh,
+	int offset, int len)
+{
+	long *p;
+
+	buf->u.call.id = htonl(id);
+	buf->u.call.type = htonl(MSG_CALL);
+	buf->u.call.rpcvers = htonl(2);	/* use RPC version 2 */
+	buf->u.call.prog = htonl(PROG_NFS);
+	buf->u.call.vers = htonl(2);	/* nfsd is version 2 */
+	buf->u.call.proc = htonl(NFS_READ);
+	p = rpc_add_credentials((long *)buf->u.call.data);
+	memcpy(p, fh, NFS_FHSIZE);
+	p += NFS_FHSIZE / 4;
+	*p++ = htonl(offset);
+	*p++ = htonl(len);
+	*p++ = 0;		/* unused parameter */
+	return (char *)p - (char *)buf;
+}
+
+/**************************************************************************
+NFS_READ_ERROR - The error of a READ reply, 0 if it has the data
+**************************************************************************/
+static int nfs_read_error(struct rpc_t *rpc)
+{
+	if (rpc->u.reply.rstatus || rpc->u.reply.verifier ||
+	    rpc->u.reply.astatus || rpc->u.reply.data[0]) {
+		rpc_printerror(rpc);
+		if (rpc->u.reply.rstatus) {
+			/* RPC failed, no verifier, data[0] */
+			return -9999;
+		}
+		if (rpc->u.reply.astatus) {
+			/* RPC couldn't decode parameters */
+			return -9998;
+		}
+		return -ntohl(rpc->u.reply.data[0]);
+	}
+	return 0;
+}
+
 /**************************************************************************
 NFS_READ - Read File on NFS Server
 **************************************************************************/
 static int nfs_read(int server, int port, char *fh, int offset, int len,
 		    int sport)
 {
-	struct rpc_t buf, *rpc;
+	struct rpc_t buf;
 	unsigned long id;
-	int retries;
-	long *p;
+	int retries, buflen;
 
 	static int tokens=0;
 	/*
@@ -433,50 +487,252 @@ static int nfs_read(int server, int port, char *fh, int offset, int len,
 	 */
 
 	id = rpc_id++;
-	buf.u.call.id = htonl(id);
-	buf.u.call.type = htonl(MSG_CALL);
-	buf.u.call.rpcvers = htonl(2);	/* use RPC version 2 */
-	buf.u.call.prog = htonl(PROG_NFS);
-	buf.u.call.vers = htonl(2);	/* nfsd is version 2 */
-	buf.u.call.proc = htonl(NFS_READ);
-	p = rpc_add_credentials((long *)buf.u.call.data);
-	memcpy(p, fh, NFS_FHSIZE);
-	p += NFS_FHSIZE / 4;
-	*p++ = htonl(offset);
-	*p++ = htonl(len);
-	*p++ = 0;		/* unused parameter */
+	buflen = nfs_read_call(&buf, id, fh, offset, len);
 	for (retries = 0; retries < MAX_RPC_RETRIES; retries++) {
 		long timeout = rfc2131_sleep_interval(TIMEOUT, retries);
 		if (tokens >= 2)
 			timeout = TICKS_PER_SEC/2;
 
 		udp_transmit(arptable[server].ipaddr.s_addr, sport, port,
-			(char *)p - (char *)&buf, &buf);
+			buflen, &buf);
 		if (await_reply(await_rpc, sport, &id, timeout)) {
 			if (tokens < 256)
 				tokens++;
-			rpc = (struct rpc_t *)&nic.packet[ETH_HLEN];
-			if (rpc->u.reply.rstatus || rpc->u.reply.verifier ||
-			    rpc->u.reply.astatus || rpc->u.reply.data[0]) {
-				rpc_printerror(rpc);
-				if (rpc->u.reply.rstatus) {
-					/* RPC failed, no verifier, data[0] */
-					return -9999;
-				}
-				if (rpc->u.reply.astatus) {
-					/* RPC couldn't decode parameters */
-					return -9998;
-				}
-				return -ntohl(rpc->u.reply.data[0]);
-			} else {
-				return 0;
-			}
+			return nfs_read_error((struct rpc_t *)&nic.packet[ETH_HLEN]);
 		} else
 			tokens >>= 1;
 	}
 	return -1;
 }
 
+/*
+ * A READ in the window of nfs_read_window(): in flight, or answered
+ * and waiting for the blocks before it.
+ */
+struct nfs_slot {
+	unsigned long id;
+	int offset;		/* -1 for a free slot */
+	int len;		/* asked for */
+	int rlen;		/* got, -1 while in flight */
+	int retries;
+	unsigned long sent;
+	unsigned long deadline;
+	unsigned char data[NFS_READ_SIZE];
+};
+
+static struct nfs_slot nfs_slots[NFS_READ_WINDOW];
+
+/* currticks() is the PM timer, which counts in 24 bits and wraps every
+ * 4.69s: tick arithmetic is done modulo that, as ebd_clock() does */
+#define NFS_TICKS_MASK	0xffffff
+
+/**************************************************************************
+NFS_TICKS_UNTIL - Ticks from now until then, negative once then is past
+**************************************************************************/
+static long nfs_ticks_until(unsigned long then, unsigned long now)
+{
+	long d = (then - now) & NFS_TICKS_MASK;
+
+	return d > (NFS_TICKS_MASK >> 1) ? d - (NFS_TICKS_MASK + 1) : d;
+}
+
+/**************************************************************************
+AWAIT_NFS_SLOT - Wait for the reply to any READ in flight
+**************************************************************************/
+static int await_nfs_slot(int ival, void *ptr,
+	unsigned short ptype, struct iphdr *ip, struct udphdr *udp)
+{
+	struct rpc_t *rpc = rpc_reply(ival, ip, udp);
+	int i;
+
+	if (!rpc)
+		return 0;
+	for (i = 0; i < NFS_READ_WINDOW; i++) {
+		if (nfs_slots[i].offset != -1 && nfs_slots[i].rlen == -1 &&
+		    nfs_slots[i].id == ntohl(rpc->u.reply.id))
+			return i + 1;
+	}
+	return 0;
+}
+
+/**************************************************************************
+NFS_SLOT_SEND - (Re)send the READ of a slot, the same id each time
+**************************************************************************/
+static void nfs_slot_send(int server, int port, char *fh, struct nfs_slot *s,
+	int sport, long timeout)
+{
+	struct rpc_t buf;
+	int retries;
+
+	for (retries = s->retries; retries > 0 && timeout < NFS_READ_TIMEOUT_MAX; retries--)
+		timeout <<= 1;
+	if (timeout > NFS_READ_TIMEOUT_MAX)
+		timeout = NFS_READ_TIMEOUT_MAX;
+	udp_transmit(arptable[server].ipaddr.s_addr, sport, port,
+		nfs_read_call(&buf, s->id, fh, s->offset, s->len), &buf);
+	s->sent = currticks() & NFS_TICKS_MASK;
+	s->deadline = (s->sent + timeout) & NFS_TICKS_MASK;
+}
+
+/**************************************************************************
+NFS_READ_WINDOW - Read a file from offs on, with up to NFS_READ_WINDOW
+READ requests in flight
+
+The replies may come in any order. Those ahead of the block fnc wants
+next wait in their slot, the next block goes to fnc straight from the
+packet. A READ that times out is sent again; the window halves on every
+timeout and grows back by one with every reply, like the tokens of
+nfs_read(). The timeout follows the round trip time, smoothed as TCP
+does, so a lost reply holds up the blocks after it only briefly.
+Returns like nfs().
+**************************************************************************/
+static int nfs_read_window(int server, int port, char *fh, int offs, int size,
+	unsigned int block, int sport,
+	int (*fnc)(unsigned char *, unsigned int, unsigned int, int))
+{
+	struct rpc_t *rpc;
+	struct nfs_slot *s;
+	unsigned long now;
+	long wait, rtt;
+	long srtt = 0, rttvar = 0;	/* 8 and 4 times the real ones */
+	long timeout = NFS_READ_TIMEOUT;
+	unsigned char *data;
+	int next = offs;	/* next offset to ask for */
+	int window = NFS_READ_WINDOW, inflight = 0;
+	int i, rlen, err;
+
+	for (i = 0; i < NFS_READ_WINDOW; i++)
+		nfs_slots[i].offset = -1;
+
+	while (offs < size) {
+		/* keep the window full */
+		for (i = 0; i < NFS_READ_WINDOW && inflight < window && next < size; i++) {
+			s = &nfs_slots[i];
+			if (s->offset != -1)
+				continue;
+			s->id = rpc_id++;
+			s->offset = next;
+			s->len = size - next < NFS_READ_SIZE ? size - next : NFS_READ_SIZE;
+			s->rlen = -1;
+			s->retries = 0;
+			nfs_slot_send(server, port, fh, s, sport, timeout);
+			next += s->len;
+			inflight++;
+		}
+
+		/* wait until the first of them is due */
+		now = currticks() & NFS_TICKS_MASK;
+		wait = NFS_READ_TIMEOUT;
+		for (i = 0; i < NFS_READ_WINDOW; i++) {
+			s = &nfs_slots[i];
+			if (s->offset != -1 && s->rlen == -1 &&
+			    nfs_ticks_until(s->deadline, now) < wait)
+				wait = nfs_ticks_until(s->deadline, now);
+		}
+		/* await_reply() compares plain ticks, it would never time
+		 * out on a wait that ends past the wrap */
+		if (wait > (long)(NFS_TICKS_MASK - now) - NFS_READ_TIMEOUT_MIN)
+			wait = (long)(NFS_TICKS_MASK - now) - NFS_READ_TIMEOUT_MIN;
+		i = await_reply(await_nfs_slot, sport, NULL, wait > 0 ? wait : 0);
+		if (!i) {
+			now = currticks() & NFS_TICKS_MASK;
+			for (i = 0; i < NFS_READ_WINDOW; i++) {
+				s = &nfs_slots[i];
+				if (s->offset == -1 || s->rlen != -1 ||
+				    nfs_ticks_until(s->deadline, now) > 0)
+					continue;
+				if (++s->retries >= MAX_RPC_RETRIES) {
+					printf("reading at offset %d: ", s->offset);
+					nfs_printerror(-1);
+					nfs_umountall(server);
+					return 0;
+				}
+				nfs_slot_send(server, port, fh, s, sport, timeout);
+				window = window > 1 ? window / 2 : 1;
+			}
+			continue;
+		}
+
+		s = &nfs_slots[i - 1];
+		inflight--;
+		if (window < NFS_READ_WINDOW)
+			window++;
+		if (s->retries == 0) {
+			/* a resent READ says nothing about the round trip */
+			rtt = (currticks() - s->sent) & NFS_TICKS_MASK;
+			if (srtt == 0) {
+				srtt = rtt << 3;
+				rttvar = rtt << 1;
+			} else {
+				rtt -= srtt >> 3;
+				srtt += rtt;
+				if (rtt < 0)
+					rtt = -rtt;
+				rttvar += rtt - (rttvar >> 2);
+			}
+			timeout = (srtt >> 3) + rttvar;
+			if (timeout < NFS_READ_TIMEOUT_MIN)
+				timeout = NFS_READ_TIMEOUT_MIN;
+			if (timeout > NFS_READ_TIMEOUT)
+				timeout = NFS_READ_TIMEOUT;
+		}
+		rpc = (struct rpc_t *)&nic.packet[ETH_HLEN];
+		err = nfs_read_error(rpc);
+		if (err) {
+			printf("reading at offset %d: ", s->offset);
+			nfs_printerror(err);
+			nfs_umountall(server);
+			return 0;
+		}
+		rlen = ntohl(rpc->u.reply.data[18]);
+		if (rlen > s->len) {
+			rlen = s->len;	/* shouldn't happen...  */
+		}
+		data = (unsigned char *)&rpc->u.reply.data[19];
+		if (s->offset != offs) {
+			memcpy(s->data, data, rlen);
+			s->rlen = rlen;
+			continue;
+		}
+
+		/* hand this block on, and those waiting for it */
+		for (;;) {
+			s->offset = -1;
+			err = fnc(data, block, rlen, (offs+rlen == size));
+			if (err <= 0) {
+				nfs_umountall(server);
+				return err;
+			}
+			block++;
+			offs += rlen;
+			if (rlen < s->len && offs < size) {
+				/* a short read leaves a hole, ask again
+				   from there and drop what was ahead */
+				if (rlen == 0) {
+					printf("reading at offset %d: short file\n", offs);
+					nfs_umountall(server);
+					return 0;
+				}
+				for (i = 0; i < NFS_READ_WINDOW; i++)
+					nfs_slots[i].offset = -1;
+				inflight = 0;
+				next = offs;
+				break;
+			}
+			for (i = 0; i < NFS_READ_WINDOW; i++) {
+				if (nfs_slots[i].offset == offs && nfs_slots[i].rlen != -1)
+					break;
+			}
+			if (i == NFS_READ_WINDOW)
+				break;
+			s = &nfs_slots[i];
+			data = s->data;
+			rlen = s->rlen;
+		}
+	}
+	return 1;
+}
+
 /**************************************************************************
 NFS - Download extended BOOTP data, or kernel image from NFS server
 **************************************************************************/
@@ -553,58 +809,52 @@ nfssymlink:
 
 	offs = 0;
 	block = 1;	/* blocks are numbered starting from 1 */
-	size = -1;	/* will be set properly with the first reply */
 	len = NFS_READ_SIZE;	/* first request is always full size */
-	do {
-		err = nfs_read(ARP_SERVER, nfs_port, filefh, offs, len, sport);
-                if ((err <= -NFSERR_ISDIR)&&(err >= -NFSERR_INVAL) && (offs == 0)) {
-			// An error occured. NFS servers tend to sending
-			// errors 21 / 22 when symlink instead of real file
-			// is requested. So check if it's a symlink!
-			block = nfs_readlink(ARP_SERVER, nfs_port, dirfh, dirname,
-			                filefh, sport);
-			if ( 0 == block ) {
-				printf("\nLoading symlink:%s ..",dirname);
-				goto nfssymlink;
-			}
-			nfs_printerror(err);
-			nfs_umountall(ARP_SERVER);
-			return 0;
-		}
-		if (err) {
-			printf("reading at offset %d: ", offs);
-			nfs_printerror(err);
-			nfs_umountall(ARP_SERVER);
-			return 0;
+	/* the first block on its own, its reply tells the size of the file */
+	err = nfs_read(ARP_SERVER, nfs_port, filefh, offs, len, sport);
+	if ((err <= -NFSERR_ISDIR)&&(err >= -NFSERR_INVAL)) {
+		// An error occured. NFS servers tend to sending
+		// errors 21 / 22 when symlink instead of real file
+		// is requested. So check if it's a symlink!
+		block = nfs_readlink(ARP_SERVER, nfs_port, dirfh, dirname,
+		                filefh, sport);
+		if ( 0 == block ) {
+			printf("\nLoading symlink:%s ..",dirname);
+			goto nfssymlink;
 		}
+		nfs_printerror(err);
+		nfs_umountall(ARP_SERVER);
+		return 0;
+	}
+	if (err) {
+		printf("reading at offset %d: ", offs);
+		nfs_printerror(err);
+		nfs_umountall(ARP_SERVER);
+		return 0;
+	}
 
-		rpc = (struct rpc_t *)&nic.packet[ETH_HLEN];
+	rpc = (struct rpc_t *)&nic.packet[ETH_HLEN];
 
-		/* size must be found out early to allow EOF detection */
-		if (size == -1) {
-			size = ntohl(rpc->u.reply.data[6]);
-		}
-		rlen = ntohl(rpc->u.reply.data[18]);
-		if (rlen > len) {
-			rlen = len;	/* shouldn't happen...  */
-		}
+	size = ntohl(rpc->u.reply.data[6]);
+	rlen = ntohl(rpc->u.reply.data[18]);
+	if (rlen > len) {
+		rlen = len;	/* shouldn't happen...  */
+	}
 
-		err = fnc((char *)&rpc->u.reply.data[19], block, rlen,
-			(offs+rlen == size));
-		if (err <= 0) {
-			nfs_umountall(ARP_SERVER);
-			return err;
-		}
+	err = fnc((char *)&rpc->u.reply.data[19], block, rlen,
+		(offs+rlen == size));
+	if (err <= 0) {
+		nfs_umountall(ARP_SERVER);
+		return err;
+	}
+	if (rlen >= size) {
+		/* all the file has been read */
+		return 1;
+	}
 
-		block++;
-		offs += rlen;
-		/* last request is done with matching requested read size */
-		if (size-offs < NFS_READ_SIZE) {
-			len = size-offs;
-		}
-	} while (len != 0);
-	/* len == 0 means that all the file has been read */
-	return 1;
+	/* the rest with several requests in flight */
+	return nfs_read_window(ARP_SERVER, nfs_port, filefh, rlen, size,
+		block + 1, sport, fnc);
 }
 
 #endif	/* DOWNLOAD_PROTO_NFS */
@@ -8,7 +8,8 @@ Literature dealing with the network protocols:
 	UDP - RFC768
 	BOOTP - RFC951, RFC2132 (vendor extensions)
 	DHCP - RFC2131, RFC2132 (options)
-	TFTP - RFC1350, RFC2347 (options), RFC2348 (blocksize), RFC2349 (tsize)
+	TFTP - RFC1350, RFC2347 (options), RFC2348 (blocksize), RFC2349 (tsize),
+	       RFC7440 (windowsize)
 	RPC - RFC1831, RFC1832 (XDR), RFC1833 (rpcbind/portmapper)
 	NFS - RFC1094, RFC1813 (v3, useful for clarifications, not implemented)
 	IGMP - RFC1112, RFC2113, RFC2365, RFC2236, RFC3171
@@ -203,11 +204,50 @@ int eth_poll_into(char *buf, int *len)
 	return 0;
 }
 
+/*
+ * Let the driver receive straight into buffers of the caller: alloc returns
+ * a cookie for a buffer of size bytes, eth_poll_buffer() then hands up the
+ * cookies of filled buffers, which belong to the caller from there on.
+ * Returns 0 if the driver can only copy, eth_poll() works either way.
+ */
+int eth_rx_buffers(void *(*alloc)(unsigned char **buf),
+	void (*release)(void *cookie), unsigned int size)
+{
+	if (!nic.poll_buffer)
+		return 0;
+	nic.rx_alloc = alloc;
+	nic.rx_free = release;
+	nic.rx_bufsize = size;
+	return 1;
+}
+
+int eth_poll_buffer(void **cookie, unsigned int *len)
+{
+	return ((*nic.poll_buffer)(&nic, cookie, len));
+}
+
+struct nic_stats *eth_stats(void)
+{
+	return &nic.stats;
+}
+
 void eth_transmit(const char *d, unsigned int t, unsigned int s, const void *p)
 {
 	(*nic.transmit)(&nic, d, t, s, p);
 }
 
+/*
+ * Send a complete frame, ethernet header included, given as nfrags pieces.
+ * Returns 1 once sent, 0 if it was dropped and -1 if the driver cannot
+ * gather, eth_transmit() has to be used then.
+ */
+int eth_transmit_frags(const struct nic_frag *frag, int nfrags)
+{
+	if (!nic.transmit_frags)
+		return -1;
+	return ((*nic.transmit_frags)(&nic, frag, nfrags));
+}
+
 void eth_disable(void)
 {
 #ifdef MULTICAST_LEVEL2
@@ -487,6 +527,9 @@ int tftp(const char *name, int (*fnc)(unsigned char *, unsigned int, unsigned in
 	struct tftpreq_t tp;
 	int		rc;
 	int		packetsize = TFTP_DEFAULTSIZE_PACKET;
+	int		windowsize = 1;	/* until the server agrees to more */
+	int		inwindow = 0;	/* blocks taken since the last ACK */
+	int		gapacked = 0;	/* ACKed the block before a gap */
 
 	rx_qdrain();
 
@@ -494,8 +537,8 @@ int tftp(const char *name, int (*fnc)(unsigned char *, unsigned int, unsigned in
 	/* Warning: the following assumes the layout of bootp_t.
 	   But that's fixed by the IP, UDP and BOOTP specs. */
 	len = sizeof(tp.ip) + sizeof(tp.udp) + sizeof(tp.opcode) +
-		sprintf((char *)tp.u.rrq, "%s%coctet%cblksize%c%d",
-		name, 0, 0, 0, TFTP_MAX_PACKET) + 1;
+		sprintf((char *)tp.u.rrq, "%s%coctet%cblksize%c%d%cwindowsize%c%d",
+		name, 0, 0, 0, TFTP_MAX_PACKET, 0, 0, TFTP_WINDOWSIZE) + 1;
 	if (!udp_transmit(arptable[ARP_SERVER].ipaddr.s_addr, ++iport,
 		TFTP_PORT, len, &tp))
 		return (0);
@@ -518,16 +561,23 @@ int tftp(const char *name, int (*fnc)(unsigned char *, unsigned int, unsigned in
 			}
 #ifdef	CONGESTED
 			if (block && ((retry += TFTP_REXMT) < TFTP_TIMEOUT))
+#else
+			/* a window whose last block got lost leaves the
+			   server waiting for an ACK that never comes */
+			if (block && windowsize > 1 && retry++ < MAX_TFTP_RETRIES)
+#endif
 			{	/* we resend our last ack */
 #ifdef	MDEBUG
 				printf("<REXMT>\n");
 #endif
+				tp.opcode = htons(TFTP_ACK);
+				tp.u.ack.block = htons(prevblock);
+				inwindow = 0;
 				udp_transmit(arptable[ARP_SERVER].ipaddr.s_addr,
 					iport, oport,
 					TFTP_MIN_PACKET, &tp);
 				continue;
 			}
-#endif
 			break;	/* timeout */
 		}
 		tr = (struct tftp_t *)&nic.packet[ETH_HLEN];
@@ -558,6 +608,15 @@ int tftp(const char *name, int (*fnc)(unsigned char *, unsigned int, unsigned in
 					if (p < e)
 						p++;
 				}
+				else if (!strcasecmp("windowsize", p)) {
+					p += 11;
+					windowsize = strtoul(p, &p, 10);
+					if (windowsize < 1 || windowsize > TFTP_WINDOWSIZE)
+						goto noak;
+					while (p < e && *p) p++;
+					if (p < e)
+						p++;
+				}
 				else {
 				noak:
 					tp.opcode = htons(TFTP_ERROR);
@@ -582,34 +641,49 @@ int tftp(const char *name, int (*fnc)(unsigned char *, unsigned int, unsigned in
 			}
 			if (p > e)
 				goto noak;
-			block = tp.u.ack.block = 0; /* this ensures, that */
-						/* the packet does not get */
-						/* processed as data! */
+			block = 0;	/* this ensures, that the packet */
+					/* does not get processed as data! */
 		}
 		else if (tr->opcode == htons(TFTP_DATA)) {
 			len = ntohs(tr->udp.len) - sizeof(struct udphdr) - 4;
 			if (len > packetsize)	/* shouldn't happen */
 				continue;	/* ignore it */
-			block = ntohs(tp.u.ack.block = tr->u.data.block); }
+			block = ntohs(tr->u.data.block);
+			if ((unsigned short)(block - prevblock) != 1) {
+				/* Retransmission, or a block lost in front
+				 * of this one.  ACK the last block in order,
+				 * once per gap, so that the server restarts
+				 * the window behind it.  In lock step every
+				 * retransmission is ACKed, as before.  */
+				if (gapacked && windowsize > 1)
+					continue;
+				gapacked = 1;
+				block = prevblock;
+			}
+		}
 		else {/* neither TFTP_OACK nor TFTP_DATA */
 			break;
 		}
 
-		if ((block || bcounter) && (block != (unsigned short)(prevblock+1))) {
-			/* Block order should be continuous */
-			tp.u.ack.block = htons(block = prevblock);
-		}
-		tp.opcode = htons(TFTP_ACK);
 		oport = ntohs(tr->udp.src);
-		udp_transmit(arptable[ARP_SERVER].ipaddr.s_addr, iport,
-			oport, TFTP_MIN_PACKET, &tp);	/* ack */
-		if ((unsigned short)(block-prevblock) != 1) {
+		if (block == prevblock || ++inwindow >= windowsize ||
+		    len < packetsize) {
+			/* the OACK, a gap, a full window or the last block */
+			tp.opcode = htons(TFTP_ACK);
+			tp.u.ack.block = htons(block);
+			inwindow = 0;
+			udp_transmit(arptable[ARP_SERVER].ipaddr.s_addr, iport,
+				oport, TFTP_MIN_PACKET, &tp);	/* ack */
+		}
+		if (block == prevblock) {
 			/* Retransmission or OACK, don't process via callback
 			 * and don't change the value of prevblock.  */
 			continue;
 		}
 		prevblock = block;
+		gapacked = 0;
 		retry = 0;	/* It's the right place to zero the timer? */
+		/* the block goes to fnc straight from the receive buffer */
 		if ((rc = fnc(tr->u.data.download,
 			      ++bcounter, len, len < packetsize)) <= 0)
 			return(rc);
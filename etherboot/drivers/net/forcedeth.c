@@ -266,8 +266,21 @@ enum {
 #define NV_WATCHDOG_TIMEO   (5*HZ)
 #define DEFAULT_MTU     1500    /* also maximum supported, at least for now */
 
-#define RX_RING     4
-#define TX_RING     2
+/* descriptor ring sizes, a deep rx ring rides out bursts while the
+ * polling loop is busy elsewhere. Override with -DFORCEDETH_RX_RING=n
+ */
+#ifndef FORCEDETH_RX_RING
+#define FORCEDETH_RX_RING   32
+#endif
+#ifndef FORCEDETH_TX_RING
+#define FORCEDETH_TX_RING   16
+#endif
+#define RX_RING     FORCEDETH_RX_RING
+#define TX_RING     FORCEDETH_TX_RING
+
+/* how long transmit waits for the nic to free a tx descriptor */
+#define NV_TXWAIT_DELAY     10
+#define NV_TXWAIT_DELAYMAX  100000
 
 /*
  * If your nic mysteriously hangs then try to reduce the limits
@@ -331,6 +344,12 @@ RX Descriptor   All descriptors point to a
 part of this buffer */
 static unsigned char rxb[RX_RING * RX_NIC_BUFSIZE];
 
+/* Where each RX descriptor points: its part of rxb, or once the caller
+lends buffers through eth_rx_buffers() one of those, which is then handed
+up as is and replaced instead of being copied out */
+static unsigned char *rx_buf[RX_RING];
+static void *rx_cookie[RX_RING];
+
 /* Private Storage for the NIC */
 static struct forcedeth_private {
     /* General data:
@@ -699,30 +718,34 @@ static void txrx_reset(struct nic *nic __unused)
 }
 
 /*
- * alloc_rx: fill rx ring entries.
- * Return 1 if the allocations for the skbs failed and the
- * rx engine is without Available descriptors
+ * arm_rx: give rx ring entry i back to the nic.
  */
-static int alloc_rx(struct nic *nic __unused)
+static void arm_rx(struct nic *nic, int i)
+{
+    if (rx_buf[i] == NULL)
+        rx_buf[i] = &rxb[i * RX_NIC_BUFSIZE];
+    rx_ring[i].PacketBuffer = virt_to_le32desc(rx_buf[i]);
+    rx_ring[i].Length = cpu_to_le16(rx_cookie[i] ? nic->rx_bufsize :
+                    RX_NIC_BUFSIZE);
+    wmb();
+    rx_ring[i].Flags = cpu_to_le16(NV_RX_AVAIL);
+}
+
+/*
+ * alloc_rx: hand the rx ring entries the cpu is done with back to the nic.
+ * Entries still holding a frame that has not been polled are left alone.
+ */
+static void alloc_rx(struct nic *nic)
 {
     unsigned int refill_rx = np->refill_rx;
-    int i;
-    //while (np->cur_rx != refill_rx) {
-    for (i = 0; i < RX_RING; i++) {
-        //int nr = refill_rx % RX_RING;
-        rx_ring[i].PacketBuffer =
-            virt_to_le32desc(&rxb[i * RX_NIC_BUFSIZE]);
-        rx_ring[i].Length = cpu_to_le16(RX_NIC_BUFSIZE);
-        wmb();
-        rx_ring[i].Flags = cpu_to_le16(NV_RX_AVAIL);
-              dprintf(("alloc_rx: Packet  %d marked as Available",
+
+    while (np->cur_rx + RX_RING != refill_rx) {
+        arm_rx(nic, refill_rx % RX_RING);
+        dprintf(("alloc_rx: Packet  %d marked as Available",
            refill_rx));
         refill_rx++;
     }
     np->refill_rx = refill_rx;
-    if (np->cur_rx - refill_rx == RX_RING)
-        return 1;
-    return 0;
 }
 
 static int update_linkspeed(struct nic *nic)
@@ -829,7 +852,7 @@ static int update_linkspeed(struct nic *nic)
 
 
 
-static int init_ring(struct nic *nic)
+static void init_ring(struct nic *nic)
 {
     int i;
 
@@ -843,7 +866,7 @@ static int init_ring(struct nic *nic)
     for (i = 0; i < RX_RING; i++) {
         rx_ring[i].Flags = 0;
     }
-    return alloc_rx(nic);
+    alloc_rx(nic);
 }
 
 static void set_multicast(struct nic *nic)
@@ -885,7 +908,7 @@ RESET - Reset the NIC to prepare for use
 static int forcedeth_reset(struct nic *nic)
 {
     u8 *base = (u8 *) BASE;
-    int ret, oom, i;
+    int ret, i;
     ret = 0;
     dprintf(("forcedeth: open"));
 
@@ -903,7 +926,7 @@ static int forcedeth_reset(struct nic *nic)
     writel(0, base + NvRegAdapterControl);
 
     /* 2) initialize descriptor rings */
-    oom = init_ring(nic);
+    init_ring(nic);
 
     writel(0, base + NvRegLinkSpeed);
     writel(0, base + NvRegUnknownTransmitterReg);
@@ -1039,36 +1062,222 @@ static int forcedeth_reset(struct nic *nic)
 /**************************************************************************
 POLL - Wait for a frame
 ***************************************************************************/
+static void rx_check_nobuf(struct nic *nic)
+{
+    u8 *base = (u8 *) BASE;
+
+    /* the nic ran out of rx descriptors and dropped frames */
+    if (readl(base + NvRegIrqStatus) & NVREG_IRQ_RX_NOBUF) {
+        writel(NVREG_IRQ_RX_NOBUF, base + NvRegIrqStatus);
+        nic->stats.rx_nobuf++;
+    }
+}
+
+/*
+ * rx_frame_ok: checks the status of a completed rx descriptor and counts
+ * it. Returns 0 for frames that are to be dropped.
+ */
+static int rx_frame_ok(struct nic *nic, int i, unsigned int *plen)
+{
+    u16 flags = le16_to_cpu(rx_ring[i].Flags);
+    unsigned int len = le16_to_cpu(rx_ring[i].Length);
+
+    if (flags & NV_RX_MISSEDFRAME) {
+        nic->stats.rx_missed++;
+        return 0;
+    }
+    if (flags & NV_RX_OVERFLOW) {
+        nic->stats.rx_overruns++;
+        return 0;
+    }
+    if (flags & (NV_RX_ERROR1 | NV_RX_ERROR2 | NV_RX_ERROR3 |
+             NV_RX_CRCERR)) {
+        nic->stats.rx_errors++;
+        return 0;
+    }
+    if (flags & NV_RX_ERROR4) {
+        /* length error, harmless for padded ethernet II frames whose
+           type field is not a length */
+        unsigned char *hdr = rx_buf[i];
+        if (len < ETH_HLEN || ((hdr[12] << 8) | hdr[13]) <= ETH_MAX_MTU) {
+            nic->stats.rx_errors++;
+            return 0;
+        }
+    }
+    if ((flags & NV_RX_FRAMINGERR) && (flags & NV_RX_SUBSTRACT1))
+        len--;
+
+    nic->stats.rx_frames++;
+    *plen = len;
+    return 1;
+}
+
 static int forcedeth_poll(struct nic *nic)
 {
     /* return true if there's an ethernet packet ready to read */
     /* nic->packet should contain data on return */
     /* nic->packetlen should contain length of data */
 
-    struct ring_desc *prd;
-    int len;
+    unsigned int len;
     int i;
 
-    i = np->cur_rx % RX_RING;
-    prd = &rx_ring[i];
+    rx_check_nobuf(nic);
+
+    /* drop bad frames until a good one or an empty descriptor turns up */
+    for (;;) {
+        i = np->cur_rx % RX_RING;
+        if (!(rx_ring[i].Flags & cpu_to_le16(NV_RX_DESCRIPTORVALID)))
+            return 0;       /* initially as this is called to flush the input */
+
+        if (rx_frame_ok(nic, i, &len)) {
+            /* got a valid packet - forward it to the network core */
+            if (len > RX_NIC_BUFSIZE)
+                len = RX_NIC_BUFSIZE;
+            nic->packetlen = len;
+            //hex_dump(rx_buf[i], len);
+            memcpy(nic->packet, rx_buf[i], nic->packetlen);
+        } else {
+            len = 0;
+        }
 
-    if (prd->Flags & cpu_to_le16(NV_RX_DESCRIPTORVALID)) {
-        /* got a valid packet - forward it to the network core */
-        len = cpu_to_le16(prd->Length);
-        nic->packetlen = len;
-        //hex_dump(rxb + (i * RX_NIC_BUFSIZE), len);
-        memcpy(nic->packet, rxb +
-               (i * RX_NIC_BUFSIZE), nic->packetlen);
+        wmb();
+        np->cur_rx++;
+        alloc_rx(nic);
+        if (len) {
+            dprintf(("incoming packet"));
+            return 1;
+        }
+    }
+}
+
+
+/**************************************************************************
+POLL_BUFFER - Hand up a frame in the buffer it was received into
+***************************************************************************/
+static int forcedeth_poll_buffer(struct nic *nic, void **cookie,
+                 unsigned int *plen)
+{
+    unsigned char *buf;
+    void *fresh;
+    unsigned int len;
+    int got;
+    int i;
+
+    rx_check_nobuf(nic);
+
+    for (;;) {
+        i = np->cur_rx % RX_RING;
+        if (!(rx_ring[i].Flags & cpu_to_le16(NV_RX_DESCRIPTORVALID)))
+            return 0;
+
+        got = 0;
+        if (rx_frame_ok(nic, i, &len)) {
+            if (len > nic->rx_bufsize)
+                len = nic->rx_bufsize;
+
+            /* the entry only goes back to the nic with a buffer in it,
+               without a replacement the frame is dropped and its buffer
+               reused */
+            fresh = nic->rx_alloc(&buf);
+            if (fresh != NULL) {
+                if (rx_cookie[i] == NULL) {
+                    /* still on rxb, frames received before the caller
+                       lent buffers are copied this once */
+                    memcpy(buf, rx_buf[i], len);
+                    *cookie = fresh;
+                    fresh = nic->rx_alloc(&buf);
+                    if (fresh != NULL) {
+                        rx_cookie[i] = fresh;
+                        rx_buf[i] = buf;
+                    }
+                } else {
+                    *cookie = rx_cookie[i];
+                    rx_cookie[i] = fresh;
+                    rx_buf[i] = buf;
+                }
+                *plen = len;
+                got = 1;
+            } else {
+                nic->stats.rx_dropped++;
+            }
+        }
 
         wmb();
         np->cur_rx++;
         alloc_rx(nic);
-        dprintf(("incoming packet"));
-        return 1;
+        if (got)
+            return 1;
     }
-    return 0;       /* initially as this is called to flush the input */
 }
 
+/*
+ * reclaim_tx: takes back every tx descriptor the nic is done with
+ */
+static void reclaim_tx(struct nic *nic)
+{
+    u16 flags;
+
+    while (np->nic_tx != np->next_tx) {
+        flags = le16_to_cpu(tx_ring[np->nic_tx % TX_RING].Flags);
+        if (flags & NV_TX_VALID)
+            break;
+        if (flags & NV_TX_ERROR)
+            nic->stats.tx_errors++;
+        else
+            nic->stats.tx_frames++;
+        np->nic_tx++;
+    }
+}
+
+/*
+ * tx_claim: returns the ring buffer of the next free tx descriptor, or NULL
+ * if the nic did not free one in time
+ */
+static u8 *tx_claim(struct nic *nic)
+{
+    /* descriptors are only reclaimed once the ring is full, then all the
+       nic has finished with in one go */
+    if (np->next_tx - np->nic_tx >= TX_RING) {
+        int waited = 0;
+
+        reclaim_tx(nic);
+        while (np->next_tx - np->nic_tx >= TX_RING) {
+            if (waited >= NV_TXWAIT_DELAYMAX) {
+                nic->stats.tx_dropped++;
+                return NULL;
+            }
+            udelay(NV_TXWAIT_DELAY);
+            waited += NV_TXWAIT_DELAY;
+            reclaim_tx(nic);
+        }
+    }
+
+    /* point to the current txb incase multiple tx_rings are used */
+    return txb + ((np->next_tx % TX_RING) * RX_NIC_BUFSIZE);
+}
+
+/*
+ * tx_kick: pads the frame of s bytes in the buffer from tx_claim() and
+ * hands it to the nic
+ */
+static void tx_kick(u8 * ptxb, unsigned int s)
+{
+    u8 *base = (u8 *) BASE;
+    int nr = np->next_tx % TX_RING;
+
+    while (s < ETH_ZLEN)    /* pad to min length */
+        ptxb[s++] = '\0';
+
+    tx_ring[nr].PacketBuffer = (u32) virt_to_le32desc(ptxb);
+    tx_ring[nr].Length = cpu_to_le16(s - 1);
+
+    wmb();
+    tx_ring[nr].Flags = np->tx_flags;
+
+    writel(NVREG_TXRXCTL_KICK, base + NvRegTxRxControl);
+    pci_push(base);
+    np->next_tx++;
+}
 
 /**************************************************************************
 TRANSMIT - Transmit a frame
@@ -1081,17 +1290,12 @@ static void forcedeth_transmit(struct nic *nic, const char *d,  /* Destination *
     /* send the packet to destination */
     u8 *ptxb;
     u16 nstype;
-    //u16 status;
-    u8 *base = (u8 *) BASE;
-    int nr;
 
     dprintf(("ETH transmit"));
 
-    nr = np->next_tx % TX_RING;
-
-    /* point to the current txb incase multiple tx_rings are used */
-    ptxb = txb + (nr * RX_NIC_BUFSIZE);
-    //np->tx_skbuff[nr] = ptxb;
+    ptxb = tx_claim(nic);
+    if (ptxb == NULL)
+        return;
 
     /* copy the packet to ring buffer */
     memcpy(ptxb, d, ETH_ALEN);  /* dst */
@@ -1100,27 +1304,43 @@ static void forcedeth_transmit(struct nic *nic, const char *d,  /* Destination *
     memcpy(ptxb + 2 * ETH_ALEN, (u8 *) & nstype, 2);    /* type */
     memcpy(ptxb + ETH_HLEN, p, s);
 
-    s += ETH_HLEN;
-    while (s < ETH_ZLEN)    /* pad to min length */
-        ptxb[s++] = '\0';
+    tx_kick(ptxb, s + ETH_HLEN);
+}
 
-    tx_ring[nr].PacketBuffer = (u32) virt_to_le32desc(ptxb);
-    tx_ring[nr].Length = cpu_to_le16(s - 1);
+/**************************************************************************
+TRANSMIT_FRAGS - Transmit a complete frame given in pieces
+***************************************************************************/
+static int forcedeth_transmit_frags(struct nic *nic,
+                    const struct nic_frag *frag, int nfrags)
+{
+    u8 *ptxb;
+    unsigned int s = 0;
+    int i;
 
-    wmb();
-    tx_ring[nr].Flags = np->tx_flags;
+    for (i = 0; i < nfrags; i++)
+        s += frag[i].len;
+    if (s > ETH_FRAME_LEN)
+        return 0;
 
-    writel(NVREG_TXRXCTL_KICK, base + NvRegTxRxControl);
-    pci_push(base);
-    np->next_tx++;
+    ptxb = tx_claim(nic);
+    if (ptxb == NULL)
+        return 0;
 
+    /* the one copy the frame gets, straight into the ring buffer */
+    s = 0;
+    for (i = 0; i < nfrags; i++) {
+        memcpy(ptxb + s, frag[i].data, frag[i].len);
+        s += frag[i].len;
+    }
 
+    tx_kick(ptxb, s);
+    return 1;
 }
 
 /**************************************************************************
 DISABLE - Turn off ethernet interface
 ***************************************************************************/
-static void forcedeth_disable(struct dev *dev __unused)
+static void forcedeth_disable(struct dev *dev)
 {
     /* put the card in its initial state */
     /* This function serves 3 purposes.
@@ -1133,10 +1353,21 @@ static void forcedeth_disable(struct dev *dev __unused)
      *  if something is something goes wrong.
      */
     u8 *base = (u8 *) BASE;
+    struct nic *nic = (struct nic *)dev;
+    int i;
     np->in_shutdown = 1;
     stop_tx();
     stop_rx();
 
+    /* return lent receive buffers, the ring falls back to rxb */
+    for (i = 0; i < RX_RING; i++) {
+        if (rx_cookie[i] != NULL) {
+            nic->rx_free(rx_cookie[i]);
+            rx_cookie[i] = NULL;
+        }
+        rx_buf[i] = NULL;
+    }
+
     /* disable interrupts on the nic or we will lock up */
     writel(0, base + NvRegIrqMask);
     pci_push(base);
@@ -1289,7 +1520,9 @@ static int forcedeth_probe(struct dev *dev, struct pci_device *pci)
     /* point to NIC specific routines */
     dev->disable = forcedeth_disable;
     nic->poll = forcedeth_poll;
+    nic->poll_buffer = forcedeth_poll_buffer;
     nic->transmit = forcedeth_transmit;
+    nic->transmit_frags = forcedeth_transmit_frags;
     return 1;
 //      }
     /* else */
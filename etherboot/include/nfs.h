@@ -32,6 +32,19 @@
  * Chosen to be a power of two, as most NFS servers are optimized for this.  */
 #define NFS_READ_SIZE	1024
 
+/* READ requests kept in flight at once after the first block, 1 is one
+ * at a time.  Their replies may arrive in any order.  */
+#ifndef	NFS_READ_WINDOW
+#define	NFS_READ_WINDOW	8
+#endif
+/* how long a READ in the window gets before it is sent again: the
+ * round trip time plus four times its deviation, as TCP does, within
+ * these bounds, and doubled with each retry up to NFS_READ_TIMEOUT_MAX.
+ * That stays under half the 4.69s the 24 bit PM timer takes to wrap.  */
+#define	NFS_READ_TIMEOUT_MIN	(TICKS_PER_SEC/100)
+#define	NFS_READ_TIMEOUT	(TICKS_PER_SEC/2)
+#define	NFS_READ_TIMEOUT_MAX	(TICKS_PER_SEC*2)
+
 #define NFS_MAXLINKDEPTH 16
 
 struct rpc_t {
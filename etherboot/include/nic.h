@@ -9,6 +9,7 @@
 #define NIC_H
 
 #include "dev.h"
+#include "../../include/nic_shared.h"
 
 /*
  *	Structure returned from eth_probe and passed to other driver
@@ -26,6 +27,16 @@ struct nic
 	unsigned char	*packet;
 	unsigned int	packetlen;
 	void		*priv_data;	/* driver can hang private data here */
+	/* optional, hands up frames in the buffers lent by eth_rx_buffers() */
+	int		(*poll_buffer)P((struct nic *, void **cookie,
+				unsigned int *len));
+	void		*(*rx_alloc)P((unsigned char **buf));
+	void		(*rx_free)P((void *cookie));
+	unsigned int	rx_bufsize;
+	struct nic_stats stats;
+	/* optional, sends a complete frame gathered from pieces */
+	int		(*transmit_frags)P((struct nic *,
+				const struct nic_frag *frag, int nfrags));
 };
 
 
@@ -33,6 +44,9 @@ extern struct nic nic;
 extern int  eth_probe(struct dev *dev);
 extern int  eth_poll(void);
 extern void eth_transmit(const char *d, unsigned int t, unsigned int s, const void *p);
+extern int eth_rx_buffers(void *(*alloc)(unsigned char **buf),
+	void (*release)(void *cookie), unsigned int size);
+extern int eth_poll_buffer(void **cookie, unsigned int *len);
 extern void eth_disable(void);
 extern int eth_load_configuration(struct dev *dev);
 extern int eth_load(struct dev *dev);;
@@ -4,6 +4,11 @@
 #define TFTP_PORT	69
 #define	TFTP_DEFAULTSIZE_PACKET	512
 #define	TFTP_MAX_PACKET		1432 /* 512 */
+/* blocks the server may send before waiting for an ACK (RFC 7440),
+   1 is plain lock step */
+#ifndef	TFTP_WINDOWSIZE
+#define	TFTP_WINDOWSIZE		16
+#endif
 
 #define TFTP_RRQ	1
 #define TFTP_WRQ	2
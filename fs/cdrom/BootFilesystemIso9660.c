@@ -31,241 +31,452 @@ void BootIso9660DescriptorToString(const char * szcDescriptor, int nLength, char
 }
 
 
-// this is a helper function for BootIso9660GetFileDetails() below
-// returns zero if error, 1 if file, 2 if directory
+// directory extents already pulled off the disc, so repeated lookups (and
+// lookups of several candidate names) don't go back to the drive.  Entries
+// stay valid until the tray opens, see BootIso9660InvalidateCache()
 
-int BootIso9660GoDownOneLevelOrHit(int driveId, DWORD dwSector, DWORD dwBytesToScan, const char * szcName, ISO_SYSTEM_DIRECTORY_RECORD * pisdrForFile)
+#define ISO9660_DIRECTORY_CACHE_ENTRIES 8
+
+typedef struct {
+	int m_nDriveId;
+	DWORD m_dwSector;
+	DWORD m_dwLength;
+	BYTE * m_pba;  // NULL if the slot is unused
+} ISO_DIRECTORY_CACHE_ENTRY;
+
+static ISO_DIRECTORY_CACHE_ENTRY aidceCache[ISO9660_DIRECTORY_CACHE_ENTRIES];
+static int nIso9660CacheNext=0;
+static volatile bool fIso9660CacheStale=false;
+
+// called from the SMC interrupt when the tray starts opening, so it only
+// flags the cache: the buffers are released on the next lookup
+
+void BootIso9660InvalidateCache(void)
+{
+	fIso9660CacheStale=true;
+}
+
+static void BootIso9660FlushCache(void)
 {
-	BYTE *ba=malloc(dwBytesToScan);  // enough for 50 sectors
-	
-	ISO_SYSTEM_DIRECTORY_RECORD * pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)&ba[0];
-	int nPos=0;
-	DWORD dwTotalLength;
+	int n;
+	for(n=0;n<ISO9660_DIRECTORY_CACHE_ENTRIES;n++) {
+		if(aidceCache[n].m_pba!=NULL) free(aidceCache[n].m_pba);
+		aidceCache[n].m_pba=NULL;
+	}
+	nIso9660CacheNext=0;
+}
+
+// returns the dwLength bytes of directory data at dwSector, reading them from
+// the disc only if they are not cached.  NULL if the read failed.
+// The buffer belongs to the cache, it is valid until the next call
+
+static BYTE * BootIso9660GetDirectoryExtent(int driveId, DWORD dwSector, DWORD dwLength)
+{
+	ISO_DIRECTORY_CACHE_ENTRY * pidce;
+	DWORD dwSectors=(dwLength+2047)/2048;
+	int n;
+
+	if(fIso9660CacheStale) {
+		fIso9660CacheStale=false;
+		BootIso9660FlushCache();
+	}
+
+	for(n=0;n<ISO9660_DIRECTORY_CACHE_ENTRIES;n++) {
+		pidce=&aidceCache[n];
+		if((pidce->m_pba!=NULL) && (pidce->m_nDriveId==driveId) &&
+			(pidce->m_dwSector==dwSector) && (pidce->m_dwLength==dwLength)) return pidce->m_pba;
+	}
 
-	//printk("BootIso9660GoDownOneLevelOrHit(0x%x, 0x%x, %s ...)\n", dwSector, dwBytesToScan, szcName);
+	if(dwSectors==0) return NULL;
 
-	dwTotalLength=dwBytesToScan;
+	pidce=&aidceCache[nIso9660CacheNext];
+	if(pidce->m_pba!=NULL) free(pidce->m_pba);
+	pidce->m_pba=malloc(dwSectors*2048);
+	if(pidce->m_pba==NULL) return NULL;
 
 	// pull in the whole dir struct at once, to avoid probs at sector boundaries
 
-	while(dwBytesToScan || (dwSector==ROOT_SECTOR)) {
+	if(BootIdeAtapiReadBlocks(driveId, pidce->m_pba, dwSector, dwSectors)) {
+		free(pidce->m_pba);
+		pidce->m_pba=NULL;
+		return NULL;
+	}
 
-		if(dwBytesToScan>=0x800) dwBytesToScan-=0x800; else dwBytesToScan=0;
+	pidce->m_nDriveId=driveId;
+	pidce->m_dwSector=dwSector;
+	pidce->m_dwLength=dwLength;
+	nIso9660CacheNext=(nIso9660CacheNext+1)%ISO9660_DIRECTORY_CACHE_ENTRIES;
 
-		if(BootIdeReadSector(driveId, &ba[nPos], dwSector, 0, 2048)) return 0;
-		nPos+=2048;
-		dwSector++;
+	return pidce->m_pba;
+}
+
+// true if the directory record is for szcName, either by its mangled 8.3
+// name or by its Rock Ridge NM name
+
+static bool BootIso9660RecordMatches(ISO_SYSTEM_DIRECTORY_RECORD * pisdr, const char * szcName)
+{
+	char *szc = (char *)(&pisdr->m_cFirstFileIdPlaceholder);
+		// compute what's left after total struct size and 8.3 name
+	int nCharsLeft=pisdr->m_bLength - ((szc-((char *)pisdr))  );
+	int nNameLength=strlen(szcName);
+
+	// check mangled 8.3 version
+
+	{
+		int n=0;
+		while((n<nNameLength) && (n<pisdr->m_bFileIdentifierLength) && (szc[n]==szcName[n]) && (szc[n]!=';')) n++;
+
+			// directories have no ;1 version suffix
+		if((n==nNameLength) && ((n==pisdr->m_bFileIdentifierLength) || (szc[n]==';'))) return true;
 	}
 
+	nCharsLeft-=pisdr->m_bFileIdentifierLength;
+	szc+=pisdr->m_bFileIdentifierLength; // skip over the horrible mangled 8.3 version
+
+	if(*szc=='\0') szc++;  // 00 separator on some, not on others.  Can never be 00 by accident
+
+		// structure of extended names seems to be two char extension descriptor, eg, RR
+		// followed by byte length count of extension including descriptor chars
+		// then for all descriptors an LH format version word
+		// for the name that we want the extension descriptor is NM (name?)
+
+		// first we iterate through the descriptors looking for NM
+
+	{
+		bool fSeen=false;
+		int nHitLength=0;
+
+		while((nCharsLeft>1) && (!fSeen)) {
+
+			if((*szc=='N') && (szc[1]=='M')) {
+				fSeen=true;
+				nHitLength=((BYTE)szc[2])-5;
+				szc+=5;
+				continue;
+			}
+			if(szc[2]==0) break; // corrupt descriptor, would never advance
+			nCharsLeft-=(int)(BYTE)szc[2];
+			szc+=(int)(BYTE)szc[2];
+		}
+
+		if(fSeen) { // szc is aligned to start of candidate extended name, nHitLength is length of that name
+			int n=0, n1=0;
+			bool fGood=true;
+
+			while(n<nHitLength) {
+				if(szcName[n1]=='\0') { fGood=false; n=nHitLength; }
+				if(szc[n++]!=szcName[n1++]) { fGood=false; n=nHitLength; }
+			}
+
+			if(fGood) if(szcName[n1]!='\0') fGood=false;
+
+			return fGood;
+		}
+	}
+
+	return false;
+}
+
+// fills pisf with the extent list of the file whose first record is at dwPos
+// multi-extent files have the 0x80 flag on every record but the last
+
+static void BootIso9660CollectExtents(BYTE * ba, DWORD dwPos, DWORD dwBytesToScan, ISO_FILE * pisf)
+{
+	ISO_SYSTEM_DIRECTORY_RECORD * pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)&ba[dwPos];
+
+	pisf->m_isdr = *pisdr;
+	pisf->m_dwLength=0;
+	pisf->m_nExtents=0;
+
+	while(pisf->m_nExtents<ISO9660_MAX_EXTENTS) {
+		pisf->m_adwExtentLocation[pisf->m_nExtents]=pisdr->m_dwrExtentLocation.m_dwLittleEndian;
+		pisf->m_adwExtentLength[pisf->m_nExtents]=pisdr->m_dwrDataLength.m_dwLittleEndian;
+		pisf->m_dwLength+=pisdr->m_dwrDataLength.m_dwLittleEndian;
+		pisf->m_nExtents++;
+
+		if((pisdr->m_bFileFlags & 0x80)==0) return; // that was the last extent
+
+		dwPos+=pisdr->m_bLength;
+		if((dwPos<dwBytesToScan) && (ba[dwPos]==0)) dwPos=(dwPos+2048)&~2047;
+		if(dwPos>=dwBytesToScan) return;
+		pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)&ba[dwPos];
+	}
+
+	printk("ISO9660: file has more than %d extents, truncated\n", ISO9660_MAX_EXTENTS);
+}
+
+// this is a helper function for BootIso9660GetFileDetails() below
+// looks for each of the nNames names in apszcNames in a single pass over the directory
+// at dwSector.  On a hit pisfForFile gets the file whose name comes first in
+// apszcNames and *pnIndex that name's index
+// returns zero if error or not found, 1 if file, 2 if directory
+
+int BootIso9660GoDownOneLevelOrHitFirstOf(int driveId, DWORD dwSector, DWORD dwBytesToScan, const char * const * apszcNames, int nNames, int * pnIndex, ISO_FILE * pisfForFile)
+{
+	BYTE *ba;
+	DWORD dwPos=0, dwPosBest=0;
+	int nBest=nNames;
+
+	//printk("BootIso9660GoDownOneLevelOrHitFirstOf(0x%x, 0x%x, %s ...)\n", dwSector, dwBytesToScan, apszcNames[0]);
+
 	// root sector has a single struct pointing to root dir
 
-	if((dwSector-1)==ROOT_SECTOR) {
-		pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)&ba[ROOT_DIR_STRUCT_OFFSET];
-		*pisdrForFile = *pisdr;
-		//printk("We Return 2\n");
-		free(ba);
+	if(dwSector==ROOT_SECTOR) {
+		ba=BootIso9660GetDirectoryExtent(driveId, ROOT_SECTOR, 0x800);
+		if(ba==NULL) return 0;
+		BootIso9660CollectExtents(ba, ROOT_DIR_STRUCT_OFFSET, 0x800, pisfForFile);
+		if(pnIndex!=NULL) *pnIndex=0;
 		return 2;
 	}
 
+	ba=BootIso9660GetDirectoryExtent(driveId, dwSector, dwBytesToScan);
+	if(ba==NULL) return 0;
+
 	// otherwise we are looking at a number of back-to-back structs
 	// each talking about a file
 
-	nPos=0;
-
-	while((((BYTE *)pisdr)-&ba[0])<dwTotalLength) 
-	{  
-		// while we haven't gone off the end the dir structs
-
-		char *szc = (char *)(&pisdr->m_cFirstFileIdPlaceholder);
-			// compute what's left after total struct size and 8.3 name
-		int nCharsLeft=pisdr->m_bLength - ((szc-((char *)pisdr))  );
-
-		// check mangled 8.3 version
-                
-                #if 0
-			// This prints out the Directory Listing
-		{ 
-			int n=0; 
-			for(n=0;n<pisdr->m_bFileIdentifierLength;n++) 
-			{ 
-				printk("%c", szc[n]); 
-			} printk("\n"); 
+	while((dwPos<dwBytesToScan) && (nBest!=0)) {
+		ISO_SYSTEM_DIRECTORY_RECORD * pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)&ba[dwPos];
+		int n;
+
+		// records never straddle a sector, the rest of the sector is zero padded
+
+		if(pisdr->m_bLength==0) {
+			dwPos=(dwPos+2048)&~2047;
+			continue;
+		}
+
+		if(pisdr->m_bFileIdentifierLength==0) { // uh oh
+//			printk("returning, zero length identifier seen\n");
+			break;
 		}
-                #endif
-                
-		 {
-
-			int n=0;
-			while((n<strlen(szcName)) && (szc[n]==szcName[n]) && (szc[n]!=';')) n++;
-
-			if((n==strlen(szcName)) && (szc[n]==';')) 
-			{
-
-				*pisdrForFile = *pisdr; // copy over results
-				if ((pisdr->m_bFileFlags & 2)==2) 
-				{
-//						printk("returning dir hit\n");
-					free(ba);
-					return 2; // its a hit: its a directory
-				}
-//					printk("returning file hit\n");
-				free(ba);
-				return 1; // its a hit: its a file
+
+		for(n=0;n<nBest;n++) {
+			if(BootIso9660RecordMatches(pisdr, apszcNames[n])) {
+				nBest=n;
+				dwPosBest=dwPos;
 			}
 		}
 
-		nCharsLeft-=pisdr->m_bFileIdentifierLength;
-		szc+=pisdr->m_bFileIdentifierLength; // skip over the horrible mangled 8.3 version
+		dwPos+=pisdr->m_bLength;
+	} // while there are more dir structs
 
-//		 VideoDumpAddressAndData((DWORD)pisdr, (BYTE *)szc-0x10, 0x20);
+	if(nBest==nNames) return 0;
 
-//		printk("pisdr->m_bFileIdentifierLength=%d\n", pisdr->m_bFileIdentifierLength);
-		if(pisdr->m_bFileIdentifierLength==0) { // uh oh
-//				printk("returning, zero length identifier seen\n");
-				free(ba);
-				return 0;
+	BootIso9660CollectExtents(ba, dwPosBest, dwBytesToScan, pisfForFile); // copy over results
+	if(pnIndex!=NULL) *pnIndex=nBest;
+	if ((pisfForFile->m_isdr.m_bFileFlags & 2)==2) return 2; // its a hit: its a directory
+	return 1; // its a hit: its a file
+}
+
+// returns zero if error, 1 if file, 2 if directory
+
+int BootIso9660GoDownOneLevelOrHit(int driveId, DWORD dwSector, DWORD dwBytesToScan, const char * szcName, ISO_SYSTEM_DIRECTORY_RECORD * pisdrForFile)
+{
+	ISO_FILE isf;
+	int nReturn=BootIso9660GoDownOneLevelOrHitFirstOf(driveId, dwSector, dwBytesToScan, &szcName, 1, NULL, &isf);
+
+	if(nReturn) *pisdrForFile = isf.m_isdr;
+	return nReturn;
+}
+
+// walks the directories named by the first nLength characters of szcPath
+// (which must start with '/') and leaves the record of the last one in pisdr
+// return 0 if found, otherwise an error index
+
+static int BootIso9660GetDirectoryDetails(int driveId, const char * szcPath, int nLength, ISO_SYSTEM_DIRECTORY_RECORD * pisdr)
+{
+	char szPathElement[MAX_PATH_ELEMENT_SIZE];
+	int n=1;
+
+	if(BootIso9660GoDownOneLevelOrHit(driveId, ROOT_SECTOR, 0x800, "", pisdr)!=2) return -4;
+
+	while(n<nLength) {
+		int nElement=0;
+
+		while((n<nLength) && (szcPath[n]!='/')) {
+			if(nElement==(sizeof(szPathElement)-1)) return -1; // avoid buffer overflow, path element too long
+			szPathElement[nElement++]=szcPath[n++];
 		}
-		if(*szc=='\0') szc++;  // 00 separator on some, not on others.  Can never be 00 by accident
+		szPathElement[nElement]='\0';
+		n++; // move past the '/'
 
-			// structure of extended names seems to be two char extension descriptor, eg, RR
-			// followed by byte length count of extension including descriptor chars
-			// then for all descriptors an LH format version word
-			// for the name that we want the extension descriptor is NM (name?)
+		if(nElement==0) continue;
 
-			// first we iterate through the descriptors looking for NM
+		if(BootIso9660GoDownOneLevelOrHit(driveId,
+			pisdr->m_dwrExtentLocation.m_dwLittleEndian,
+			pisdr->m_dwrDataLength.m_dwLittleEndian,
+			szPathElement,
+			pisdr
+		)!=2) return -4; // unable to find path element
+	}
+	return 0;
+}
 
-		{
-			bool fSeen=false;
-			int nHitLength=0;
+// like BootIso9660GetFileDetails() but takes a NULL terminated list of candidate
+// paths and fills pisf for the first one in the list that exists, setting
+// *pnIndex to its index.  When the candidates all live in the same directory
+// that directory is scanned once for all of them
+// return 0 if found, otherwise an error index
 
-			while((nCharsLeft>1) && (!fSeen)) {
+int BootIso9660GetFileDetailsFirstOf(int driveId, const char * const * apszcPaths, int * pnIndex, ISO_FILE * pisf)
+{
+	const char * apszcNames[ISO9660_MAX_CANDIDATES];
+	ISO_SYSTEM_DIRECTORY_RECORD isdrDir;
+	int nDirLength=-1, nNames=0, nIndex, nReturn;
+	bool fSameDir=true;
 
-				if((*szc=='N') && (szc[1]=='M')) {
-					fSeen=true;
-					nHitLength=((BYTE)szc[2])-5;
-					szc+=5;
-					continue;
-				}
-				nCharsLeft-=szc[2];
-				szc+=(int)(BYTE)szc[2];
-			}
+	while(apszcPaths[nNames]!=NULL) {
+		const char * szc=apszcPaths[nNames];
+		int n, nLastSlash=-1;
+
+		if(*szc!='/') return -2; // no relative paths
+		for(n=0;szc[n];n++) if(szc[n]=='/') nLastSlash=n;
+		if(szc[nLastSlash+1]=='\0') return -2; // that's a directory
+
+		if(nNames==0) nDirLength=nLastSlash;
+		if((nLastSlash!=nDirLength) || memcmp(szc, apszcPaths[0], nDirLength)) fSameDir=false;
+		if(nNames==ISO9660_MAX_CANDIDATES) fSameDir=false;
+
+		if(fSameDir) apszcNames[nNames]=&szc[nLastSlash+1];
+		nNames++;
+	}
 
-			if(fSeen) { // szc is aligned to start of candidate extended name, nHitLength is length of that name
-				int n=0, n1=0;
-				bool fGood=true;
-
-				while(n<nHitLength) {
-					if(szcName[n1]=='\0') { fGood=false; n=nHitLength; }
-					if(szc[n++]!=szcName[n1++]) { fGood=false; n=nHitLength; }
-				}
-
-				if(fGood) if(szcName[n1]!='\0') fGood=false;
-
-				if(fGood) {
-					*pisdrForFile = *pisdr; // copy over results
-					if ((pisdr->m_bFileFlags & 2)==2) 
-					{
-//						printk("returning dir hit\n");
-						free(ba);
-						return 2; // its a hit: its a directory
-					}
-//					printk("returning file hit\n");
-					free(ba);
-					return 1; // its a hit: its a file
-				} // if fGood
-			} // if fSeen
+	if(nNames==0) return -4;
+
+	if(!fSameDir) { // no shared directory, look them up one by one
+		int n;
+		for(n=0;n<nNames;n++) {
+			const char * apszcOne[2];
+			apszcOne[0]=apszcPaths[n];
+			apszcOne[1]=NULL;
+			if(BootIso9660GetFileDetailsFirstOf(driveId, apszcOne, NULL, pisf)==0) {
+				if(pnIndex!=NULL) *pnIndex=n;
+				return 0;
+			}
 		}
+		return -4;
+	}
 
-		pisdr=(ISO_SYSTEM_DIRECTORY_RECORD *)(((BYTE *)pisdr)+pisdr->m_bLength);
-	} // while there are more dir structs
+	nReturn=BootIso9660GetDirectoryDetails(driveId, apszcPaths[0], nDirLength, &isdrDir);
+	if(nReturn) return nReturn;
 
-//	printk("returning fail\n");
-	free(ba);
+	nReturn=BootIso9660GoDownOneLevelOrHitFirstOf(driveId,
+		isdrDir.m_dwrExtentLocation.m_dwLittleEndian,
+		isdrDir.m_dwrDataLength.m_dwLittleEndian,
+		apszcNames, nNames, &nIndex, pisf
+	);
+	if(nReturn==0) return -4; // unable to find path element
+	if(nReturn==2) return -2; // it's a directory
+
+	if(pnIndex!=NULL) *pnIndex=nIndex;
 	return 0;
 }
 
 // this guy fills pisdr with details on the file location and attributes if the file can be found
+// for a multi-extent file it describes the first extent only
 // note that you must use 8.3 names, the lowest common denominator
 // return 0 if found, otherwise an error index
 
 int BootIso9660GetFileDetails(int driveId, const char * szcPath, ISO_SYSTEM_DIRECTORY_RECORD * pisdr)
 {
-	char szPathElement[MAX_PATH_ELEMENT_SIZE];
-	const char * szc=&szcPath[0];
-	int n=0, nReturn;
-	bool fMore=true;
-
-	memset(&szPathElement,0x00,sizeof(szPathElement));
-	
-	if(*szcPath!='/') return -2; // no relative paths
-
-	while(fMore) {
-		if((*szc=='/') || (*szc=='\0')) {
-			if(*szc) {
-				szc++; // move past it
-			} else {
-				fMore=false;
-			}
-			szPathElement[n]='\0';
-			if(n==0) {
-				nReturn=BootIso9660GoDownOneLevelOrHit(driveId, ROOT_SECTOR, 0x800, szPathElement, pisdr);
-			} else {
-				nReturn=BootIso9660GoDownOneLevelOrHit(driveId,
-					pisdr->m_dwrExtentLocation.m_dwLittleEndian,
-					pisdr->m_dwrDataLength.m_dwLittleEndian,
-					szPathElement,
-					pisdr
-				);
-			}
-			if(nReturn==0) return -4; // unable to find path element
-			if(nReturn==1) { // found file
-				return 0;
-			}
-			n=0;
-		}
-		szPathElement[n++]=*szc++;
+	const char * apszcPaths[2];
+	ISO_FILE isf;
+	int nReturn;
+
+	apszcPaths[0]=szcPath;
+	apszcPaths[1]=NULL;
+	nReturn=BootIso9660GetFileDetailsFirstOf(driveId, apszcPaths, NULL, &isf);
+	if(nReturn==0) *pisdr = isf.m_isdr;
+	return nReturn;
+}
+
+// reads dwLength bytes starting dwOffset bytes into the extent at dwSector
+// whole blocks go straight into pbaFile, only a partial first or last block
+// goes through the bounce buffer
+
+static int BootIso9660ReadExtent(int driveId, DWORD dwSector, DWORD dwOffset, BYTE *pbaFile, DWORD dwLength)
+{
+	BYTE ba[2048];
+	DWORD dwBlocks;
 
-		if(n==sizeof(szPathElement)) return -1; // avoid buffer overflow, path element too long
+	dwSector+=dwOffset / 2048;
+	dwOffset=dwOffset % 2048;
+
+	if(dwOffset) {
+		DWORD dwLengthThisTime=2048-dwOffset;
+		if(dwLengthThisTime>dwLength) dwLengthThisTime=dwLength;
+		if(BootIdeAtapiReadBlocks(driveId, &ba[0], dwSector, 1)) return 1;
+		memcpy(pbaFile, &ba[dwOffset], dwLengthThisTime);
+		dwSector++;
+		pbaFile+=dwLengthThisTime;
+		dwLength-=dwLengthThisTime;
 	}
-	return -2;
+
+	dwBlocks=dwLength / 2048;
+	if(dwBlocks) {
+		if(BootIdeAtapiReadBlocks(driveId, pbaFile, dwSector, dwBlocks)) return 1;
+		dwSector+=dwBlocks;
+		pbaFile+=dwBlocks*2048;
+		dwLength-=dwBlocks*2048;
+	}
+
+	if(dwLength) {
+		if(BootIdeAtapiReadBlocks(driveId, &ba[0], dwSector, 1)) return 1;
+		memcpy(pbaFile, &ba[0], dwLength);
+	}
+
+	return 0;
 }
 
+// reads up to dwFileLengthMax bytes from dwOffset into the file described by pisf
+// returns the number of bytes read, or a negative error index
 
-int BootIso9660GetFile(int driveId, const char *szcPath, BYTE *pbaFile, DWORD dwFileLengthMax, DWORD dwOffset)
+int BootIso9660ReadFile(int driveId, ISO_FILE * pisf, BYTE *pbaFile, DWORD dwFileLengthMax, DWORD dwOffset)
 {
-	ISO_SYSTEM_DIRECTORY_RECORD isdr;
-	int nReturn=BootIso9660GetFileDetails(driveId,szcPath, &isdr);
-	DWORD dwSector;
 	DWORD dwFileLengthTaken;
+	int n;
 
-	if(nReturn) return nReturn;
+	if(dwOffset>=pisf->m_dwLength) return 0;
 
-	dwSector=isdr.m_dwrExtentLocation.m_dwLittleEndian + (dwOffset / 2048);
-	dwOffset=dwOffset % 2048;
-	if(dwFileLengthMax > isdr.m_dwrDataLength.m_dwLittleEndian) {
+	if(dwFileLengthMax > (pisf->m_dwLength-dwOffset)) {
 
-		dwFileLengthMax=isdr.m_dwrDataLength.m_dwLittleEndian;
+		dwFileLengthMax=pisf->m_dwLength-dwOffset;
 	}
 	dwFileLengthTaken=dwFileLengthMax;
 
-//	printk("File length used = 0x%x, 0x%x\n", (int)dwFileLengthMax, (int)isdr.m_dwrDataLength.m_dwLittleEndian);
+//	printk("File length used = 0x%x, 0x%x\n", (int)dwFileLengthMax, (int)pisf->m_dwLength);
 
-	while(dwFileLengthMax) {
-		DWORD dwLengthThisTime=2048;
-		if(dwLengthThisTime >dwFileLengthMax) dwLengthThisTime=dwFileLengthMax;
+	for(n=0;(n<pisf->m_nExtents) && dwFileLengthMax;n++) {
+		DWORD dwLengthThisTime;
 
-		if(dwOffset || (dwLengthThisTime<2048)) {
-			BYTE ba[2048];
-			dwLengthThisTime-=dwOffset;
-			if(BootIdeReadSector(driveId, &ba[0], dwSector, 0, 2048)) return -6;
-			memcpy(pbaFile, &ba[dwOffset], dwLengthThisTime);
-			dwOffset=0;
-		} else {
-			if(BootIdeReadSector(driveId, pbaFile, dwSector, 0, 2048)) return -6;
+		if(dwOffset>=pisf->m_adwExtentLength[n]) {
+			dwOffset-=pisf->m_adwExtentLength[n];
+			continue;
 		}
-		dwSector++;
+
+		dwLengthThisTime=pisf->m_adwExtentLength[n]-dwOffset;
+		if(dwLengthThisTime >dwFileLengthMax) dwLengthThisTime=dwFileLengthMax;
+
+		if(BootIso9660ReadExtent(driveId, pisf->m_adwExtentLocation[n], dwOffset, pbaFile, dwLengthThisTime)) return -6;
+
+		dwOffset=0;
 		dwFileLengthMax-=dwLengthThisTime;
 		pbaFile+=dwLengthThisTime;
 	}
 	return (int)dwFileLengthTaken;
 }
+
+int BootIso9660GetFile(int driveId, const char *szcPath, BYTE *pbaFile, DWORD dwFileLengthMax, DWORD dwOffset)
+{
+	const char * apszcPaths[2];
+	ISO_FILE isf;
+	int nReturn;
+
+	apszcPaths[0]=szcPath;
+	apszcPaths[1]=NULL;
+	nReturn=BootIso9660GetFileDetailsFirstOf(driveId, apszcPaths, NULL, &isf);
+	if(nReturn) return nReturn;
+
+	return BootIso9660ReadFile(driveId, &isf, pbaFile, dwFileLengthMax, dwOffset);
+}
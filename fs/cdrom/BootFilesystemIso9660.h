@@ -57,6 +57,16 @@ typedef struct {
 
 } __attribute__ ((packed)) ISO_PRIMARY_VOLUME_DESCRIPTOR;
 
+#define ISO9660_MAX_EXTENTS 8
+
+typedef struct {  // a file with all of its extents
+	ISO_SYSTEM_DIRECTORY_RECORD m_isdr; // record of the first extent
+	DWORD m_dwLength; // total over all extents
+	int m_nExtents; // more than one if the file was recorded multi-extent
+	DWORD m_adwExtentLocation[ISO9660_MAX_EXTENTS];
+	DWORD m_adwExtentLength[ISO9660_MAX_EXTENTS];
+} ISO_FILE;
+
 
 // observed structure on Madrake 9 install CD:
 
@@ -74,10 +84,14 @@ typedef struct {
 #define ROOT_SECTOR 0x10
 #define ROOT_DIR_STRUCT_OFFSET 0x9c
 #define MAX_PATH_ELEMENT_SIZE 256
+#define ISO9660_MAX_CANDIDATES 16 // names BootIso9660GetFileDetailsFirstOf() checks in one pass
 
 
 void BootIso9660DescriptorToString(const char * szcDescriptor, int nLength, char * szStringResult);
 int BootIso9660GetFile(int driveId, const char *szcPath, BYTE *pbaFile, DWORD dwFileLengthMax, DWORD dwOffset);
 int BootIso9660GetFileDetails(int driveId, const char * szcPath, ISO_SYSTEM_DIRECTORY_RECORD * pisdr);
+int BootIso9660GetFileDetailsFirstOf(int driveId, const char * const * apszcPaths, int * pnIndex, ISO_FILE * pisf);
+int BootIso9660ReadFile(int driveId, ISO_FILE * pisf, BYTE *pbaFile, DWORD dwFileLengthMax, DWORD dwOffset);
+void BootIso9660InvalidateCache(void);
 
 #endif //       _BootISO9660_H_
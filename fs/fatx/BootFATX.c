@@ -99,7 +99,7 @@ int FATXFindDir(FATXPartition *partition, int clusterId, char *dir){
 
 			// first of all, check that it isn't an end of directory marker
 			if (checkForLastDirectoryEntry(curEntry)) {
-				return;
+				return -1;
 			}
 
 			// get the filename size
@@ -140,6 +140,7 @@ int FATXFindDir(FATXPartition *partition, int clusterId, char *dir){
 		clusterId = getNextClusterInChain(partition, clusterId);
 	}
 
+	return -1;
 }
 
 
@@ -249,9 +250,66 @@ int FATXSignature(int nDriveIndex,unsigned int block,BYTE *ba) {
 	}
 }
 
+// Partitions stay mounted here until FATXInvalidatePartitions is called for
+// their drive, so reopening one costs neither the header nor the chain map read.
+// Writes made through fs/fatx update the mounted copy and keep it valid.
+#define FATX_MAX_MOUNTED_PARTITIONS 5
+
+static FATXPartition *mountedPartitions[FATX_MAX_MOUNTED_PARTITIONS];
+
+static FATXPartition *_OpenFATXPartition(int nDriveIndex,
+		unsigned int partitionOffset,
+		u_int64_t partitionSize);
+
 FATXPartition *OpenFATXPartition(int nDriveIndex,
 		unsigned int partitionOffset,
 		u_int64_t partitionSize) {
+	FATXPartition *partition;
+	int i;
+
+	for (i = 0; i < FATX_MAX_MOUNTED_PARTITIONS; i++) {
+		partition = mountedPartitions[i];
+		if (partition != NULL &&
+		    partition->nDriveIndex == nDriveIndex &&
+		    partition->partitionStart == partitionOffset &&
+		    partition->partitionSize == partitionSize) {
+			return partition;
+		}
+	}
+
+	partition = _OpenFATXPartition(nDriveIndex, partitionOffset, partitionSize);
+	if (partition == NULL) {
+		return NULL;
+	}
+
+	// if the table is full the partition is simply not cached, and freed on close
+	for (i = 0; i < FATX_MAX_MOUNTED_PARTITIONS; i++) {
+		if (mountedPartitions[i] == NULL) {
+			mountedPartitions[i] = partition;
+			break;
+		}
+	}
+
+	return partition;
+}
+
+void FATXInvalidatePartitions(int nDriveIndex) {
+	FATXPartition *partition;
+	int i;
+
+	for (i = 0; i < FATX_MAX_MOUNTED_PARTITIONS; i++) {
+		partition = mountedPartitions[i];
+		if (partition != NULL && partition->nDriveIndex == nDriveIndex) {
+			mountedPartitions[i] = NULL;
+			free(partition->clusterChainMap.words);
+			free(partition);
+		}
+	}
+}
+
+static FATXPartition *_OpenFATXPartition(int nDriveIndex,
+		unsigned int partitionOffset,
+		u_int64_t partitionSize) {
 	unsigned char partitionInfo[FATX_PARTITION_HEADERSIZE];
 	FATXPartition *partition;
 	int readSize;
@@ -323,6 +381,7 @@ FATXPartition *OpenFATXPartition(int nDriveIndex,
 #ifdef FATX_INFO
 		printk("OpenFATXPartition : Out of memory\n");
 #endif
+		free(partition);
 		return NULL;
 	}
 
@@ -342,7 +401,14 @@ FATXPartition *OpenFATXPartition(int nDriveIndex,
 #ifdef FATX_INFO
 		printk("Out of data while reading cluster chain map table\n");
 #endif
+		// a half loaded chain map must never be cached or written back
+		free(partition->clusterChainMap.words);
+		free(partition);
+		return NULL;
 	}
+	partition->chainTableSize = chainTableSize;
+	partition->chainMapDirtyFirst = 0xffffffff;
+	partition->chainMapDirtyLast = 0;
 	partition->cluster1Address = ( ( FATX_PARTITION_HEADERSIZE + chainTableSize) );
 
 	return partition;
@@ -742,46 +808,432 @@ void LoadFATXCluster(FATXPartition* partition, int clusterId, unsigned char* clu
 
 int FATXRawRead(int drive, int sector, unsigned long long byte_offset, int byte_len, char *buf) {
 
+	BYTE ba[512];
 	int byte_read;
+	int nThisTime;
+	int nSectors;
 	
 	byte_read = 0;
 
 //	printk("rawread: sector=0x%X, byte_offset=0x%X, len=%d\n", sector, byte_offset, byte_len);
 
-        sector+=byte_offset/512;
-        byte_offset%=512;
+	sector+=byte_offset/512;
+	byte_offset%=512;
 
-        while(byte_len) {
-		int nThisTime=512;
-		if(byte_len<512) nThisTime=byte_len;
-                if(byte_offset) {
-	                BYTE ba[512];
-			if(BootIdeReadSector(drive, buf, sector, 0, 512)) {
-				VIDEO_ATTR=0xffe8e8e8;
-				printk("Unable to get first sector\n");
-                                return false;
-			}
-			memcpy(buf, &ba[byte_offset], nThisTime-byte_offset);
-			buf+=nThisTime-byte_offset;
-			byte_len-=nThisTime-byte_offset;
-			byte_read += nThisTime-byte_offset;
-			byte_offset=0;
+	// unaligned head goes through the bounce sector
+	if(byte_len && byte_offset) {
+		nThisTime = 512 - byte_offset;
+		if(byte_len < nThisTime) nThisTime = byte_len;
+		if(BootIdeReadSector(drive, ba, sector, 0, 512)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("Unable to get first sector\n");
+			return false;
+		}
+		memcpy(buf, &ba[byte_offset], nThisTime);
+		buf+=nThisTime;
+		byte_len-=nThisTime;
+		byte_read+=nThisTime;
+		sector++;
+	}
+
+	// aligned middle lands directly in the caller's buffer
+	nSectors = byte_len / 512;
+	if(nSectors) {
+		if(BootIdeReadSectors(drive, buf, sector, nSectors)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("Unable to get sectors %d-%d\n", sector, sector + nSectors - 1);
+			return false;
+		}
+		buf+=nSectors * 512;
+		byte_len-=nSectors * 512;
+		byte_read+=nSectors * 512;
+		sector+=nSectors;
+	}
+
+	// partial tail, again through the bounce sector
+	if(byte_len) {
+		if(BootIdeReadSector(drive, ba, sector, 0, 512)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("Unable to get last sector\n");
+			return false;
+		}
+		memcpy(buf, ba, byte_len);
+		byte_read+=byte_len;
+	}
+
+	return byte_read;
+}
+
+int FATXRawWrite(int drive, int sector, unsigned long long byte_offset, int byte_len, char *buf) {
+
+	BYTE ba[512];
+	int byte_written;
+	int nThisTime;
+	int nSectors;
+
+	byte_written = 0;
+
+	sector+=byte_offset/512;
+	byte_offset%=512;
+
+	// partial first sector: read, patch and write it back
+	if(byte_len && byte_offset) {
+		nThisTime = 512 - byte_offset;
+		if(byte_len < nThisTime) nThisTime = byte_len;
+		if(BootIdeReadSector(drive, ba, sector, 0, 512)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("FATXRawWrite : Unable to read sector %d\n", sector);
+			return false;
+		}
+		memcpy(&ba[byte_offset], buf, nThisTime);
+		if(BootIdeWriteSectors(drive, ba, sector, 1)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("FATXRawWrite : Unable to write sector %d\n", sector);
+			return false;
+		}
+		buf+=nThisTime;
+		byte_len-=nThisTime;
+		byte_written+=nThisTime;
+		sector++;
+	}
+
+	// whole sectors go out in as few commands as possible
+	nSectors = byte_len / 512;
+	if(nSectors) {
+		if(BootIdeWriteSectors(drive, buf, sector, nSectors)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("FATXRawWrite : Unable to write sectors %d-%d\n", sector, sector + nSectors - 1);
+			return false;
+		}
+		buf+=nSectors * 512;
+		byte_len-=nSectors * 512;
+		byte_written+=nSectors * 512;
+		sector+=nSectors;
+	}
+
+	// partial last sector
+	if(byte_len) {
+		if(BootIdeReadSector(drive, ba, sector, 0, 512)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("FATXRawWrite : Unable to read sector %d\n", sector);
+			return false;
+		}
+		memcpy(ba, buf, byte_len);
+		if(BootIdeWriteSectors(drive, ba, sector, 1)) {
+			VIDEO_ATTR=0xffe8e8e8;
+			printk("FATXRawWrite : Unable to write sector %d\n", sector);
+			return false;
+		}
+		byte_written+=byte_len;
+	}
+
+	return byte_written;
+}
+
+static u_int32_t getChainMapEntry(FATXPartition* partition, u_int32_t clusterId) {
+	if (partition->chainMapEntrySize == 2) {
+		return partition->clusterChainMap.words[clusterId];
+	}
+	return partition->clusterChainMap.dwords[clusterId];
+}
+
+static void setChainMapEntry(FATXPartition* partition, u_int32_t clusterId, u_int32_t value) {
+	if (partition->chainMapEntrySize == 2) {
+		partition->clusterChainMap.words[clusterId] = value;
+	} else {
+		partition->clusterChainMap.dwords[clusterId] = value;
+	}
+
+	// remember what has to go back to disk
+	if (clusterId < partition->chainMapDirtyFirst) {
+		partition->chainMapDirtyFirst = clusterId;
+	}
+	if (clusterId > partition->chainMapDirtyLast) {
+		partition->chainMapDirtyLast = clusterId;
+	}
+}
+
+int FATXAllocateClusterChain(FATXPartition* partition, int nClusters) {
+	u_int32_t eocMarker;
+	u_int32_t maxCluster;
+	u_int32_t clusterId;
+	u_int32_t firstCluster = 0;
+	u_int32_t lastCluster = 0;
+	int nFound = 0;
+
+	eocMarker = (partition->chainMapEntrySize == 2) ? 0xffff : 0xffffffff;
+
+	// highest cluster that still lies inside the partition; clusters are
+	// always 0x4000 bytes (see _OpenFATXPartition), and a 64 bit division
+	// by a variable would need libgcc's __udivdi3
+	maxCluster = (u_int32_t)((partition->partitionSize - partition->cluster1Address) >> 14);
+	if (maxCluster >= partition->clusterCount) {
+		maxCluster = partition->clusterCount - 1;
+	}
+
+	// first fit, which keeps the chain contiguous on an unfragmented disk
+	for (clusterId = FATX_ROOT_FAT_CLUSTER + 1; clusterId <= maxCluster && nFound < nClusters; clusterId++) {
+		if (getChainMapEntry(partition, clusterId) != FATX_CLUSTER_FREE) {
+			continue;
+		}
+		if (nFound == 0) {
+			firstCluster = clusterId;
 		} else {
-			if(BootIdeReadSector(drive, buf, sector, 0, nThisTime)) {
-				VIDEO_ATTR=0xffe8e8e8;
-				printk("Unable to get first sector\n");
+			setChainMapEntry(partition, lastCluster, clusterId);
+		}
+		setChainMapEntry(partition, clusterId, eocMarker);
+		lastCluster = clusterId;
+		nFound++;
+	}
+
+	if (nFound < nClusters) {
+		// not enough room, hand back what we took
+		clusterId = firstCluster;
+		while (nFound--) {
+			u_int32_t nextCluster = getChainMapEntry(partition, clusterId);
+			setChainMapEntry(partition, clusterId, FATX_CLUSTER_FREE);
+			clusterId = nextCluster;
+		}
+#ifdef FATX_INFO
+		printk("FATXAllocateClusterChain : Partition full\n");
+#endif
+		return -1;
+	}
+
+	return firstCluster;
+}
+
+int FATXFlushChainMap(FATXPartition* partition) {
+	u_int32_t first;
+	u_int32_t last;
+	int len;
+
+	if (partition->chainMapDirtyFirst > partition->chainMapDirtyLast) {
+		return true;
+	}
+
+	// write back the whole sectors that hold the changed entries
+	first = (partition->chainMapDirtyFirst * partition->chainMapEntrySize) & ~511;
+	last = ((partition->chainMapDirtyLast + 1) * partition->chainMapEntrySize + 511) & ~511;
+	len = last - first;
+
+	if (FATXRawWrite(partition->nDriveIndex, partition->partitionStart,
+			FATX_PARTITION_HEADERSIZE + first, len,
+			((char *)partition->clusterChainMap.words) + first) != len) {
+		return false;
+	}
+
+	partition->chainMapDirtyFirst = 0xffffffff;
+	partition->chainMapDirtyLast = 0;
+	return true;
+}
+
+static int FATXWriteCluster(FATXPartition* partition, int clusterId, unsigned int offset, int len, unsigned char* data) {
+	u_int64_t clusterAddress;
+
+	clusterAddress = partition->cluster1Address + ((unsigned long long)(clusterId - 1) * partition->clusterSize);
+
+	return FATXRawWrite(partition->nDriveIndex, partition->partitionStart,
+			clusterAddress + offset, len, (char *)data) == len;
+}
+
+static void FATXTimeStamp(u_int16_t *time, u_int16_t *date) {
+	BYTE bSec, bMin, bHour, bDay, bMonth, bYear;
+
+	// the MCPX carries a PC compatible RTC
+	IoOutputByte(0x70, 0x00); bSec = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x02); bMin = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x04); bHour = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x07); bDay = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x08); bMonth = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x09); bYear = IoInputByte(0x71);
+	IoOutputByte(0x70, 0x0b);
+	if (!(IoInputByte(0x71) & 0x04)) {
+		// BCD mode
+		bSec = (bSec >> 4) * 10 + (bSec & 0x0f);
+		bMin = (bMin >> 4) * 10 + (bMin & 0x0f);
+		bHour = (bHour >> 4) * 10 + (bHour & 0x0f);
+		bDay = (bDay >> 4) * 10 + (bDay & 0x0f);
+		bMonth = (bMonth >> 4) * 10 + (bMonth & 0x0f);
+		bYear = (bYear >> 4) * 10 + (bYear & 0x0f);
+	}
+
+	// FATX dates count years from 2000
+	*time = (bHour << 11) | (bMin << 5) | (bSec >> 1);
+	*date = (bYear << 9) | (bMonth << 5) | bDay;
+}
+
+int FATXAddDirectoryEntry(FATXPartition* partition, int dirClusterId, char *filename,
+		unsigned char flags, int entryClusterId, u_int32_t fileSize) {
+	unsigned char* curEntry;
+	unsigned char clusterData[partition->clusterSize];
+	int entriesPerCluster = partition->clusterSize / FATX_DIRECTORYENTRY_SIZE;
+	int clusterId = dirClusterId;
+	int lastClusterId = dirClusterId;
+	int filenameSize = strlen(filename);
+	int i;
+	int first;
+	int last;
+	u_int16_t time, date;
+
+	if ((filenameSize < 1) || (filenameSize > FATX_FILENAME_MAX)) {
+#ifdef FATX_INFO
+		printk("FATXAddDirectoryEntry : Bad filename %s\n", filename);
+#endif
+		return false;
+	}
+
+	// look for a deleted entry or the end of directory marker
+	curEntry = NULL;
+	while(clusterId != -1) {
+		LoadFATXCluster(partition, clusterId, clusterData);
+		for(i=0; i< entriesPerCluster; i++) {
+			if (clusterData[i * FATX_DIRECTORYENTRY_SIZE] == FATX_DIRECTORYENTRY_DELETED ||
+			    checkForLastDirectoryEntry(clusterData + (i * FATX_DIRECTORYENTRY_SIZE))) {
+				curEntry = clusterData + (i * FATX_DIRECTORYENTRY_SIZE);
+				break;
+			}
+		}
+		if (curEntry != NULL) {
+			break;
+		}
+		lastClusterId = clusterId;
+		clusterId = getNextClusterInChain(partition, clusterId);
+	}
+
+	if (curEntry == NULL) {
+		// directory is full, chain on a fresh cluster
+		clusterId = FATXAllocateClusterChain(partition, 1);
+		if (clusterId == -1) {
+			return false;
+		}
+		setChainMapEntry(partition, lastClusterId, clusterId);
+		memset(clusterData, 0xff, partition->clusterSize);
+		if (!FATXWriteCluster(partition, clusterId, 0, partition->clusterSize, clusterData) ||
+		    !FATXFlushChainMap(partition)) {
+			return false;
+		}
+		i = 0;
+		curEntry = clusterData;
+	}
+
+	// if we took the end marker, the following entry becomes the new one
+	last = i;
+	if (checkForLastDirectoryEntry(curEntry) && (i + 1) < entriesPerCluster) {
+		memset(curEntry + FATX_DIRECTORYENTRY_SIZE, 0xff, FATX_DIRECTORYENTRY_SIZE);
+		last = i + 1;
+	}
+
+	FATXTimeStamp(&time, &date);
+
+	memset(curEntry, 0xff, FATX_DIRECTORYENTRY_SIZE);
+	curEntry[0] = filenameSize;
+	curEntry[1] = flags;
+	memcpy(curEntry + 2, filename, filenameSize);
+	*((u_int32_t*) (curEntry + 0x2c)) = entryClusterId;
+	*((u_int32_t*) (curEntry + 0x30)) = fileSize;
+	*((u_int16_t*) (curEntry + 0x34)) = time;
+	*((u_int16_t*) (curEntry + 0x36)) = date;
+	*((u_int16_t*) (curEntry + 0x38)) = time;
+	*((u_int16_t*) (curEntry + 0x3a)) = date;
+	*((u_int16_t*) (curEntry + 0x3c)) = time;
+	*((u_int16_t*) (curEntry + 0x3e)) = date;
+
+	// only write back the sectors holding the touched entries
+	first = (i * FATX_DIRECTORYENTRY_SIZE) & ~511;
+	last = (((last + 1) * FATX_DIRECTORYENTRY_SIZE) + 511) & ~511;
+	return FATXWriteCluster(partition, clusterId, first, last - first, clusterData + first);
+}
+
+int FATXCreateDirectory(FATXPartition* partition, int parentClusterId, char *dirname) {
+	unsigned char clusterData[partition->clusterSize];
+	int clusterId;
+
+	clusterId = FATXAllocateClusterChain(partition, 1);
+	if (clusterId == -1) {
+		return -1;
+	}
+
+	// an empty directory is all end markers
+	memset(clusterData, 0xff, partition->clusterSize);
+	if (!FATXWriteCluster(partition, clusterId, 0, partition->clusterSize, clusterData) ||
+	    !FATXFlushChainMap(partition) ||
+	    !FATXAddDirectoryEntry(partition, parentClusterId, dirname, FATX_FILEATTR_DIRECTORY, clusterId, 0)) {
+		return -1;
+	}
+
+	BootIdeFlushCache(partition->nDriveIndex);
+	return clusterId;
+}
+
+int FATXWriteFile(FATXPartition* partition, int dirClusterId, char *filename, BYTE *data, u_int32_t fileSize) {
+	int firstCluster = 0;
+	int clusterId;
+	int nextClusterId;
+	int nClusters;
+	int runClusterId;
+	int runLength;
+	u_int32_t remaining;
+
+	nClusters = (fileSize + partition->clusterSize - 1) / partition->clusterSize;
+	if (nClusters) {
+		firstCluster = FATXAllocateClusterChain(partition, nClusters);
+		if (firstCluster == -1) {
+			return false;
+		}
+
+		// walk the chain, writing each run of adjacent clusters in one go
+		remaining = fileSize;
+		clusterId = firstCluster;
+		while (clusterId != -1 && remaining) {
+			runClusterId = clusterId;
+			runLength = 0;
+			do {
+				runLength++;
+				nextClusterId = getNextClusterInChain(partition, clusterId);
+				if (nextClusterId != clusterId + 1) {
+					break;
+				}
+				clusterId = nextClusterId;
+			} while (1);
+
+			if ((u_int32_t)(runLength * partition->clusterSize) > remaining) {
+				runLength = remaining;
+			} else {
+				runLength *= partition->clusterSize;
+			}
+			if (!FATXWriteCluster(partition, runClusterId, 0, runLength, data)) {
 				return false;
 			}
-			buf+=nThisTime;
-			byte_len-=nThisTime;
-			byte_read += nThisTime;
+			data += runLength;
+			remaining -= runLength;
+			clusterId = nextClusterId;
+		}
+
+		if (!FATXFlushChainMap(partition)) {
+			return false;
 		}
-		sector++;
 	}
-	return byte_read;
+
+	// the entry goes in last, so a failed write never leaves a file pointing at garbage
+	if (!FATXAddDirectoryEntry(partition, dirClusterId, filename, FATX_FILEATTR_ARCHIVE, firstCluster, fileSize)) {
+		return false;
+	}
+
+	BootIdeFlushCache(partition->nDriveIndex);
+	return true;
 }
 
 void CloseFATXPartition(FATXPartition* partition) {
+	int i;
+
+	// mounted partitions are only released by FATXInvalidatePartitions
+	for (i = 0; i < FATX_MAX_MOUNTED_PARTITIONS; i++) {
+		if (mountedPartitions[i] == partition) {
+			return;
+		}
+	}
+
 	if(partition != NULL) {
 		free(partition->clusterChainMap.words);
 		free(partition);
@@ -59,6 +59,12 @@
 // max filename size
 #define FATX_FILENAME_MAX 42
 
+// Filename length byte marking a deleted directory entry
+#define FATX_DIRECTORYENTRY_DELETED 0xE5
+
+// Cluster chain map value of an unallocated cluster
+#define FATX_CLUSTER_FREE 0
+
 // This structure describes a FATX partition
 typedef struct {
 
@@ -85,6 +91,13 @@ typedef struct {
     u_int32_t *dwords;
   } clusterChainMap;
   
+  // Size in bytes of the cluster chain map table, as stored on disk
+  u_int32_t chainTableSize;
+
+  // Range of chain map entries changed since the map was last written back
+  u_int32_t chainMapDirtyFirst;
+  u_int32_t chainMapDirtyLast;
+
   // Address of cluster 1
   u_int64_t cluster1Address;
   
@@ -110,8 +123,16 @@ void _DumpFATXTree(FATXPartition* partition, int clusterId, int nesting);
 void LoadFATXCluster(FATXPartition* partition, int clusterId, unsigned char* clusterData);
 u_int32_t getNextClusterInChain(FATXPartition* partition, int clusterId);
 void CloseFATXPartition(FATXPartition* partition);
+void FATXInvalidatePartitions(int nDriveIndex);
 int FATXFindFile(FATXPartition* partition,char* filename,int clusterId, FATXFILEINFO *fileinfo);
 int _FATXFindFile(FATXPartition* partition,char* filename,int clusterId, FATXFILEINFO *fileinfo);
 int FATXLoadFromDisk(FATXPartition* partition, FATXFILEINFO *fileinfo);
+int FATXRawWrite(int drive, int sector, unsigned long long byte_offset, int byte_len, char *buf);
+int FATXAllocateClusterChain(FATXPartition* partition, int nClusters);
+int FATXFlushChainMap(FATXPartition* partition);
+int FATXAddDirectoryEntry(FATXPartition* partition, int dirClusterId, char *filename,
+		unsigned char flags, int entryClusterId, u_int32_t fileSize);
+int FATXCreateDirectory(FATXPartition* partition, int parentClusterId, char *dirname);
+int FATXWriteFile(FATXPartition* partition, int dirClusterId, char *filename, BYTE *data, u_int32_t fileSize);
 
 #endif //	_BootFATX_H_
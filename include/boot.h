@@ -323,6 +323,10 @@ void I2CModifyBits(BYTE bAds, BYTE bReg, BYTE bData, BYTE bMask);
 extern tsHarddiskInfo tsaHarddiskInfo[];  // static struct stores data about attached drives
 int BootIdeInit(void);
 int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int byte_offset, int n_bytes);
+int BootIdeReadSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeAtapiReadBlocks(int nDriveIndex, void * pbBuffer, unsigned int block, int nBlocks);
+int BootIdeWriteSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeFlushCache(int nDriveIndex);
 int BootIdeBootSectorHddOrElTorito(int nDriveIndex, BYTE * pbaResult);
 int BootIdeAtapiAdditionalSenseCode(int nDrive, BYTE * pba, int nLengthMaxReturn);
 int BootIdeSetTransferMode(int nIndexDrive, int nMode);
@@ -330,6 +334,10 @@ int BootIdeWaitNotBusy(unsigned uIoBase);
 bool BootIdeAtapiReportFriendlyError(int nDriveIndex, char * szErrorReturn, int nMaxLengthError);
 void BootIdeAtapiPrintkFriendlyError(int nDriveIndex);
 
+///////// BootFATX.c
+
+void FATXInvalidatePartitions(int nDriveIndex);
+
 ///////// BootUSB.c
 
 void BootStopUSB(void);
@@ -50,6 +50,22 @@
 // uncomment to do Ethernet init
 //#define DO_ETHERNET 1
 
+// network setup used when no DHCP server answers within NET_DHCP_WAIT
+// seconds. These are only what a box without saved settings starts
+// with, both can be changed at run time with PUT /net.json
+#define NET_FALLBACK_IP		192,168,0,99
+#define NET_FALLBACK_MASK	255,255,255,0
+#define NET_FALLBACK_GW		192,168,0,1
+#define NET_DHCP_WAIT		5
+
+// boot script fetched over HTTP when DHCP hands out no http:// boot
+// file name, see lwip/httpboot.c. Addresses only, there is no DNS
+//#define NET_BOOT_URL		"http://192.168.0.1/xbox/boot.cfg"
+
+// status panel at the bottom of the screen while the network flasher
+// runs, comment out to leave the screen to printk alone
+#define NET_STATUS_PANEL	1
+
 #undef DEBUG_MODE
 //#define XPAD_VIBRA_STARTUP
 
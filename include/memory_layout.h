@@ -24,6 +24,11 @@
 
 #define STACK_TOP 0x03C00000
 
+/* BIOS images are loaded or uploaded here and flashed from in place,
+   FlashBios never boots a kernel so its area is free */
+#define FLASH_STAGING_START KERNEL_PM_CODE
+#define FLASH_STAGING_SIZE  0x00100000
+
 #define MAX_KERNEL_SIZE    (KERNEL_PM_CODE_END - KERNEL_PM_CODE)
 #define MEMORYMANAGERSIZE  (MEMORYMANAGEREND - MEMORYMANAGERSTART)
 #define MAX_INITRD_SIZE    (MAX_INITRD_END - INITRD_START)
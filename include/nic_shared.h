@@ -0,0 +1,33 @@
+#ifndef _NIC_SHARED_H_
+#define _NIC_SHARED_H_
+
+/*
+ * What the etherboot NIC drivers and lwip/ebd.c pass to each other.
+ * Included from etherboot/include/nic.h and from lwip/ebd.h, so both
+ * sides agree on the layout. lwIP is built with -fpack-struct and
+ * etherboot is not, so keep to members that need no padding.
+ */
+
+/* counters kept by the driver, see eth_stats() */
+struct nic_stats {
+	unsigned long rx_frames;
+	unsigned long rx_errors;	/* CRC, framing and length errors */
+	unsigned long rx_missed;	/* frames the MAC missed */
+	unsigned long rx_overruns;	/* receive FIFO overflows */
+	unsigned long rx_nobuf;		/* times the rx ring ran full */
+	unsigned long rx_dropped;	/* no buffer to replace a lent one */
+	unsigned long tx_frames;
+	unsigned long tx_errors;
+	unsigned long tx_dropped;	/* tx ring stayed full */
+};
+
+/* a piece of a frame passed to eth_transmit_frags() */
+struct nic_frag {
+	const void *data;
+	unsigned int len;
+};
+
+struct nic_stats *eth_stats(void);
+int eth_transmit_frags(const struct nic_frag *frag, int nfrags);
+
+#endif /* _NIC_SHARED_H_ */
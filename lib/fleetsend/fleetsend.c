@@ -0,0 +1,334 @@
+/*
+ * fleetsend - broadcasts a BIOS image to every box in web flasher mode
+ * on the subnet at once, see lwip/fleet.h for the protocol.
+ *
+ * The image goes out in passes. After each pass the boxes NAK what they
+ * missed and only that is sent again, until no box misses anything.
+ *
+ * usage: fleetsend [-a address] [-p port] [-c chunk] [-r KB/s] [-n boxes] image
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "sha1.h"
+#include "../../lwip/fleet.h"
+
+#define MAX_IMAGE	(1024*1024)
+#define MAX_BOXES	256
+#define MAX_PASSES	50
+
+/* chunks between announcements within a pass */
+#define ANNOUNCE_EVERY	128
+
+/* how long the boxes get to NAK after a pass, in ms */
+#define LISTEN_MS	2500
+
+struct box {
+	struct in_addr addr;
+	int status;	/* FLEET_ST_..., or -1 while receiving */
+};
+
+static int sock;
+static struct sockaddr_in dest;
+static uint8_t *image;
+static uint32_t imagelen, session, nchunks;
+static int chunk = FLEET_CHUNK_DEFAULT;
+static uint8_t sha1[SHA1HashSize];
+static uint8_t *resend;		/* chunks NAKed since the pass started */
+static struct box boxes[MAX_BOXES];
+static int nboxes;
+
+static const char *status_name[] = { "flashing", "SHA-1 mismatch", "image rejected", "busy" };
+
+void showUsage()
+{
+	printf("fleetsend [-a address] [-p port] [-c chunk] [-r KB/s] [-n boxes] image\n");
+	printf("  -a  broadcast address, default 255.255.255.255\n");
+	printf("  -p  UDP port, default %d\n", FLEET_PORT);
+	printf("  -c  chunk size, %d to %d, default %d\n", FLEET_CHUNK_MIN, FLEET_CHUNK_MAX, FLEET_CHUNK_DEFAULT);
+	printf("  -r  rate in KB/s, default 2000\n");
+	printf("  -n  number of boxes to wait for\n");
+}
+
+static long now_ms(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000L + tv.tv_usec / 1000;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void header(uint8_t *b, int type)
+{
+	memcpy(b, FLEET_MAGIC, 4);
+	b[4] = type;
+	b[5] = FLEET_VERSION;
+	b[6] = b[7] = 0;
+	put32(&b[8], session);
+}
+
+static void announce(int flags)
+{
+	uint8_t b[FLEET_ANNOUNCE_LEN];
+
+	header(b, FLEET_ANNOUNCE);
+	put32(&b[12], imagelen);
+	b[16] = chunk >> 8;
+	b[17] = chunk;
+	b[18] = flags >> 8;
+	b[19] = flags;
+	memcpy(&b[20], sha1, SHA1HashSize);
+	sendto(sock, b, sizeof(b), 0, (struct sockaddr *)&dest, sizeof(dest));
+}
+
+static void send_chunk(uint32_t n)
+{
+	uint8_t b[FLEET_HDR_LEN + 4 + FLEET_CHUNK_MAX];
+	int len = n == nchunks - 1 ? imagelen - n * chunk : chunk;
+
+	header(b, FLEET_DATA);
+	put32(&b[12], n);
+	memcpy(&b[16], image + n * chunk, len);
+	sendto(sock, b, 16 + len, 0, (struct sockaddr *)&dest, sizeof(dest));
+}
+
+static struct box *find_box(struct in_addr addr)
+{
+	int i;
+
+	for (i = 0; i < nboxes; i++)
+		if (boxes[i].addr.s_addr == addr.s_addr)
+			return &boxes[i];
+	if (nboxes == MAX_BOXES)
+		return NULL;
+	boxes[nboxes].addr = addr;
+	boxes[nboxes].status = -1;
+	return &boxes[nboxes++];
+}
+
+/* takes in NAKs and status reports for up to ms milliseconds,
+   returns the number of NAKs seen */
+static int collect(int ms)
+{
+	uint8_t b[FLEET_HDR_LEN + 4 + 8 * FLEET_NAK_MAX];
+	long end = now_ms() + ms;
+	int naks = 0;
+
+	for (;;) {
+		struct sockaddr_in from;
+		socklen_t fromlen = sizeof(from);
+		struct timeval tv;
+		fd_set fds;
+		long left = end - now_ms();
+		struct box *box;
+		int len, i, ranges;
+
+		if (left < 0)
+			left = 0;
+		tv.tv_sec = left / 1000;
+		tv.tv_usec = (left % 1000) * 1000;
+		FD_ZERO(&fds);
+		FD_SET(sock, &fds);
+		if (select(sock + 1, &fds, NULL, NULL, &tv) <= 0)
+			return naks;
+
+		len = recvfrom(sock, b, sizeof(b), 0, (struct sockaddr *)&from, &fromlen);
+		if (len < FLEET_HDR_LEN || memcmp(b, FLEET_MAGIC, 4) != 0 ||
+		    b[5] != FLEET_VERSION || get32(&b[8]) != session)
+			continue;
+		box = find_box(from.sin_addr);
+		if (box == NULL)
+			continue;
+
+		if (b[4] == FLEET_NAK && len >= 16) {
+			ranges = (b[12] << 8) | b[13];
+			if (16 + 8 * ranges > len)
+				continue;
+			for (i = 0; i < ranges; i++) {
+				uint32_t first = get32(&b[16 + 8 * i]);
+				uint32_t count = get32(&b[20 + 8 * i]);
+
+				while (count-- > 0 && first < nchunks)
+					resend[first++] = 1;
+			}
+			naks++;
+		} else if (b[4] == FLEET_STATUS && len >= FLEET_STATUS_LEN) {
+			if (box->status != b[12] && b[12] <= FLEET_ST_BUSY)
+				printf("%s: %s\n", inet_ntoa(from.sin_addr), status_name[b[12]]);
+			box->status = b[12];
+			/* a box with a bad image starts again from scratch */
+			if (b[12] == FLEET_ST_BADHASH) {
+				memset(resend, 1, nchunks);
+				naks++;
+			}
+		}
+		if (left == 0)
+			return naks;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	SHA1Context context;
+	struct stat fileinfo;
+	uint8_t *tosend;
+	FILE *f;
+	int rate = 2000, wantboxes = 0, port = FLEET_PORT, one = 1;
+	int c, pass, i, flashed, sent;
+	long start, t;
+	uint32_t n;
+
+	dest.sin_family = AF_INET;
+	dest.sin_addr.s_addr = htonl(INADDR_BROADCAST);
+
+	while ((c = getopt(argc, argv, "a:p:c:r:n:")) != -1) {
+		switch (c) {
+		case 'a':
+			if (!inet_aton(optarg, &dest.sin_addr)) {
+				fprintf(stderr, "Bad address %s\n", optarg);
+				return 1;
+			}
+			break;
+		case 'p':
+			port = atoi(optarg);
+			break;
+		case 'c':
+			chunk = atoi(optarg);
+			break;
+		case 'r':
+			rate = atoi(optarg);
+			break;
+		case 'n':
+			wantboxes = atoi(optarg);
+			break;
+		default:
+			showUsage();
+			return 1;
+		}
+	}
+	if (optind != argc - 1 || chunk < FLEET_CHUNK_MIN || chunk > FLEET_CHUNK_MAX || rate <= 0) {
+		showUsage();
+		return 1;
+	}
+	dest.sin_port = htons(port);
+
+	f = fopen(argv[optind], "r");
+	if (f == NULL) {
+		fprintf(stderr, "Unable to open image file %s : %s\n", argv[optind], strerror(errno));
+		return 1;
+	}
+	fstat(fileno(f), &fileinfo);
+	imagelen = fileinfo.st_size;
+	if (imagelen == 0 || imagelen > MAX_IMAGE) {
+		fprintf(stderr, "Image size %u, has to be at most %d\n", imagelen, MAX_IMAGE);
+		return 1;
+	}
+	image = malloc(imagelen);
+	if (fread(image, 1, imagelen, f) != imagelen) {
+		fprintf(stderr, "Unable to read %s\n", argv[optind]);
+		return 1;
+	}
+	fclose(f);
+
+	SHA1Reset(&context);
+	SHA1Input(&context, image, imagelen);
+	SHA1Result(&context, sha1);
+
+	nchunks = (imagelen + chunk - 1) / chunk;
+	tosend = malloc(nchunks);
+	resend = malloc(nchunks);
+	memset(tosend, 1, nchunks);
+	memset(resend, 0, nchunks);
+
+	srand(time(NULL) ^ getpid());
+	session = rand();
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0 || setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one)) < 0) {
+		fprintf(stderr, "Unable to open socket : %s\n", strerror(errno));
+		return 1;
+	}
+
+	printf("Sending %s, %u bytes in %u chunks to %s:%d\n", argv[optind],
+	       imagelen, nchunks, inet_ntoa(dest.sin_addr), port);
+
+	for (pass = 1; pass <= MAX_PASSES; pass++) {
+		announce(0);
+		start = now_ms();
+		sent = 0;
+		for (n = 0; n < nchunks; n++) {
+			if (!tosend[n])
+				continue;
+			send_chunk(n);
+			sent++;
+			/* boxes that missed the start join in here */
+			if (sent % ANNOUNCE_EVERY == 0)
+				announce(0);
+			/* keep to the rate, and take in NAKs meanwhile */
+			t = start + (long)sent * chunk / rate;
+			if (t > now_ms())
+				collect(t - now_ms());
+		}
+		printf("Pass %d: %d chunks\n", pass, sent);
+
+		announce(FLEET_END_OF_PASS);
+		collect(LISTEN_MS / 2);
+		announce(FLEET_END_OF_PASS);
+		collect(LISTEN_MS / 2);
+
+		flashed = 0;
+		for (i = 0; i < nboxes; i++)
+			if (boxes[i].status == FLEET_ST_FLASHING)
+				flashed++;
+
+		/* nothing more to send? */
+		for (n = 0; n < nchunks && !resend[n]; n++)
+			;
+		if (n == nchunks) {
+			if (wantboxes == 0 || flashed >= wantboxes)
+				break;
+			/* some boxes have not been heard of yet */
+			memset(resend, 1, nchunks);
+		}
+		memcpy(tosend, resend, nchunks);
+		memset(resend, 0, nchunks);
+	}
+
+	flashed = 0;
+	for (i = 0; i < nboxes; i++) {
+		if (boxes[i].status == FLEET_ST_FLASHING)
+			flashed++;
+		else
+			printf("%s: %s\n", inet_ntoa(boxes[i].addr),
+			       boxes[i].status < 0 ? "incomplete" : status_name[boxes[i].status]);
+	}
+	printf("%d box(es) flashing\n", flashed);
+
+	return flashed == nboxes && flashed >= wantboxes ? 0 : 1;
+}
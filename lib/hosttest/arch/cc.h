@@ -0,0 +1,37 @@
+/*
+ * Host stand-in for lwip/arch/cc.h. The lwIP types there use long for
+ * 32 bits, which is 64 bits wide on a 64-bit build machine and breaks
+ * the header structs. Put lib/hosttest ahead of lwip/ on the include
+ * path; arch/perf.h and arch/sys_arch.h still come from lwip/arch.
+ */
+
+#ifndef __ARCH_CC_H__
+#define __ARCH_CC_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifndef BYTE_ORDER
+#define BYTE_ORDER LITTLE_ENDIAN
+#endif
+
+typedef uint8_t   u8_t;
+typedef int8_t    s8_t;
+typedef uint16_t  u16_t;
+typedef int16_t   s16_t;
+typedef uint32_t  u32_t;
+typedef int32_t   s32_t;
+
+typedef uintptr_t mem_ptr_t;
+
+#define PACK_STRUCT_FIELD(x) x
+#define PACK_STRUCT_STRUCT __attribute__((packed))
+#define PACK_STRUCT_BEGIN
+#define PACK_STRUCT_END
+
+#define LWIP_PLATFORM_DIAG(x)	do {printf x;} while(0)
+#define LWIP_PLATFORM_ASSERT(x)
+
+#endif /* __ARCH_CC_H__ */
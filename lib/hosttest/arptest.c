@@ -0,0 +1,224 @@
+/*
+ * arptest - checks the hashed ARP table of lwip/etharp.c against a walk
+ * of the whole table, while it fills up, recycles entries for more hosts
+ * than it holds and ages them out. Then times etharp_ip_input and
+ * etharp_output for the cases that matter on a busy segment.
+ *
+ * usage: arptest
+ */
+
+#include <time.h>
+#include <unistd.h>
+#include "etharp.c"
+
+#define HOSTS		500	/* more than ARP_TABLE_SIZE */
+#define BENCH_RUNS	2000000
+
+struct stats_ lwip_stats;
+
+/* the NIC and the pbufs, as far as etharp.c needs them */
+static u8_t out_buf[1600];
+static struct pbuf out;
+static int requests;
+
+struct pbuf *pbuf_alloc(pbuf_layer l, u16_t length, pbuf_flag flag)
+{
+	out.next = NULL;
+	out.payload = out_buf + 100;
+	out.len = out.tot_len = length;
+	return &out;
+}
+u8_t pbuf_free(struct pbuf *p) { return 1; }
+u8_t pbuf_header(struct pbuf *p, s16_t header_size)
+{
+	p->payload = (u8_t *)p->payload - header_size;
+	p->len += header_size;
+	p->tot_len += header_size;
+	return 0;
+}
+static err_t linkoutput(struct netif *netif, struct pbuf *p) { requests++; return ERR_OK; }
+
+static struct netif netif;
+static u8_t frame[1600];
+static struct ethip_hdr *in = (struct ethip_hdr *)frame;
+static struct pbuf in_pbuf;
+
+/* the address and the MAC of host n, 10.0.x.y */
+static void host(int n, struct ip_addr *ipaddr, struct eth_addr *mac)
+{
+	IP4_ADDR(ipaddr, 10, 0, (1 + n / 200), (2 + n % 200));
+	memset(mac, 0, sizeof(*mac));
+	mac->addr[0] = 0x02;
+	mac->addr[4] = n >> 8;
+	mac->addr[5] = n;
+}
+
+/* a broadcast from host n */
+static void hear(int n)
+{
+	host(n, &in->ip.src, &in->eth.src);
+	IP4_ADDR(&in->ip.dest, 10, 0, 255, 255);
+	etharp_ip_input(&netif, &in_pbuf);
+}
+
+/* the MAC etharp_output puts in front of a packet to host n, 0 if the
+   address still has to be resolved */
+static int send_to(int n, struct eth_addr *mac)
+{
+	static u8_t buf[1600];
+	struct ip_addr ipaddr;
+	struct eth_addr want;
+	struct pbuf q;
+
+	host(n, &ipaddr, &want);
+	q.next = NULL;
+	q.payload = buf + 100;
+	q.len = q.tot_len = 100;
+	if (etharp_output(&netif, &ipaddr, &q) != &q)
+		return 0;
+	*mac = ((struct eth_hdr *)q.payload)->dest;
+	return 1;
+}
+
+/* every entry in use is in the bucket of its address, once */
+static int table_ok(void)
+{
+	int i, h, in_buckets = 0, used = 0;
+	s8_t j;
+
+	for (h = 0; h < ARP_HASH_SIZE; h++)
+		for (j = arp_hash[h]; j != -1; j = arp_table[j].next) {
+			if (arp_table[j].state == ETHARP_STATE_EMPTY ||
+			    etharp_hash(&arp_table[j].ipaddr) != h ||
+			    ++in_buckets > ARP_TABLE_SIZE)
+				return 0;
+		}
+	for (i = 0; i < ARP_TABLE_SIZE; i++)
+		if (arp_table[i].state != ETHARP_STATE_EMPTY)
+			used++;
+	return used == in_buckets;
+}
+
+/* the entry for an address the way it was found before the hash, by
+   walking the whole table */
+static s8_t scan(struct ip_addr *ipaddr)
+{
+	s8_t i;
+
+	for (i = 0; i < ARP_TABLE_SIZE; i++)
+		if (arp_table[i].state != ETHARP_STATE_EMPTY &&
+		    ip_addr_cmp(ipaddr, &arp_table[i].ipaddr))
+			return i;
+	return -1;
+}
+
+/*
+ * Hears from random hosts, with the timer running now and then, and
+ * looks every host up after each few frames: the hash has to find what
+ * a walk of the table finds, with the right MAC, and the host heard
+ * last has to be there.
+ */
+static int check(void)
+{
+	struct eth_addr want;
+	struct ip_addr ipaddr;
+	int i, n, last = 0, ok = 1;
+	s8_t j;
+
+	for (i = 0; i < 200000 && ok; i++) {
+		last = rand() % HOSTS;
+		hear(last);
+		if (i % 997 == 0)
+			etharp_tmr();
+		if (i % 101 != 0)
+			continue;
+
+		ok = table_ok();
+		for (n = 0; n < HOSTS && ok; n++) {
+			host(n, &ipaddr, &want);
+			j = etharp_lookup(&ipaddr);
+			ok = j == scan(&ipaddr) && (n != last || j != -1) &&
+				(j == -1 || !memcmp(&arp_table[j].ethaddr, &want, sizeof(want)));
+		}
+	}
+	printf("%d frames from %d hosts: %s\n", i, HOSTS, ok ? "table ok" : "TABLE WRONG");
+
+	/* nothing stays once it is too old */
+	for (i = 0; i < ARP_MAXAGE; i++)
+		etharp_tmr();
+	for (n = 0; n < HOSTS && ok; n++) {
+		host(n, &ipaddr, &want);
+		ok = etharp_lookup(&ipaddr) == -1;
+	}
+	ok = ok && table_ok();
+	printf("aged out: %s\n", ok ? "ok" : "FAILED");
+	return ok;
+}
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void bench(void)
+{
+	struct eth_addr mac;
+	double t;
+	int i;
+
+	etharp_init();
+	/* a busy segment, the table full of hosts that broadcast */
+	for (i = 0; i < ARP_TABLE_SIZE; i++)
+		hear(i);
+
+	/* the peer of a transfer, sending to us */
+	host(ARP_TABLE_SIZE - 1, &in->ip.src, &in->eth.src);
+	in->ip.dest = netif.ip_addr;
+	t = now();
+	for (i = 0; i < BENCH_RUNS; i++)
+		etharp_ip_input(&netif, &in_pbuf);
+	printf("ip_input from the active peer     %6.1f ns\n", (now() - t) / BENCH_RUNS * 1e9);
+
+	t = now();
+	for (i = 0; i < BENCH_RUNS; i++)
+		send_to(ARP_TABLE_SIZE - 1, &mac);
+	printf("output to the active peer         %6.1f ns\n", (now() - t) / BENCH_RUNS * 1e9);
+
+	t = now();
+	for (i = 0; i < BENCH_RUNS; i++)
+		hear(i % ARP_TABLE_SIZE);
+	printf("ip_input, %d peers in turn        %6.1f ns\n", ARP_TABLE_SIZE,
+	       (now() - t) / BENCH_RUNS * 1e9);
+
+	t = now();
+	for (i = 0; i < BENCH_RUNS / 10; i++) {
+		hear(i % HOSTS);
+		if (i % 1000 == 0)
+			etharp_tmr();
+	}
+	printf("ip_input, %d peers churning      %6.1f ns\n", HOSTS,
+	       (now() - t) / (BENCH_RUNS / 10) * 1e9);
+}
+
+int main(void)
+{
+	int ok;
+
+	netif.hwaddr_len = 6;
+	netif.linkoutput = linkoutput;
+	IP4_ADDR(&netif.ip_addr, 10, 0, 0, 1);
+	IP4_ADDR(&netif.netmask, 255, 255, 0, 0);
+	in_pbuf.payload = frame;
+	in_pbuf.len = in_pbuf.tot_len = 100;
+
+	/* a bucket chain that loops would hang the test instead */
+	alarm(30);
+	etharp_init();
+	ok = check();
+	bench();
+	printf("arptest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
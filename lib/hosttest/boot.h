@@ -0,0 +1,57 @@
+/*
+ * Host stand-in for include/boot.h, so that fs/fatx can be built and run
+ * on the build machine against a disk image, see fatxtest.c. Also has
+ * what lwip/webserver.c takes from it, see webtest.c, and the screen
+ * lwip/netpanel.c draws on, see paneltest.c.
+ */
+
+#ifndef _HOSTTEST_BOOT_H_
+#define _HOSTTEST_BOOT_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef unsigned int DWORD;
+
+#define true 1
+#define false 0
+
+#define printk printf
+extern DWORD VIDEO_ATTR;
+
+/* the IDE calls fs/fatx makes, served from the image by fatxtest.c */
+int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int byte_offset, int n_bytes);
+int BootIdeReadSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeWriteSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors);
+int BootIdeFlushCache(int nDriveIndex);
+
+/* only the CMOS clock, for the file time stamps */
+void IoOutputByte(WORD wAddress, BYTE bValue);
+BYTE IoInputByte(WORD wAddress);
+
+char *strrchr0(char *string, char ch);
+int _strncmp(const char *sz1, const char *sz2, int nMax);
+
+/* drivers/flash/BootFlash.h and lwip/webserver.c */
+typedef int bool;
+unsigned long simple_strtoul(const char *cp, char **endp, unsigned int base);
+
+/* lib/eeprom/BootEEPROM.h would define eeprom in every user */
+#define EEPROM_SIZE 0x100
+extern char eeprom[];
+void BootEepromReadEntireEEPROM(void);
+
+/* the video mode lwip/netpanel.c draws in, see paneltest.c */
+typedef struct {
+	DWORD m_dwWidthInPixels;
+	DWORD m_dwHeightInLines;
+	DWORD m_dwMarginXInPixelsRecommended;
+	DWORD m_dwMarginYInLinesRecommended;
+} CURRENT_VIDEO_MODE_DETAILS;
+extern CURRENT_VIDEO_MODE_DETAILS currentvideomodedetails;
+extern DWORD VIDEO_CURSOR_POSX, VIDEO_CURSOR_POSY;
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ * chksumtest - checks lwip_chksum from lwip/inet.c against the 16-bit
+ * loop it replaced and against a byte-wise RFC 1071 sum, on random
+ * buffers at every start alignment, and times all of them.
+ *
+ * usage: chksumtest
+ */
+
+#include "inet.c"
+
+#define MAX_LEN		66000
+#define BENCH_RUNS	2000
+
+/* lwip_chksum as it was, one 16-bit word per pass */
+static u16_t ref_chksum(void *dataptr, int len)
+{
+	u32_t acc;
+
+	for (acc = 0; len > 1; len -= 2) {
+		acc += *(u16_t *)dataptr;
+		dataptr = (void *)((u16_t *)dataptr + 1);
+	}
+	if (len == 1)
+		acc += htons((u16_t)((*(u8_t *)dataptr) & 0xff) << 8);
+	acc = (acc >> 16) + (acc & 0xffffUL);
+	if ((acc & 0xffff0000) != 0)
+		acc = (acc >> 16) + (acc & 0xffffUL);
+	return (u16_t)acc;
+}
+
+/* RFC 1071 on big endian words, in memory order like the others */
+static u16_t rfc1071(const u8_t *b, int len)
+{
+	u32_t sum = 0;
+	int i;
+
+	for (i = 0; i + 1 < len; i += 2)
+		sum += (b[i] << 8) | b[i + 1];
+	if (len & 1)
+		sum += b[len - 1] << 8;
+	while (sum >> 16)
+		sum = (sum >> 16) + (sum & 0xffff);
+	return htons(sum);
+}
+
+/* one's complement: 0 and 0xffff are the same number */
+static int same(u16_t a, u16_t b)
+{
+	return a == b || ((a == 0 || a == 0xffff) && (b == 0 || b == 0xffff));
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+static unsigned long long rdtsc(void)
+{
+	unsigned int lo, hi;
+
+	__asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+	return ((unsigned long long)hi << 32) | lo;
+}
+
+static void bench(u8_t *buf)
+{
+	static const int lens[] = { 20, 160, 576, 1460 };
+	unsigned long long t, best_ref, best_new;
+	volatile u16_t sink;
+	int i, r;
+
+	for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+		best_ref = best_new = ~0ULL;
+		for (r = 0; r < BENCH_RUNS; r++) {
+			t = rdtsc();
+			sink = ref_chksum(buf, lens[i]);
+			t = rdtsc() - t;
+			if (t < best_ref)
+				best_ref = t;
+			t = rdtsc();
+			sink = lwip_chksum(buf, lens[i]);
+			t = rdtsc() - t;
+			if (t < best_new)
+				best_new = t;
+		}
+		printf("%4d bytes: old %.2f cycles/byte, new %.2f cycles/byte\n", lens[i],
+		       (double)best_ref / lens[i], (double)best_new / lens[i]);
+	}
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+	static u8_t buf[MAX_LEN + 8];
+	struct pbuf p[3], whole;
+	struct ip_addr src = { 0x0100a8c0 }, dest = { 0x0200a8c0 };
+	long bad = 0, badpseudo = 0;
+	int i, j, off, len, c1, c2;
+	u8_t *m;
+
+	srand(1);
+	for (i = 0; i < 300000; i++) {
+		off = rand() % 8;
+		/* mostly short buffers, some up to the largest IP datagram */
+		len = rand() % (i < 200000 ? 200 : MAX_LEN);
+		for (j = 0; j < len + 8; j++)
+			buf[j] = rand();
+		/* all ones makes the most carries */
+		if (rand() % 4 == 0)
+			memset(buf, 0xff, len + 8);
+		if (!same(lwip_chksum(buf + off, len), ref_chksum(buf + off, len)) ||
+		    !same(lwip_chksum(buf + off, len), rfc1071(buf + off, len)))
+			bad++;
+	}
+	printf("random buffers: 300000 checked, %ld mismatches\n", bad);
+
+	/* the pseudo header sum over a pbuf chain split at odd places */
+	for (i = 0; i < 100000; i++) {
+		len = rand() % 3000 + 1;
+		for (j = 0; j < len; j++)
+			buf[j] = rand();
+		c1 = rand() % (len + 1);
+		c2 = c1 + rand() % (len - c1 + 1);
+		off = rand() % 4;
+		m = malloc(len + 8);
+		memcpy(m + off, buf, len);
+		p[0].payload = m + off;
+		p[0].len = c1;
+		p[0].tot_len = len;
+		p[0].next = &p[1];
+		p[1].payload = m + off + c1;
+		p[1].len = c2 - c1;
+		p[1].next = &p[2];
+		p[2].payload = m + off + c2;
+		p[2].len = len - c2;
+		p[2].next = NULL;
+		memset(&whole, 0, sizeof(whole));
+		whole.payload = buf;
+		whole.len = whole.tot_len = len;
+		if (inet_chksum_pseudo(&p[0], &src, &dest, 6, len) !=
+		    inet_chksum_pseudo(&whole, &src, &dest, 6, len))
+			badpseudo++;
+		free(m);
+	}
+	printf("pseudo header sums over split pbufs: 100000 checked, %ld mismatches\n", badpseudo);
+
+#if defined(__i386__) || defined(__x86_64__)
+	bench(buf);
+#endif
+
+	printf("chksumtest: %s\n", bad || badpseudo ? "FAILED" : "ok");
+	return bad || badpseudo;
+}
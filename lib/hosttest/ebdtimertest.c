@@ -0,0 +1,146 @@
+/*
+ * ebdtimertest - runs the main loop of lwip/ebd.c for three simulated
+ * minutes with a frame waiting every time it polls the NIC, and checks
+ * that the lwIP timers still run at their rate. The 24 bit PM timer
+ * starts just before it wraps, so ebd_clock has to carry it over.
+ *
+ * usage: ebdtimertest
+ */
+
+#include <setjmp.h>
+#include "httpd.h"
+#include "ebd.c"
+
+/* PM timer ticks a frame costs, a full frame at about 30000 a second */
+#define FRAME_TICKS	120
+#define RUN_SECS	180
+#define TICKS_PER_SEC	3579545UL
+
+static unsigned long pm = 0xfff000, end;
+static jmp_buf done;
+static long frames, tcp, fine, coarse, arp, fleet;
+
+unsigned long currticks(void)
+{
+	if (pm >= end)
+		longjmp(done, 1);
+	return pm & 0xffffff;
+}
+
+/* the NIC, with a frame waiting whenever it is polled; the frames are
+   of no protocol the stack knows, so they are dropped on the spot */
+int eth_rx_buffers(void *(*alloc)(unsigned char **buf),
+	void (*release)(void *cookie), unsigned int size) { return 0; }
+int eth_poll_buffer(void **cookie, unsigned int *len) { return 0; }
+
+int eth_poll_into(char *buf, int *len)
+{
+	memset(buf, 0, 14);
+	buf[12] = 0x88;	/* no IP, no ARP */
+	*len = EBD_FRAME_LEN;
+	pm += FRAME_TICKS;
+	frames++;
+	return 1;
+}
+
+char forcedeth_hw_addr[6];
+struct stats_ lwip_stats;
+
+void eth_transmit(const char *d, unsigned int t, unsigned int s, const void *p) {}
+int eth_transmit_frags(const struct nic_frag *frag, int n) { return 1; }
+
+static struct pbuf frame;
+static char frame_buf[EBD_FRAME_LEN];
+
+struct pbuf *pbuf_alloc(pbuf_layer l, u16_t length, pbuf_flag flag)
+{
+	frame.next = NULL;
+	frame.payload = frame_buf;
+	frame.len = frame.tot_len = length;
+	return &frame;
+}
+u8_t pbuf_free(struct pbuf *p) { return 1; }
+void pbuf_realloc(struct pbuf *p, u16_t size) {}
+u8_t pbuf_header(struct pbuf *p, s16_t header_size) { return 0; }
+u16_t inet_chksum(void *dataptr, u16_t len) { return 0; }
+
+/* the timers that are counted */
+void tcp_tmr(void) { tcp++; }
+void dhcp_fine_tmr(void) { fine++; }
+void dhcp_coarse_tmr(void) { coarse++; }
+void etharp_tmr(void) { arp++; }
+void fleet_tmr(void) { fleet++; }
+
+/* and the rest of the stack, which has nothing to do here */
+void stats_init(void) {}
+void mem_init(void) {}
+void memp_init(void) {}
+void pbuf_init(void) {}
+void netif_init(void) {}
+void ip_init(void) {}
+void udp_init(void) {}
+void tcp_init(void) {}
+void etharp_init(void) {}
+void httpd_init(void) {}
+void fleet_init(void) {}
+void httpboot_start(struct netif *netif) {}
+void httpboot_poll(void) {}
+void netpanel_poll(struct netif *netif, u32_t now) {}
+
+void netcfg_load(struct netcfg *cfg)
+{
+	memset(cfg, 0, sizeof(*cfg));
+	cfg->dhcp_wait = 10;
+}
+void netcfg_save(const struct netcfg *cfg) {}
+
+struct netif *netif_add(struct netif *netif, struct ip_addr *ipaddr,
+	struct ip_addr *netmask, struct ip_addr *gw, void *state,
+	err_t (*init)(struct netif *netif),
+	err_t (*input)(struct pbuf *p, struct netif *netif))
+{
+	memset(netif, 0, sizeof(*netif));
+	init(netif);
+	return netif;
+}
+void netif_set_default(struct netif *netif) {}
+void netif_set_ipaddr(struct netif *netif, struct ip_addr *ipaddr) {}
+void netif_set_netmask(struct netif *netif, struct ip_addr *netmask) {}
+void netif_set_gw(struct netif *netif, struct ip_addr *gw) {}
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr,
+	struct ip_addr *server) { return ERR_OK; }
+void dhcp_stop(struct netif *netif) {}
+err_t ip_input(struct pbuf *p, struct netif *inp) { return ERR_OK; }
+struct pbuf *etharp_ip_input(struct netif *netif, struct pbuf *p) { return NULL; }
+struct pbuf *etharp_arp_input(struct netif *netif, struct eth_addr *ethaddr,
+	struct pbuf *p) { return NULL; }
+struct pbuf *etharp_output(struct netif *netif, struct ip_addr *ipaddr,
+	struct pbuf *q) { return NULL; }
+
+/* want is the number of runs in RUN_SECS at one every msecs, the last
+   of which may fall just past the end */
+static int check(const char *name, long runs, long msecs)
+{
+	long want = RUN_SECS * 1000L / msecs;
+
+	printf("%-16s %5ld runs, want %ld\n", name, runs, want);
+	return runs >= want - 1 && runs <= want;
+}
+
+int main(void)
+{
+	int ok = 1;
+
+	end = pm + RUN_SECS * TICKS_PER_SEC;
+	if (!setjmp(done))
+		run_lwip();
+
+	printf("%ld frames in %d seconds\n", frames, RUN_SECS);
+	ok &= check("tcp_tmr", tcp, TCP_TMR_INTERVAL);
+	ok &= check("dhcp_fine_tmr", fine, DHCP_FINE_TIMER_MSECS);
+	ok &= check("dhcp_coarse_tmr", coarse, DHCP_COARSE_TIMER_SECS * 1000);
+	ok &= check("etharp_tmr", arp, ARP_TMR_INTERVAL);
+	ok &= check("fleet_tmr", fleet, FLEET_TMR_INTERVAL);
+	printf("ebdtimertest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
@@ -0,0 +1,233 @@
+/*
+ * echotest - pings lwip/ebd.c over the emulated NIC of nicsim.c. Checks
+ * that an echo request for our address is answered by ebd_echo, before
+ * the stack sees it, with a reply whose IP and ICMP checksums are right,
+ * for every echo id and with IP options and odd lengths. Then that the
+ * ICMP it leaves alone, other types, echoes with a bad checksum and
+ * echoes to the broadcast address, still reach lwIP and are counted
+ * there.
+ *
+ * usage: echotest
+ */
+
+#include "httpd.h"
+#include "ebd.c"
+#include "nicsim.h"
+
+/* the stack around ebd_input */
+void dhcp_fine_tmr(void) {}
+void dhcp_coarse_tmr(void) {}
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr,
+	struct ip_addr *server) { return ERR_OK; }
+void dhcp_stop(struct netif *netif) {}
+void httpd_init(void) {}
+void fleet_init(void) {}
+void fleet_tmr(void) {}
+void httpboot_start(struct netif *netif) {}
+void httpboot_poll(void) {}
+void netpanel_poll(struct netif *netif, u32_t now) {}
+void netcfg_load(struct netcfg *cfg) {}
+void netcfg_save(const struct netcfg *cfg) {}
+unsigned long currticks(void) { return 0; }
+
+static struct netif netif;
+static const unsigned char peer_mac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+static unsigned char frame[EBD_FRAME_LEN];
+static int frame_len;
+
+/* the replies on the wire, and the frames ip_input got */
+static unsigned char wire[2048];
+static int wire_len, replies, stack_frames;
+
+static void tx(const unsigned char *f, int len)
+{
+	memcpy(wire, f, len);
+	wire_len = len;
+	replies++;
+}
+
+static err_t stack_input(struct pbuf *p, struct netif *inp)
+{
+	stack_frames++;
+	return ip_input(p, inp);
+}
+
+/* ICMP of type with datalen bytes of data, from 10.0.0.1 to dest, with
+   optlen bytes of IP options */
+static void make_icmp(u8_t type, u16_t id, struct ip_addr *dest, int optlen, int datalen)
+{
+	struct ip_hdr *iphdr = (struct ip_hdr *)&frame[14];
+	struct icmp_echo_hdr *iecho;
+	int hlen = IP_HLEN + optlen, i;
+
+	memcpy(frame, forcedeth_hw_addr, 6);
+	memcpy(frame + 6, peer_mac, 6);
+	frame[12] = 0x08;
+	frame[13] = 0x00;
+	memset(iphdr, 0, hlen);
+	IPH_VHLTOS_SET(iphdr, 4, hlen / 4, 0);
+	IPH_LEN_SET(iphdr, htons(hlen + sizeof(*iecho) + datalen));
+	IPH_ID_SET(iphdr, htons(id));
+	IPH_TTL_SET(iphdr, 64);
+	IPH_PROTO_SET(iphdr, IP_PROTO_ICMP);
+	IP4_ADDR(&iphdr->src, 10, 0, 0, 1);
+	iphdr->dest = *dest;
+	if (optlen)
+		((u8_t *)iphdr)[IP_HLEN] = 1;	/* no-ops */
+	for (i = 1; i < optlen; i++)
+		((u8_t *)iphdr)[IP_HLEN + i] = 1;
+	IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, hlen));
+
+	iecho = (struct icmp_echo_hdr *)((u8_t *)iphdr + hlen);
+	iecho->_type_code = 0;
+	ICMPH_TYPE_SET(iecho, type);
+	iecho->chksum = 0;
+	iecho->id = htons(id);
+	iecho->seqno = htons(1);
+	for (i = 0; i < datalen; i++)
+		((u8_t *)(iecho + 1))[i] = id + i;
+	iecho->chksum = inet_chksum(iecho, sizeof(*iecho) + datalen);
+
+	frame_len = 14 + hlen + sizeof(*iecho) + datalen;
+	/* short frames come padded, with whatever */
+	for (i = frame_len; i < 60; i++)
+		frame[i] = 0xa5;
+	if (frame_len < 60)
+		frame_len = 60;
+}
+
+/* puts the frame on the wire and lets ebd.c take it in */
+static void ping(void)
+{
+	wire_len = 0;
+	nicsim_deliver(frame, frame_len);
+	ebd_input(&netif);
+}
+
+/* the reply is the request with the addresses swapped, type 0 and
+   both checksums right */
+static int reply_ok(void)
+{
+	struct ip_hdr *req = (struct ip_hdr *)&frame[14];
+	struct ip_hdr *iphdr = (struct ip_hdr *)&wire[14];
+	struct icmp_echo_hdr *rq, *iecho;
+	int hlen = IPH_HL(req) * 4, len = ntohs(IPH_LEN(req));
+
+	if (wire_len != (14 + len < 60 ? 60 : 14 + len) ||
+	    memcmp(wire, peer_mac, 6) != 0 || memcmp(wire + 6, forcedeth_hw_addr, 6) != 0 ||
+	    memcmp(wire + 12, frame + 12, 2) != 0 || IPH_HL(iphdr) != IPH_HL(req) ||
+	    IPH_LEN(iphdr) != IPH_LEN(req) || inet_chksum(iphdr, hlen) != 0 ||
+	    !ip_addr_cmp(&iphdr->src, &req->dest) || !ip_addr_cmp(&iphdr->dest, &req->src))
+		return 0;
+	rq = (struct icmp_echo_hdr *)((u8_t *)req + hlen);
+	iecho = (struct icmp_echo_hdr *)((u8_t *)iphdr + hlen);
+	return ICMPH_TYPE(iecho) == ICMP_ER && ICMPH_CODE(iecho) == 0 &&
+	       inet_chksum(iecho, len - hlen) == 0 && iecho->id == rq->id &&
+	       iecho->seqno == rq->seqno &&
+	       memcmp(iecho + 1, rq + 1, len - hlen - sizeof(*iecho)) == 0;
+}
+
+/* every id, which covers both ways the checksum is patched, and some
+   lengths with and without IP options */
+static int echoes(void)
+{
+	static const int datalen[] = { 0, 1, 18, 56, 57, 1000, 1472 - 40 };
+	u16_t recv = lwip_stats.icmp.recv, xmit = lwip_stats.icmp.xmit;
+	int id, i, opt, n = 0, sent = replies, stack = stack_frames;
+
+	for (id = 0; id < 0x10000; id++) {
+		make_icmp(ICMP_ECHO, id, &netif.ip_addr, 0, 56);
+		ping();
+		if (!reply_ok()) {
+			printf("echo id %d FAILED\n", id);
+			return 0;
+		}
+		n++;
+	}
+	for (i = 0; i < sizeof(datalen) / sizeof(datalen[0]); i++)
+		for (opt = 0; opt <= 8; opt += 8) {
+			make_icmp(ICMP_ECHO, i, &netif.ip_addr, opt, datalen[i]);
+			ping();
+			if (!reply_ok()) {
+				printf("echo of %d bytes, %d of options FAILED\n",
+				       datalen[i], opt);
+				return 0;
+			}
+			n++;
+		}
+	/* the stack never saw them, but they are counted */
+	return replies == sent + n && stack_frames == stack &&
+	       (u16_t)(lwip_stats.icmp.recv - recv) == (u16_t)n &&
+	       (u16_t)(lwip_stats.icmp.xmit - xmit) == (u16_t)n;
+}
+
+/* ICMP the fast path leaves alone goes to icmp_input */
+static int others(void)
+{
+	struct stats_proto before = lwip_stats.icmp;
+	struct ip_addr bcast, other;
+	int sent = replies, stack = stack_frames;
+
+	make_icmp(ICMP_TS, 1, &netif.ip_addr, 0, 12);
+	ping();
+	if (lwip_stats.icmp.proterr != (u16_t)(before.proterr + 1))
+		return 0;
+
+	make_icmp(ICMP_ECHO, 2, &netif.ip_addr, 0, 56);
+	frame[14 + IP_HLEN + 8] ^= 0xff;
+	ping();
+	if (lwip_stats.icmp.chkerr != (u16_t)(before.chkerr + 1))
+		return 0;
+
+	IP4_ADDR(&bcast, 10, 0, 0, 255);
+	make_icmp(ICMP_ECHO, 3, &bcast, 0, 56);
+	ping();
+	if (lwip_stats.icmp.err != (u16_t)(before.err + 1))
+		return 0;
+
+	/* someone else's, which IP drops */
+	IP4_ADDR(&other, 10, 0, 0, 3);
+	make_icmp(ICMP_ECHO, 4, &other, 0, 56);
+	ping();
+
+	return replies == sent && stack_frames == stack + 4 &&
+	       lwip_stats.icmp.recv == (u16_t)(before.recv + 3) &&
+	       lwip_stats.icmp.xmit == before.xmit;
+}
+
+int main(void)
+{
+	struct ip_addr ipaddr, netmask, gw;
+	int ok = 1, r;
+
+	nicsim_init();
+	nicsim_tx = tx;
+	stats_init();
+	mem_init();
+	memp_init();
+	pbuf_init();
+	netif_init();
+	etharp_init();
+	ip_init();
+	udp_init();
+	tcp_init();
+	IP4_ADDR(&ipaddr, 10, 0, 0, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	IP4_ADDR(&gw, 0, 0, 0, 0);
+	netif_add(&netif, &ipaddr, &netmask, &gw, NULL, ebd_init, stack_input);
+
+	r = echoes();
+	printf("echo requests answered by ebd_echo: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = others();
+	printf("other ICMP handed to lwIP: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	r = lwip_stats.pbuf.used == 0;
+	printf("no pbufs leaked: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	printf("echotest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
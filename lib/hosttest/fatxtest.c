@@ -0,0 +1,221 @@
+/*
+ * fatxtest - builds fs/fatx on the host and runs it against an empty
+ * 64MB FATX image in a temporary file. The IDE calls are served from
+ * the image, see boot.h.
+ *
+ * Writes a 1MB flash backup, an EEPROM backup and enough small files to
+ * make the directory grow, reopens the partition and reads them back.
+ * Then FATXRawRead is checked against the image for random (offset,
+ * length) pairs, with guard bytes around the buffer.
+ *
+ * usage: fatxtest
+ */
+
+#include "boot.h"
+#include "BootFATX.h"
+
+#define IMAGE_SIZE	(64*1024*1024)
+#define CLUSTER_SECTORS	32
+
+/* not in BootFATX.h */
+int FATXFindDir(FATXPartition *partition, int clusterId, char *dir);
+
+DWORD VIDEO_ATTR;
+
+static FILE *img;
+static long readCalls, writeCalls;
+static int failed;
+
+int BootIdeReadSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors)
+{
+	size_t n;
+
+	readCalls++;
+	fseek(img, (long)block * 512, SEEK_SET);
+	n = fread(pbBuffer, 1, nSectors * 512, img);
+	/* past the end of what was written, the image reads as zeros */
+	memset((char *)pbBuffer + n, 0, nSectors * 512 - n);
+	return 0;
+}
+
+int BootIdeReadSector(int nDriveIndex, void * pbBuffer, unsigned int block, int byte_offset, int n_bytes)
+{
+	BYTE ba[512];
+
+	BootIdeReadSectors(nDriveIndex, ba, block, 1);
+	memcpy(pbBuffer, ba + byte_offset, n_bytes);
+	return 0;
+}
+
+int BootIdeWriteSectors(int nDriveIndex, void * pbBuffer, unsigned int block, int nSectors)
+{
+	writeCalls++;
+	fseek(img, (long)block * 512, SEEK_SET);
+	return fwrite(pbBuffer, 512, nSectors, img) != nSectors;
+}
+
+int BootIdeFlushCache(int nDriveIndex)
+{
+	return fflush(img);
+}
+
+void IoOutputByte(WORD wAddress, BYTE bValue)
+{
+}
+
+/* the CMOS clock says 04:04:04 on 4/4/2004 */
+BYTE IoInputByte(WORD wAddress)
+{
+	return 0x04;
+}
+
+char *strrchr0(char *string, char ch)
+{
+	return strchr(string, ch);
+}
+
+int _strncmp(const char *sz1, const char *sz2, int nMax)
+{
+	return strncmp(sz1, sz2, nMax);
+}
+
+/* an empty FATX partition: header, chain map with the root cluster, and
+   the root directory */
+static void format(void)
+{
+	BYTE header[FATX_PARTITION_HEADERSIZE];
+	BYTE map[4] = { 0xf8, 0xff, 0xff, 0xff };
+	BYTE root[CLUSTER_SECTORS * 512];
+	int clusters = IMAGE_SIZE / sizeof(root);
+	int mapsize = (clusters * 2 + FATX_CHAINTABLE_BLOCKSIZE - 1) & ~(FATX_CHAINTABLE_BLOCKSIZE - 1);
+
+	memset(header, 0xff, sizeof(header));
+	memcpy(header, "FATX", 4);
+	header[4] = 0x34;			/* volume id */
+	header[5] = 0x12;
+	header[6] = header[7] = 0;
+	header[8] = CLUSTER_SECTORS;		/* sectors per cluster */
+	header[9] = header[10] = header[11] = 0;
+	header[12] = 1;				/* root cluster */
+	header[13] = header[14] = header[15] = 0;
+	memset(root, 0xff, sizeof(root));
+
+	fwrite(header, sizeof(header), 1, img);
+	fwrite(map, sizeof(map), 1, img);
+	fseek(img, FATX_PARTITION_HEADERSIZE + mapsize, SEEK_SET);
+	fwrite(root, sizeof(root), 1, img);
+}
+
+static void check(int ok, const char *what)
+{
+	if (!ok) {
+		printf("FAILED: %s\n", what);
+		failed++;
+	}
+}
+
+#define RAW_SPAN	(4*1024*1024)
+#define GUARD		32
+
+/* random reads in the first RAW_SPAN bytes, compared with the image */
+static void rawread(void)
+{
+	BYTE *all = malloc(RAW_SPAN), *buf = malloc(64 * 1024);
+	int i, j, sector, len, offset;
+
+	fseek(img, 0, SEEK_SET);
+	fread(all, 1, RAW_SPAN, img);
+	srand(1);
+	for (i = 0; i < 20000; i++) {
+		sector = rand() % 1000;
+		offset = rand() % 70000;
+		/* short reads within a sector or two, and long ones */
+		len = rand() % (i & 1 ? 600 : 40000);
+		memset(buf, 0xaa, GUARD + len + GUARD);
+		if (FATXRawRead(0, sector, offset, len, (char *)buf + GUARD) != len ||
+		    memcmp(buf + GUARD, all + sector * 512 + offset, len) != 0) {
+			printf("FAILED: raw read of %d bytes at sector %d + %d\n", len, sector, offset);
+			failed++;
+			continue;
+		}
+		for (j = 0; j < GUARD; j++) {
+			if (buf[j] != 0xaa || buf[GUARD + len + j] != 0xaa) {
+				printf("FAILED: raw read of %d bytes at sector %d + %d wrote outside the buffer\n",
+				       len, sector, offset);
+				failed++;
+				break;
+			}
+		}
+	}
+
+	/* the aligned middle of a read goes in one command */
+	readCalls = 0;
+	FATXRawRead(0, 8, 100, 100 * 512, (char *)buf);
+	check(readCalls == 3, "unaligned 50KB read in three commands");
+
+	free(buf);
+	free(all);
+}
+
+int main(int argc, char *argv[])
+{
+	FATXPartition *partition;
+	FATXFILEINFO fileinfo;
+	BYTE *flash, eeprom[256];
+	char name[FATX_FILENAME_MAX], path[64];
+	int bios, backup, i;
+
+	img = tmpfile();
+	if (img == NULL) {
+		perror("tmpfile");
+		return 1;
+	}
+	format();
+
+	flash = malloc(1024 * 1024);
+	for (i = 0; i < 1024 * 1024; i++)
+		flash[i] = i * 7 + (i >> 9);
+	for (i = 0; i < sizeof(eeprom); i++)
+		eeprom[i] = 255 - i;
+
+	partition = OpenFATXPartition(0, 0, IMAGE_SIZE);
+	check(partition != NULL, "open the partition");
+	if (partition == NULL)
+		return 1;
+	bios = FATXCreateDirectory(partition, FATX_ROOT_FAT_CLUSTER, "BIOS");
+	check(bios > 0, "create BIOS");
+	backup = FATXCreateDirectory(partition, bios, "backup");
+	check(backup > 0, "create BIOS/backup");
+
+	writeCalls = 0;
+	check(FATXWriteFile(partition, backup, "flash000.bin", flash, 1024 * 1024), "write flash000.bin");
+	printf("1MB file written with %ld write commands\n", writeCalls);
+	check(FATXWriteFile(partition, backup, "eeprom000.bin", eeprom, sizeof(eeprom)), "write eeprom000.bin");
+	/* more entries than one directory cluster holds */
+	for (i = 0; i < 300; i++) {
+		sprintf(name, "f%03d", i);
+		check(FATXWriteFile(partition, backup, name, eeprom, 100 + i % 150), "write a small file");
+	}
+	CloseFATXPartition(partition);
+
+	partition = OpenFATXPartition(0, 0, IMAGE_SIZE);
+	strcpy(path, "BIOS/backup/flash000.bin");
+	check(LoadFATXFile(partition, path, &fileinfo) &&
+	      fileinfo.fileSize == 1024 * 1024 &&
+	      memcmp(fileinfo.buffer, flash, 1024 * 1024) == 0, "read back flash000.bin");
+	strcpy(path, "BIOS/backup/eeprom000.bin");
+	check(LoadFATXFile(partition, path, &fileinfo) &&
+	      fileinfo.fileSize == sizeof(eeprom) &&
+	      memcmp(fileinfo.buffer, eeprom, sizeof(eeprom)) == 0, "read back eeprom000.bin");
+	strcpy(path, "BIOS/backup/f299");
+	check(LoadFATXFile(partition, path, &fileinfo) &&
+	      fileinfo.fileSize == 100 + 299 % 150 &&
+	      memcmp(fileinfo.buffer, eeprom, fileinfo.fileSize) == 0, "read back f299");
+	check(FATXFindDir(partition, FATX_ROOT_FAT_CLUSTER, "BIOS") == bios, "find BIOS");
+	CloseFATXPartition(partition);
+
+	rawread();
+
+	printf("fatxtest: %s\n", failed ? "FAILED" : "ok");
+	return failed != 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * fleetbox - lwip/fleet.c as one box of fleettest.c, see there. lwIP's
+ * UDP calls are served from fleettest.c's socket; this file keeps the
+ * lwIP headers away from the host's socket headers.
+ */
+
+#include "fleet.c"
+
+/* the calls fleettest.c makes */
+void box_start(u32_t addr, const char *image, int len, int busy_ticks);
+void box_input(const u8_t *data, int len, u32_t from, u16_t port);
+void box_tick(void);
+
+/* and the one it takes */
+void box_send(u32_t to, u16_t port, const void *data, int len);
+
+static struct netif box_netif;
+struct netif *netif_default = &box_netif;
+
+static char staging[FLASH_STAGING_SIZE];
+static const char *box_image;
+static int box_len, box_busy, box_ticks;
+
+static struct udp_pcb box_pcb;
+static void (*box_recv)(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+	struct ip_addr *addr, u16_t port);
+
+struct pbuf *pbuf_alloc(pbuf_layer l, u16_t length, pbuf_flag flag)
+{
+	struct pbuf *p = calloc(1, sizeof(*p));
+
+	p->payload = malloc(length);
+	p->len = p->tot_len = length;
+	return p;
+}
+
+u8_t pbuf_free(struct pbuf *p)
+{
+	free(p->payload);
+	free(p);
+	return 1;
+}
+
+void pbuf_realloc(struct pbuf *p, u16_t size)
+{
+	p->len = p->tot_len = size;
+}
+
+struct udp_pcb *udp_new(void) { return &box_pcb; }
+err_t udp_bind(struct udp_pcb *pcb, struct ip_addr *ipaddr, u16_t port) { return ERR_OK; }
+
+void udp_recv(struct udp_pcb *pcb,
+	void (*recv)(void *arg, struct udp_pcb *upcb, struct pbuf *p,
+		     struct ip_addr *addr, u16_t port),
+	void *recv_arg)
+{
+	box_recv = recv;
+}
+
+err_t udp_sendto(struct udp_pcb *pcb, struct pbuf *p, struct ip_addr *dst_ip, u16_t dst_port)
+{
+	box_send(dst_ip->addr, dst_port, p->payload, p->tot_len);
+	return ERR_OK;
+}
+
+void netpanel_transfer(const char *activity, struct ip_addr *from, u32_t expected) {}
+void netpanel_progress(u32_t len) {}
+
+/* a web upload holds the staging area for the first busy ticks */
+char *httpd_staging_claim(void *owner)
+{
+	return box_ticks < box_busy ? NULL : staging;
+}
+
+void httpd_staging_release(void *owner) {}
+
+/* the box would reset now, so this one goes away too */
+void httpd_flash_image(char *image, int len)
+{
+	int ok = len == box_len && memcmp(image, box_image, len) == 0;
+
+	printf("box %d.%d.%d.%d: flashing, %s after %d ticks\n",
+	       ip4_addr1(&box_netif.ip_addr), ip4_addr2(&box_netif.ip_addr),
+	       ip4_addr3(&box_netif.ip_addr), ip4_addr4(&box_netif.ip_addr),
+	       ok ? "image ok" : "IMAGE BAD", box_ticks);
+	exit(ok ? 0 : 3);
+}
+
+void box_start(u32_t addr, const char *image, int len, int busy_ticks)
+{
+	box_netif.ip_addr.addr = addr;
+	box_image = image;
+	box_len = len;
+	box_busy = busy_ticks;
+	fleet_init();
+}
+
+void box_input(const u8_t *data, int len, u32_t from, u16_t port)
+{
+	struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+	struct ip_addr addr;
+
+	memcpy(p->payload, data, len);
+	addr.addr = from;
+	box_recv(NULL, &box_pcb, p, &addr, port);
+}
+
+void box_tick(void)
+{
+	box_ticks++;
+	fleet_tmr();
+}
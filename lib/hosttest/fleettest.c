@@ -0,0 +1,219 @@
+/*
+ * fleettest - flashes a random image into a number of simulated boxes
+ * with bin/fleetsend. Each box is a process of its own running
+ * lwip/fleet.c (fleetbox.c) on a UDP socket at 127.0.0.10 and up. The
+ * broadcast is stood in for by a relay at 127.0.0.2, which hands every
+ * packet to each box, or loses it. The first box finds the staging area
+ * taken by a web upload for its first seconds and has to join late.
+ *
+ * usage: fleettest [boxes [loss percent]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <stdint.h>
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "fleet.h"
+
+#define IMAGE_LEN	(256 * 1024)
+#define RELAY_ADDR	"127.0.0.2"
+#define BOX_ADDR	10		/* 127.0.0.10 is the first box */
+#define BUSY_TICKS	12		/* 3 seconds of upload on the first box */
+#define RUN_SECS	60
+
+void box_start(uint32_t addr, const char *image, int len, int busy_ticks);
+void box_input(const uint8_t *data, int len, uint32_t from, uint16_t port);
+void box_tick(void);
+
+static int sock;
+
+static long now_ms(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000L + tv.tv_usec / 1000;
+}
+
+static int open_socket(const char *addr)
+{
+	struct sockaddr_in me;
+	int s = socket(AF_INET, SOCK_DGRAM, 0);
+
+	memset(&me, 0, sizeof(me));
+	me.sin_family = AF_INET;
+	inet_aton(addr, &me.sin_addr);
+	me.sin_port = htons(FLEET_PORT);
+	if (s < 0 || bind(s, (struct sockaddr *)&me, sizeof(me)) < 0) {
+		perror(addr);
+		exit(2);
+	}
+	return s;
+}
+
+static struct sockaddr_in box_addr(int i)
+{
+	struct sockaddr_in a;
+	char name[32];
+
+	memset(&a, 0, sizeof(a));
+	a.sin_family = AF_INET;
+	sprintf(name, "127.0.0.%d", BOX_ADDR + i);
+	inet_aton(name, &a.sin_addr);
+	a.sin_port = htons(FLEET_PORT);
+	return a;
+}
+
+/* fleetbox.c sending */
+void box_send(uint32_t to, uint16_t port, const void *data, int len)
+{
+	struct sockaddr_in d;
+
+	memset(&d, 0, sizeof(d));
+	d.sin_family = AF_INET;
+	d.sin_addr.s_addr = to;
+	d.sin_port = htons(port);
+	sendto(sock, data, len, 0, (struct sockaddr *)&d, sizeof(d));
+}
+
+/*
+ * Forwards what fleetsend broadcasts to each of the boxes, losing
+ * loss percent of it. The address and port it came from go along in
+ * 6 bytes at the end, the boxes answer there.
+ */
+static void relay(int boxes, int loss)
+{
+	uint8_t b[2048];
+	struct sockaddr_in from, to;
+	socklen_t fromlen;
+	int len, i;
+
+	sock = open_socket(RELAY_ADDR);
+	for (;;) {
+		fromlen = sizeof(from);
+		len = recvfrom(sock, b, sizeof(b) - 6, 0, (struct sockaddr *)&from, &fromlen);
+		if (len <= 0)
+			continue;
+		memcpy(b + len, &from.sin_addr.s_addr, 4);
+		memcpy(b + len + 4, &from.sin_port, 2);
+		for (i = 0; i < boxes; i++) {
+			if (rand() % 100 < loss)
+				continue;
+			to = box_addr(i);
+			sendto(sock, b, len + 6, 0, (struct sockaddr *)&to, sizeof(to));
+		}
+	}
+}
+
+/* one box, until it flashes (exit 0 or 3 from fleetbox.c) or time is up */
+static void box(int i, const char *image)
+{
+	struct sockaddr_in me = box_addr(i);
+	long next, end;
+	uint8_t b[2048];
+	uint16_t port;
+	int len;
+
+	sock = open_socket(inet_ntoa(me.sin_addr));
+	box_start(me.sin_addr.s_addr, image, IMAGE_LEN, i == 0 ? BUSY_TICKS : 0);
+	next = now_ms() + FLEET_TMR_INTERVAL;
+	end = now_ms() + RUN_SECS * 1000L;
+	while (now_ms() < end) {
+		long left = next - now_ms();
+		struct timeval tv;
+		fd_set fds;
+
+		if (left < 0)
+			left = 0;
+		tv.tv_sec = left / 1000;
+		tv.tv_usec = left % 1000 * 1000;
+		FD_ZERO(&fds);
+		FD_SET(sock, &fds);
+		if (select(sock + 1, &fds, NULL, NULL, &tv) > 0) {
+			len = recv(sock, b, sizeof(b), 0);
+			if (len >= 6) {
+				memcpy(&port, b + len - 2, 2);
+				box_input(b, len - 6, *(uint32_t *)(b + len - 6), ntohs(port));
+			}
+		}
+		if (now_ms() >= next) {
+			next += FLEET_TMR_INTERVAL;
+			box_tick();
+		}
+	}
+	printf("box %s: timed out\n", inet_ntoa(me.sin_addr));
+	exit(4);
+}
+
+int main(int argc, char *argv[])
+{
+	char path[] = "/tmp/fleettestXXXXXX", boxes_arg[8];
+	static char image[IMAGE_LEN];
+	pid_t relay_pid, send_pid, *box_pid;
+	int boxes = 8, loss = 5, fd, i, status, ok;
+
+	if (argc > 1)
+		boxes = atoi(argv[1]);
+	if (argc > 2)
+		loss = atoi(argv[2]);
+	if (boxes < 1 || boxes > 100 || loss < 0 || loss > 50) {
+		printf("usage: fleettest [boxes [loss percent]]\n");
+		return 1;
+	}
+
+	for (i = 0; i < IMAGE_LEN; i++)
+		image[i] = rand();
+	fd = mkstemp(path);
+	if (fd < 0 || write(fd, image, IMAGE_LEN) != IMAGE_LEN) {
+		perror(path);
+		return 1;
+	}
+	close(fd);
+	fflush(stdout);
+
+	relay_pid = fork();
+	if (relay_pid == 0)
+		relay(boxes, loss);
+	box_pid = malloc(boxes * sizeof(*box_pid));
+	for (i = 0; i < boxes; i++) {
+		box_pid[i] = fork();
+		if (box_pid[i] == 0)
+			box(i, image);
+	}
+
+	/* the boxes have to be listening before the first announce */
+	usleep(200000);
+	sprintf(boxes_arg, "%d", boxes);
+	send_pid = fork();
+	if (send_pid == 0) {
+		alarm(RUN_SECS);
+		execl("bin/fleetsend", "fleetsend", "-a", RELAY_ADDR, "-r", "20000",
+		      "-n", boxes_arg, path, (char *)NULL);
+		perror("bin/fleetsend");
+		exit(2);
+	}
+
+	waitpid(send_pid, &status, 0);
+	ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	for (i = 0; i < boxes; i++) {
+		waitpid(box_pid[i], &status, 0);
+		ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	}
+	kill(relay_pid, SIGTERM);
+	waitpid(relay_pid, NULL, 0);
+	unlink(path);
+
+	printf("fleettest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
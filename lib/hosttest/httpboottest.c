@@ -0,0 +1,264 @@
+/*
+ * httpboottest - runs lwip/httpboot.c on top of a stand-in for the lwIP
+ * TCP calls, which serves each request from the test and hands the
+ * response in as pbuf chains cut at odd places. Boots a kernel and an
+ * initrd named by a DHCP boot file, flashes a BIOS image named by
+ * NET_BOOT_URL, and gives up cleanly on a 404, a short body and an
+ * upload that holds the staging area.
+ *
+ * usage: httpboottest
+ */
+
+#include <setjmp.h>
+#include "config.h"
+
+#define NET_BOOT_URL "http://10.0.0.1:8080/xbox/boot.cfg"
+
+#include "inet.c"
+#include "httpboot.c"
+
+char mem_setup[0x10000 + 0x1000], mem_pm[0x00800000], mem_initrd[0x02000000];
+struct netpanel netpanel;
+
+unsigned long simple_strtoul(const char *cp, char **endp, unsigned int base)
+{
+	return strtoul(cp, endp, base);
+}
+
+u32_t ebd_clock(void)
+{
+	static u32_t now;
+
+	return now += 100 * EBD_TICKS_PER_MS;
+}
+
+void netpanel_transfer(const char *activity, struct ip_addr *from, u32_t expected) {}
+void netpanel_progress(u32_t len) {}
+
+/* the one connection there is at a time */
+static struct tcp_pcb pcb;
+static void *pcb_arg;
+static err_t (*pcb_recv)(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err);
+static err_t (*pcb_connected)(void *arg, struct tcp_pcb *pcb, err_t err);
+static struct ip_addr conn_addr;
+static u16_t conn_port;
+static char request[1024];
+static int recved, closes;
+
+struct tcp_pcb *tcp_new(void) { return &pcb; }
+void tcp_arg(struct tcp_pcb *p, void *arg) { pcb_arg = arg; }
+void tcp_recv(struct tcp_pcb *p,
+	err_t (*recv)(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err))
+{
+	pcb_recv = recv;
+}
+void tcp_err(struct tcp_pcb *p, void (*err)(void *arg, err_t err)) {}
+void tcp_poll(struct tcp_pcb *p,
+	err_t (*poll)(void *arg, struct tcp_pcb *tpcb), u8_t interval) {}
+err_t tcp_connect(struct tcp_pcb *p, struct ip_addr *addr, u16_t port,
+	err_t (*connected)(void *arg, struct tcp_pcb *tpcb, err_t err))
+{
+	pcb_connected = connected;
+	conn_addr = *addr;
+	conn_port = port;
+	return ERR_OK;
+}
+err_t tcp_write(struct tcp_pcb *p, const void *data, u16_t len, u8_t copy)
+{
+	memcpy(request, data, len);
+	request[len] = 0;
+	return ERR_OK;
+}
+err_t tcp_output(struct tcp_pcb *p) { return ERR_OK; }
+void tcp_recved(struct tcp_pcb *p, u16_t len) { recved += len; }
+err_t tcp_close(struct tcp_pcb *p) { closes++; return ERR_OK; }
+void tcp_abort(struct tcp_pcb *p) {}
+u8_t pbuf_free(struct pbuf *p) { return 1; }
+
+/* the staging area webserver.c lends out */
+static void *owner;
+static int flashed;
+
+char *httpd_staging_claim(void *o)
+{
+	if (owner != NULL && owner != o)
+		return NULL;
+	owner = o;
+	return mem_pm;
+}
+void httpd_staging_release(void *o)
+{
+	if (owner == o)
+		owner = NULL;
+}
+void httpd_flash_image(char *image, int len) { flashed = len; }
+
+static jmp_buf booted;
+static unsigned long boot_initrd;
+static char boot_append[256];
+
+void eth_disable(void) {}
+void startLinux(void *initrdStart, unsigned long initrdSize, const char *appendLine)
+{
+	boot_initrd = initrdSize;
+	strcpy(boot_append, appendLine);
+	longjmp(booted, 1);
+}
+
+/*
+ * Serves the request httpboot_poll just made: header and body in
+ * pieces of chunk bytes, each split over two pbufs, then the close.
+ * The last cut bytes of the body are left out, as if the server went
+ * away early.
+ */
+static void serve(const char *hdr, const char *body, int len, int chunk, int cut)
+{
+	int hlen = strlen(hdr), total = hlen + len - cut, off, n;
+	char *all = malloc(hlen + len);
+	struct pbuf p1, p2;
+
+	memcpy(all, hdr, hlen);
+	memcpy(all + hlen, body, len);
+	pcb_connected(pcb_arg, &pcb, ERR_OK);
+	for (off = 0; off < total && pcb_recv != NULL; off += n) {
+		n = total - off < chunk ? total - off : chunk;
+		p1.next = &p2;
+		p1.payload = all + off;
+		p1.len = n / 2;
+		p1.tot_len = n;
+		p2.next = NULL;
+		p2.payload = all + off + n / 2;
+		p2.len = p2.tot_len = n - n / 2;
+		pcb_recv(pcb_arg, &pcb, &p1, ERR_OK);
+	}
+	if (pcb_recv != NULL)
+		pcb_recv(pcb_arg, &pcb, NULL, ERR_OK);
+	free(all);
+}
+
+/* the first line of the last request */
+static int requested(const char *line)
+{
+	return strncmp(request, line, strlen(line)) == 0 &&
+		request[strlen(line)] == '\r';
+}
+
+static void reset(struct netif *netif, struct dhcp *dhcp, const char *boot_file)
+{
+	memset(&hb, 0, sizeof(hb));
+	memset(netif, 0, sizeof(*netif));
+	memset(dhcp, 0, sizeof(*dhcp));
+	netif->dhcp = dhcp;
+	strcpy((char *)dhcp->boot_file, boot_file);
+	owner = NULL;
+	flashed = recved = closes = 0;
+	httpboot_start(netif);
+}
+
+static int test_boot(struct netif *netif, struct dhcp *dhcp)
+{
+	static const char script[] = "# comment\r\nkernel vmlinuz\r\n"
+		"initrd /img/initrd.gz\r\nappend root=/dev/ram0 quiet\r\n";
+	int klen = 1536 + 100000, ilen = 300000, i, ok;
+	char *kernel = malloc(klen), *initrd = malloc(ilen), hdr[128];
+
+	for (i = 0; i < klen; i++)
+		kernel[i] = i * 7;
+	kernel[0x1f1] = 2;	/* 2 setup sectors and the boot sector */
+	memcpy(kernel + 0x202, "HdrS", 4);
+	for (i = 0; i < ilen; i++)
+		initrd[i] = i * 13;
+
+	reset(netif, dhcp, "http://192.168.5.9/pxe/boot.cfg");
+	httpboot_poll();
+	sprintf(hdr, "HTTP/1.0 200 OK\r\ncontent-length: %d\r\n\r\n", (int)strlen(script));
+	serve(hdr, script, strlen(script), 7, 0);
+	ok = requested("GET /pxe/boot.cfg HTTP/1.0") && conn_port == 80;
+
+	httpboot_poll();
+	sprintf(hdr, "HTTP/1.1 200 OK\r\nServer: x\r\nContent-Length:%d\r\n\r\n", klen);
+	serve(hdr, kernel, klen, 1460, 0);
+	ok &= requested("GET /pxe/vmlinuz HTTP/1.0");
+
+	httpboot_poll();
+	serve("HTTP/1.1 200 OK\r\n\r\n", initrd, ilen, 1000, 0);
+	ok &= requested("GET /img/initrd.gz HTTP/1.0");
+
+	if (!setjmp(booted)) {
+		httpboot_poll();
+		ok = 0;
+	}
+	ok &= boot_initrd == ilen && !strcmp(boot_append, "root=/dev/ram0 quiet") &&
+		!memcmp(mem_setup, kernel, 1536) &&
+		!memcmp(mem_pm, kernel + 1536, klen - 1536) &&
+		!memcmp(mem_initrd, initrd, ilen) && owner == &hb;
+	printf("kernel and initrd from DHCP: %s, %d bytes taken in\n",
+	       ok ? "ok" : "FAILED", recved);
+	free(kernel);
+	free(initrd);
+	return ok;
+}
+
+static int test_bios(struct netif *netif, struct dhcp *dhcp)
+{
+	static const char script[] = "bios  http://10.0.0.2/c.bin\n";
+	int len = 262144, ok;
+	char *image = malloc(len);
+
+	memset(image, 0x5a, len);
+	reset(netif, dhcp, "");
+	httpboot_poll();
+	serve("HTTP/1.0 200 OK\r\n\r\n", script, strlen(script), 5, 0);
+	ok = requested("GET /xbox/boot.cfg HTTP/1.0") && conn_port == 8080 &&
+		ip4_addr4(&conn_addr) == 1;
+
+	httpboot_poll();
+	serve("HTTP/1.0 200 OK\r\nCONTENT-LENGTH: 262144\r\n\r\n", image, len, 1460, 0);
+	ok &= requested("GET /c.bin HTTP/1.0") && ip4_addr4(&conn_addr) == 2;
+
+	httpboot_poll();
+	ok &= flashed == len && !memcmp(mem_pm, image, len);
+	/* the rejected image gives the staging area back */
+	ok &= hb.step == HB_FAILED && owner == NULL;
+	printf("BIOS from NET_BOOT_URL: %s\n", ok ? "ok" : "FAILED");
+	free(image);
+	return ok;
+}
+
+static int test_fail(struct netif *netif, struct dhcp *dhcp)
+{
+	static const char script[] = "kernel vmlinuz\n";
+	int ok;
+
+	reset(netif, dhcp, "");
+	httpboot_poll();
+	serve("HTTP/1.0 404 Not Found\r\n\r\n", "x", 1, 3, 0);
+	ok = hb.step == HB_FAILED && closes == 1 && owner == NULL;
+
+	reset(netif, dhcp, "");
+	httpboot_poll();
+	serve("HTTP/1.0 200 OK\r\nContent-Length: 15\r\n\r\n", script, 15, 4, 3);
+	ok &= hb.step == HB_FAILED;
+
+	reset(netif, dhcp, "");
+	httpboot_poll();
+	serve("HTTP/1.0 200 OK\r\n\r\n", script, 15, 4, 0);
+	owner = &owner;
+	httpboot_poll();
+	ok &= hb.step == HB_FAILED && owner == &owner;
+	printf("404, short body and busy staging area: %s\n", ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(void)
+{
+	struct netif netif;
+	struct dhcp dhcp;
+	int ok = 1;
+
+	ok &= test_boot(&netif, &dhcp);
+	ok &= test_bios(&netif, &dhcp);
+	ok &= test_fail(&netif, &dhcp);
+	printf("httpboottest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
@@ -0,0 +1,24 @@
+/*
+ * Host stand-in for include/memory_layout.h: the places lwip/httpboot.c
+ * loads to are buffers of httpboottest.c, of the same sizes. The flash
+ * lwip/webserver.c reads back is a buffer of webtest.c, the framebuffer
+ * lwip/netpanel.c draws on one of paneltest.c.
+ */
+
+#ifndef _HOSTTEST_MEMORY_LAYOUT_H_
+#define _HOSTTEST_MEMORY_LAYOUT_H_
+
+extern char mem_setup[], mem_pm[], mem_initrd[], mem_flash[], mem_framebuffer[];
+
+#define KERNEL_SETUP		((unsigned long)mem_setup)
+#define GDT_LOC			(KERNEL_SETUP + 0x10000)
+#define KERNEL_PM_CODE		((unsigned long)mem_pm)
+#define MAX_KERNEL_SIZE		0x00800000
+#define INITRD_START		((unsigned long)mem_initrd)
+#define MAX_INITRD_SIZE		0x02000000
+#define FLASH_STAGING_START	KERNEL_PM_CODE
+#define FLASH_STAGING_SIZE	0x00100000
+#define LPCFlashadress		((unsigned long)mem_flash)
+#define FRAMEBUFFER_START	((unsigned long)mem_framebuffer)
+
+#endif
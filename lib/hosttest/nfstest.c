@@ -0,0 +1,307 @@
+/*
+ * nfstest - loads a file with nfs() from etherboot/core/nfs.c from a
+ * simulated NFSv2 server, in virtual time counted by a 24 bit PM timer.
+ * Checks that the blocks after the first, read with several READs in
+ * flight, reach the loader whole and in order: with replies that come
+ * back in order, out of order, and lost, either way, so that READs have
+ * to be sent again. Last with the timer wrapping during the transfer
+ * and the READs sent just before the wrap lost, so that their deadlines
+ * lie past it. The Makefile cuts nfs.c out of its #ifdef into
+ * bin/nfs_host.c, with the longs it builds RPC words in made 32 bits.
+ *
+ * usage: nfstest
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <arpa/inet.h>
+
+struct iphdr {
+	uint8_t verhdrlen, service;
+	uint16_t len, ident, frags;
+	uint8_t ttl, protocol;
+	uint16_t chksum;
+	struct { uint32_t s_addr; } src, dest;
+} __attribute__((packed));
+
+struct udphdr {
+	uint16_t src, dest, len, chksum;
+} __attribute__((packed));
+
+/* what nfs() takes from etherboot.h and the i386 latch.h */
+#define TICKS_PER_SEC		3579545
+#define TIMEOUT			(10*TICKS_PER_SEC)
+#define MAX_RPC_RETRIES		20
+#define ETH_HLEN		14
+#define IP_UDP			17
+#define ARP_CLIENT		0
+#define ARP_SERVER		1
+
+#include "nfs.h"
+
+typedef int (*reply_t)(int ival, void *ptr, unsigned short ptype,
+	struct iphdr *ip, struct udphdr *udp);
+
+static struct { struct { uint32_t s_addr; } ipaddr; } arptable[2];
+static struct { unsigned char packet[2048]; unsigned int packetlen; } nic;
+static char *hostname = "";
+static int hostnamelen;
+
+unsigned long currticks(void);
+static long rfc2131_sleep_interval(long base, int exp) { return base; }
+static void rx_qdrain(void) {}
+static int udp_transmit(unsigned long destip, unsigned int srcsock,
+	unsigned int destsock, int len, const void *buf);
+static int await_reply(reply_t reply, int ival, void *ptr, long timeout);
+
+#include "nfs_host.c"
+
+#define FILE_LEN	(1024 * 1024 + 345)
+#define QUEUE_LEN	64
+#define US		(TICKS_PER_SEC / 1000000.0)
+#define PKT_TICKS	(unsigned long long)(20 * US)	/* a packet in or out */
+#define POLL_TICKS	(unsigned long long)(5 * US)	/* a poll that finds none */
+#define HANG_TICKS	(30ULL * TICKS_PER_SEC)
+
+/* the virtual time, of which the PM timer shows the low 24 bits */
+static unsigned long long vt, hang_at;
+static jmp_buf hung;
+
+unsigned long currticks(void)
+{
+	return vt & 0xffffff;
+}
+
+/* how the server and the wire behave in a run */
+struct run {
+	const char *name;
+	int rtt_us, jitter_us;
+	int lose_req, lose_rep;		/* every that many READs, 0 none */
+	unsigned long long start;	/* the clock at the start */
+	int lose_at_wrap;		/* the READs of the last 5 ms before
+					   the PM timer wraps are lost */
+};
+static const struct run *run;
+
+static unsigned char file[FILE_LEN];
+static unsigned long xid[FILE_LEN / NFS_READ_SIZE + 1];
+static int asked[FILE_LEN / NFS_READ_SIZE + 1];
+static int reads, resent, xid_changed, lost, lost_at_wrap, disordered, latest;
+
+/* the replies on the way to the client, in no order */
+static struct { unsigned long long at; int len, offset; unsigned char d[1600]; } queue[QUEUE_LEN];
+static int nq;
+
+static void reply_add(const uint32_t *rep, int words, int dport, int offset)
+{
+	struct iphdr *ip = (struct iphdr *)(queue[nq].d + ETH_HLEN);
+	struct udphdr *udp = (struct udphdr *)(ip + 1);
+
+	if (nq == QUEUE_LEN)
+		return;
+	memset(queue[nq].d, 0, ETH_HLEN + sizeof(*ip) + sizeof(*udp));
+	ip->dest.s_addr = arptable[ARP_CLIENT].ipaddr.s_addr;
+	udp->dest = htons(dport);
+	memcpy(udp + 1, rep, words * 4);
+	queue[nq].len = ETH_HLEN + sizeof(*ip) + sizeof(*udp) + words * 4;
+	queue[nq].at = vt + run->rtt_us * US +
+		       (run->jitter_us ? rand() % run->jitter_us * US : 0);
+	queue[nq].offset = offset;
+	nq++;
+}
+
+/* a READ of count bytes at offset; the first block is read on its own,
+   with the 10 s timeout of nfs_read(), and is never lost */
+static int read_reply(uint32_t *rep, unsigned long id, int offset, int count)
+{
+	int b = offset / NFS_READ_SIZE;
+	int u = vt & 0xffffff;
+
+	reads++;
+	if (asked[b]++) {
+		resent++;
+		xid_changed += xid[b] != id;
+	}
+	xid[b] = id;
+	if (offset > 0 && run->lose_at_wrap && asked[b] == 1 &&
+	    u > 0xffffff - 5000 * US) {
+		lost_at_wrap++;
+		return 0;
+	}
+	if (offset > 0 && run->lose_req && rand() % run->lose_req == 0) {
+		lost++;
+		return 0;
+	}
+	if (offset > FILE_LEN)
+		offset = FILE_LEN;
+	if (count > FILE_LEN - offset)
+		count = FILE_LEN - offset;
+	memset(rep, 0, 18 * 4);
+	rep[6] = htonl(FILE_LEN);	/* the size in the attributes */
+	rep[18] = htonl(count);
+	memcpy(&rep[19], file + offset, count);
+	if (offset > 0 && run->lose_rep && rand() % run->lose_rep == 0) {
+		lost++;
+		return 0;
+	}
+	return 19 + (count + 3) / 4;
+}
+
+/* the portmapper, mountd and nfsd, as far as nfs() uses them */
+static int udp_transmit(unsigned long destip, unsigned int srcsock,
+	unsigned int destsock, int len, const void *buf)
+{
+	const uint32_t *c = (const uint32_t *)((const char *)buf +
+		sizeof(struct iphdr) + sizeof(struct udphdr));
+	const uint32_t *a;
+	uint32_t rep[6 + 19 + NFS_READ_SIZE / 4];
+	int n = 0, offset = -1;
+
+	vt += PKT_TICKS;
+	/* past the credentials and the verifier */
+	a = c + 6;
+	a += 2 + ntohl(a[1]) / 4;
+	a += 2 + ntohl(a[1]) / 4;
+	rep[0] = c[0];
+	rep[1] = htonl(MSG_REPLY);
+	rep[2] = rep[3] = rep[4] = rep[5] = 0;
+	switch (ntohl(c[3])) {
+	case PROG_PORTMAP:
+		rep[6] = htonl(2049);
+		n = 1;
+		break;
+	case PROG_MOUNT:
+		if (ntohl(c[5]) == MOUNT_ADDENTRY) {
+			rep[6] = 0;
+			memset(&rep[7], 1, NFS_FHSIZE);
+			n = 1 + NFS_FHSIZE / 4;
+		}
+		break;
+	case PROG_NFS:
+		if (ntohl(c[5]) == NFS_LOOKUP) {
+			rep[6] = 0;
+			memset(&rep[7], 2, NFS_FHSIZE);
+			n = 1 + NFS_FHSIZE / 4;
+		} else if (ntohl(c[5]) == NFS_READ) {
+			offset = ntohl(a[NFS_FHSIZE / 4]);
+			n = read_reply(&rep[6], ntohl(c[0]), offset,
+				       ntohl(a[NFS_FHSIZE / 4 + 1]));
+			if (n == 0)
+				return 1;
+		}
+		break;
+	}
+	reply_add(rep, 6 + n, srcsock, offset);
+	return 1;
+}
+
+/* the loop of await_reply() in nic.c, on the queue: the timeout is
+   against plain ticks, as there */
+static int await_reply(reply_t reply, int ival, void *ptr, long timeout)
+{
+	unsigned long time = timeout + currticks();
+	struct iphdr *ip = (struct iphdr *)&nic.packet[ETH_HLEN];
+	struct udphdr *udp = (struct udphdr *)(ip + 1);
+	int i, first, r;
+
+	for (;;) {
+		first = -1;
+		for (i = 0; i < nq; i++)
+			if (first < 0 || queue[i].at < queue[first].at)
+				first = i;
+		if (first >= 0 && queue[first].at <= vt) {
+			vt += PKT_TICKS;
+			memcpy(nic.packet, queue[first].d, queue[first].len);
+			nic.packetlen = queue[first].len;
+			if (queue[first].offset > 0) {
+				if (queue[first].offset < latest)
+					disordered++;
+				else
+					latest = queue[first].offset;
+			}
+			queue[first] = queue[--nq];
+			r = reply(ival, ptr, 0x0800, ip, udp);
+			if (r)
+				return r;
+			continue;
+		}
+		vt += POLL_TICKS;
+		if (vt > hang_at)
+			longjmp(hung, 1);
+		if (timeout == 0 || currticks() > time)
+			return 0;
+	}
+}
+
+static unsigned char got[FILE_LEN];
+static int gotlen, gotall, bad;
+static unsigned int next_block;
+
+static int take(unsigned char *data, unsigned int block, unsigned int len, int eof)
+{
+	if (block != next_block++ || gotall || gotlen + len > FILE_LEN ||
+	    eof != (gotlen + len == FILE_LEN)) {
+		bad++;
+		return 0;
+	}
+	memcpy(got + gotlen, data, len);
+	gotlen += len;
+	gotall = eof;
+	return 1;
+}
+
+int main(void)
+{
+	static const struct run runs[] = {
+		{ "in order",		500,    0,  0,  0, 0, 0 },
+		{ "out of order",	500, 2000,  0,  0, 0, 0 },
+		{ "READs lost",		500,    0, 20,  0, 0, 0 },
+		{ "replies lost",	500, 1000,  0, 20, 0, 0 },
+		{ "timer wraps",	500, 1000, 50,  0, 0xffffff - 20000 * US, 1 },
+	};
+	int i, r, ok = 1, good;
+	double ms;
+
+	for (i = 0; i < FILE_LEN; i++)
+		file[i] = rand();
+	arptable[ARP_CLIENT].ipaddr.s_addr = htonl(0x0a000002);
+	arptable[ARP_SERVER].ipaddr.s_addr = htonl(0x0a000001);
+
+	for (r = 0; r < sizeof(runs) / sizeof(runs[0]); r++) {
+		run = &runs[r];
+		srand(r);
+		vt = run->start;
+		hang_at = vt + HANG_TICKS;
+		nq = 0;
+		memset(asked, 0, sizeof(asked));
+		reads = resent = xid_changed = lost = lost_at_wrap = 0;
+		disordered = latest = 0;
+		gotlen = gotall = bad = 0;
+		next_block = 1;
+
+		if (setjmp(hung) == 0)
+			nfs("/srv/xbox/vmlinuz", take);
+		ms = (vt - run->start) / (TICKS_PER_SEC / 1000.0);
+
+		good = gotall && !bad && gotlen == FILE_LEN && !memcmp(got, file, FILE_LEN) &&
+		       !xid_changed && vt <= hang_at;
+		/* what each run is about did happen */
+		if (run->jitter_us && !disordered)
+			good = 0;
+		if ((run->lose_req || run->lose_rep) && (!lost || !resent))
+			good = 0;
+		if (run->lose_at_wrap && (!lost_at_wrap || vt >> 24 == run->start >> 24))
+			good = 0;
+		printf("%-12s: %-6s %5d READs %4d resent %4d out of order %4d lost, "
+		       "%7.1f ms, %5.2f MB/s\n", run->name,
+		       good ? "ok" : vt > hang_at ? "hung" : "FAILED",
+		       reads, resent, disordered, lost + lost_at_wrap, ms,
+		       FILE_LEN / 1e3 / ms);
+		ok &= good;
+	}
+	printf("nfstest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
@@ -0,0 +1,167 @@
+/*
+ * nicsim - etherboot/drivers/net/forcedeth.c on the build machine, over
+ * an emulated nForce MAC, see nicsim.h. Built on its own, against the
+ * etherboot headers; the host C library stands in for their string.h
+ * and stdint.h, and the register and DMA calls of io.h are defined here.
+ * The Makefile cuts the eth_* calls out of etherboot/core/nic.c into
+ * bin/nic_eth.c, since the rest of nic.c wants a boot.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define STDINT_H
+#define ETHERBOOT_STRING_H
+#define ETHERBOOT_IO_H
+
+/* descriptors hold 32 bit bus addresses, the driver's and lwIP's buffers
+   are all static, so bus addresses count from a little below them */
+static unsigned long nicsim_base;
+
+static unsigned int nicsim_readl(unsigned long addr);
+static void nicsim_writel(unsigned int v, unsigned long addr);
+
+#define readl(a)		nicsim_readl((unsigned long)(a))
+#define writel(v, a)		nicsim_writel((v), (unsigned long)(a))
+#define wmb()			do { } while (0)
+#define virt_to_bus(a)		((unsigned long)(a) - nicsim_base)
+#define bus_to_virt(a)		((void *)((unsigned long)(a) + nicsim_base))
+#define ioremap(a, l)		((void *)(a))
+
+#include "forcedeth.c"
+#include "nicsim.h"
+
+static char packet[ETH_FRAME_LEN + ETH_DATA_ALIGN] __aligned;
+static unsigned char node_addr[ETH_ALEN] = { 0x00, 0x0d, 0xff, 0x00, 0x00, 0x01 };
+struct nic nic;
+
+#include "nic_eth.c"
+
+static u32 regs[0x200 / 4];
+/* the next descriptors the NIC takes */
+static unsigned int hw_rx, hw_tx;
+
+void (*nicsim_tx)(const unsigned char *frame, int len);
+long nicsim_sent;
+int nicsim_tx_stalled;
+long nicsim_udelay;
+
+/* sends what the driver queued */
+static void nicsim_tx_run(void)
+{
+	struct ring_desc *d;
+
+	if (nicsim_tx_stalled)
+		return;
+	for (;;) {
+		d = &tx_ring[hw_tx % TX_RING];
+		if (!(d->Flags & NV_TX_VALID))
+			return;
+		if (nicsim_tx)
+			nicsim_tx(bus_to_virt(d->PacketBuffer), d->Length + 1);
+		nicsim_sent++;
+		d->Flags &= ~NV_TX_VALID;
+		hw_tx++;
+	}
+}
+
+static unsigned int nicsim_readl(unsigned long addr)
+{
+	return regs[(addr - BASE) / 4];
+}
+
+static void nicsim_writel(unsigned int v, unsigned long addr)
+{
+	switch (addr - BASE) {
+	case NvRegIrqStatus:
+		/* write one to clear */
+		regs[NvRegIrqStatus / 4] &= ~v;
+		break;
+	case NvRegTxRxControl:
+		if (v & NVREG_TXRXCTL_KICK)
+			nicsim_tx_run();
+		break;
+	default:
+		regs[(addr - BASE) / 4] = v;
+	}
+}
+
+/* the driver waits on the NIC, which goes on meanwhile */
+void udelay(unsigned int usecs)
+{
+	nicsim_udelay += usecs;
+	nicsim_tx_run();
+}
+
+int nicsim_deliver(const void *frame, int len)
+{
+	struct ring_desc *d = &rx_ring[hw_rx % RX_RING];
+
+	if (!(d->Flags & NV_RX_AVAIL)) {
+		regs[NvRegIrqStatus / 4] |= NVREG_IRQ_RX_NOBUF;
+		return 0;
+	}
+	if (len > d->Length) {
+		/* too long for the buffer, counted as a bad frame */
+		d->Flags = NV_RX_DESCRIPTORVALID | NV_RX_ERROR | NV_RX_CRCERR;
+	} else {
+		memcpy(bus_to_virt(d->PacketBuffer), frame, len);
+		d->Length = len;
+		d->Flags = NV_RX_DESCRIPTORVALID;
+	}
+	hw_rx++;
+	return 1;
+}
+
+int nicsim_rx_armed(void)
+{
+	int i, n = 0;
+
+	for (i = 0; i < RX_RING; i++)
+		if (rx_ring[i].Flags & NV_RX_AVAIL)
+			n++;
+	return n;
+}
+
+void nicsim_init(void)
+{
+	int i;
+
+	nicsim_base = ((unsigned long)regs & ~0xffffffUL) - 0x40000000UL;
+	memset(regs, 0, sizeof(regs));
+	hw_rx = hw_tx = 0;
+	nicsim_sent = 0;
+	nicsim_tx_stalled = 0;
+	nicsim_udelay = 0;
+
+	memset(&nic, 0, sizeof(nic));
+	nic.node_addr = node_addr;
+	nic.packet = (unsigned char *)packet + ETH_DATA_ALIGN;
+	memcpy(forcedeth_hw_addr, node_addr, ETH_ALEN);
+	for (i = 0; i < RX_RING; i++) {
+		rx_buf[i] = NULL;
+		rx_cookie[i] = NULL;
+	}
+
+	/* what forcedeth_probe sets up */
+	np = &npx;
+	BASE = (unsigned long)regs;
+	np->tx_flags = cpu_to_le16(NV_TX_LASTPACKET | NV_TX_LASTPACKET1 |
+				   NV_TX_VALID);
+	nic.poll = forcedeth_poll;
+	nic.poll_buffer = forcedeth_poll_buffer;
+	nic.transmit = forcedeth_transmit;
+	nic.transmit_frags = forcedeth_transmit_frags;
+	init_ring(&nic);
+}
+
+void nicsim_no_gather(void)
+{
+	nic.transmit_frags = NULL;
+}
+
+/* what the probe calls, which is never run */
+int printk(const char *fmt, ...) { return 0; }
+unsigned long pci_bar_start(struct pci_device *pci, unsigned int bar) { return 0; }
+unsigned long pci_bar_size(struct pci_device *pci, unsigned int bar) { return 0; }
+void adjust_pci_device(struct pci_device *pci) {}
@@ -0,0 +1,32 @@
+/*
+ * nicsim - etherboot/drivers/net/forcedeth.c and the eth_* calls of
+ * etherboot/core/nic.c built for the build machine, over an emulation of
+ * the nForce MAC: its registers, and DMA through the rx and tx
+ * descriptor rings. See nicsim.c. The tests include lwip/ebd.c and reach
+ * the driver through the eth_* calls, as in the BIOS.
+ */
+
+#ifndef _HOSTTEST_NICSIM_H_
+#define _HOSTTEST_NICSIM_H_
+
+/* sets the driver up as forcedeth_probe does, without the PCI and PHY
+   parts, and with all rx descriptors on the driver's own buffers */
+void nicsim_init(void);
+/* the driver cannot gather, so eth_transmit_frags returns -1 */
+void nicsim_no_gather(void);
+
+/* a frame off the wire into the next rx descriptor the driver armed;
+   returns 0 if there was none, the NIC then flags an rx ring overrun */
+int nicsim_deliver(const void *frame, int len);
+/* rx descriptors armed for the NIC */
+int nicsim_rx_armed(void);
+
+/* called with each frame the NIC sends, and the number sent */
+extern void (*nicsim_tx)(const unsigned char *frame, int len);
+extern long nicsim_sent;
+/* the NIC leaves the tx descriptors alone while this is set */
+extern int nicsim_tx_stalled;
+/* microseconds the driver spent in udelay */
+extern long nicsim_udelay;
+
+#endif
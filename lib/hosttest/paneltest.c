@@ -0,0 +1,251 @@
+/*
+ * paneltest - runs lwip/netpanel.c over a framebuffer in memory, built
+ * once with NET_STATUS_PANEL defined and once without; the Makefile
+ * renames the calls of the second build to netpanel_*_off. Checks that
+ * the panel shows what it is given, and that a pass stops drawing once
+ * it is over its time budget. Then times netpanel_poll both ways, for a
+ * pass with nothing to do and for a pass that brings the panel up to
+ * date, as happens twice a second.
+ *
+ * usage: paneltest
+ */
+
+#include <time.h>
+#include "boot.h"
+#include "video.h"
+#include "memory_layout.h"
+#include "fontx13.h"
+#include "lwip/stats.h"
+#include "ebd.h"
+#include "netpanel.h"
+
+#define WIDTH		640
+#define HEIGHT		480
+#define LINES		6	/* NETPANEL_LINES */
+#define INTERVAL	500	/* NETPANEL_INTERVAL, in ms */
+#define ICON_HEIGH	64	/* include/boot.h */
+#define IDLE_PASSES	20000000
+#define REFRESHES	20000
+
+void netpanel_poll_off(struct netif *netif, u32_t now);
+void netpanel_progress_off(u32_t len);
+
+struct stats_ lwip_stats;
+static struct nic_stats nic_stats;
+struct nic_stats *eth_stats(void) { return &nic_stats; }
+
+/* PM timer ticks from the host clock, skew moves it on */
+static u32_t skew;
+
+u32_t ebd_clock(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (u32_t)(((unsigned long long)t.tv_sec * 1000000 + t.tv_nsec / 1000) *
+		       EBD_TICKS_PER_MS / 1000) + skew;
+}
+
+/* the screen, with a backdrop as tall as the real one's icon allows for */
+char mem_framebuffer[WIDTH * HEIGHT * 4];
+static BYTE backdrop[WIDTH * (HEIGHT + ICON_HEIGH) * 3];
+JPEG jpegBackdrop = { backdrop, WIDTH, HEIGHT + ICON_HEIGH, 3 };
+CURRENT_VIDEO_MODE_DETAILS currentvideomodedetails = { WIDTH, HEIGHT, 32, 24 };
+DWORD VIDEO_CURSOR_POSX, VIDEO_CURSOR_POSY;
+
+/* what the panel drew on which line, and how long a line takes */
+static char text[LINES][80];
+static long draws;
+static u32_t line_ticks;
+
+/* the drawing of drivers/video/BootVideoHelpers.c, without its tabs and
+   double size letters */
+static int BootVideoOverlayCharacter(DWORD * pdwaTopLeftDestination,
+	DWORD m_dwCountBytesPerLineDestination, RGBA rgbaColourAndOpaqueness,
+	BYTE bCharacter)
+{
+	BYTE *pbaDestStart = (BYTE *)pdwaTopLeftDestination;
+	int y, i;
+
+	if (bCharacter < '!' || bCharacter > '~')
+		return font8x8_basic_width;
+	for (y = font8x8_basic_height - 1; y >= 0; y--) {
+		BYTE *pbaDest = pbaDestStart;
+		BYTE b = font8x8_basic[bCharacter][y];
+		for (i = font8x8_basic_width - 1; i >= 0; i--) {
+			if ((b >> i) & 0x01) {
+				pbaDest[0] = (rgbaColourAndOpaqueness >> 0) & 0xFF;
+				pbaDest[1] = (rgbaColourAndOpaqueness >> 8) & 0xFF;
+				pbaDest[2] = (rgbaColourAndOpaqueness >> 16) & 0xFF;
+				pbaDest[3] = (rgbaColourAndOpaqueness >> 24) & 0xFF;
+			}
+			pbaDest += sizeof(DWORD);
+		}
+		pbaDestStart += m_dwCountBytesPerLineDestination;
+	}
+	return font8x8_basic_width;
+}
+
+int BootVideoOverlayString(DWORD * pdwaTopLeftDestination, DWORD m_dwCountBytesPerLineDestination, RGBA rgbaOpaqueness, const char * szString)
+{
+	int y = ((char *)pdwaTopLeftDestination - mem_framebuffer) / (WIDTH * 4);
+	int line = LINES - (HEIGHT - 24 - y) / (font8x8_basic_height + 2);
+	unsigned int uiWidth = 0;
+	u32_t start = ebd_clock();
+
+	if (line >= 0 && line < LINES)
+		snprintf(text[line], sizeof(text[line]), "%s", szString);
+	draws++;
+	while (*szString != 0 && *szString != '\n')
+		uiWidth += BootVideoOverlayCharacter(pdwaTopLeftDestination + uiWidth,
+			m_dwCountBytesPerLineDestination, rgbaOpaqueness, *szString++);
+	/* as slow as asked for */
+	while (ebd_clock() - start < line_ticks)
+		;
+	return uiWidth;
+}
+
+void BootVideoClearScreen(JPEG * pJpeg, int nStartLine, int nEndLine)
+{
+	DWORD *pdw = (DWORD *)FRAMEBUFFER_START + WIDTH * nStartLine;
+	BYTE *pb = pJpeg->m_pBitmapData + ICON_HEIGH / 2 * pJpeg->m_nWidth * 3 +
+		   pJpeg->m_nWidth * 3 * nStartLine;
+	int n;
+
+	VIDEO_CURSOR_POSX = currentvideomodedetails.m_dwMarginXInPixelsRecommended;
+	VIDEO_CURSOR_POSY = currentvideomodedetails.m_dwMarginYInLinesRecommended;
+	if (nEndLine >= HEIGHT)
+		nEndLine = HEIGHT - 1;
+	while (nStartLine++ < nEndLine) {
+		for (n = 0; n < WIDTH; n++, pb += 3)
+			pdw[n] = 0xff000000 | pb[2] | (pb[1] << 8) | (pb[0] << 16);
+		pdw += WIDTH;
+	}
+}
+
+static struct netif netif;
+
+/* passes until one has nothing left to draw, returns the most lines
+   a pass drew */
+static int drain(void (*poll)(struct netif *netif, u32_t now), int *passes)
+{
+	long before;
+	int most = 0;
+
+	*passes = 0;
+	do {
+		before = draws;
+		poll(&netif, ebd_clock());
+		if (draws - before > most)
+			most = draws - before;
+		++*passes;
+	} while (draws != before);
+	return most;
+}
+
+/* the panel shows what it is told */
+static int shows(void)
+{
+	struct ip_addr peer;
+	int passes;
+
+	drain(netpanel_poll, &passes);
+	if (strcmp(text[0], "IP 10.0.0.2 (fallback)") != 0 ||
+	    strcmp(text[1], "Waiting for an upload") != 0 ||
+	    strcmp(text[2], "Received 0 KB, 0 KB/s") != 0)
+		return 0;
+
+	IP4_ADDR(&peer, 10, 0, 0, 1);
+	netpanel_transfer("Upload", &peer, 1024 * 1024);
+	netpanel_progress(512 * 1024);
+	skew += INTERVAL * EBD_TICKS_PER_MS;
+	drain(netpanel_poll, &passes);
+	return strcmp(text[1], "Upload from 10.0.0.1") == 0 &&
+	       strncmp(text[2], "Received 512 KB, ", 17) == 0 &&
+	       strcmp(text[3], "Transfer 512 of 1024 KB (49%)") == 0;
+}
+
+/* lines of 400 us, so a pass of 1000 us has room for three */
+static int budget(void)
+{
+	int most, passes;
+
+	line_ticks = 400 * EBD_TICKS_PER_MS / 1000;
+	IP4_ADDR(&netif.ip_addr, 10, 0, 0, 3);
+	netpanel_transfer("Download", NULL, 0);
+	netpanel_progress(1024 * 1024);
+	skew += INTERVAL * EBD_TICKS_PER_MS;
+	most = drain(netpanel_poll, &passes);
+	line_ticks = 0;
+	return most <= 3 && passes >= 3 &&
+	       strcmp(text[0], "IP 10.0.0.3 (fallback)") == 0 &&
+	       strcmp(text[1], "Download from 10.0.0.1") == 0 &&
+	       strcmp(text[3], "Transfer 1024 KB") == 0;
+}
+
+static double cpu(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* a pass with nothing due, then one with the panel due, while a
+   transfer goes on; returns the lines it drew */
+static long bench(const char *how, void (*poll)(struct netif *netif, u32_t now),
+		  void (*progress)(u32_t len))
+{
+	long before = draws;
+	double t, idle, refresh = 0, most = 0;
+	u32_t now = ebd_clock();
+	int i, passes;
+
+	poll(&netif, now);
+	t = cpu();
+	for (i = 0; i < IDLE_PASSES; i++)
+		poll(&netif, now);
+	idle = (cpu() - t) / IDLE_PASSES;
+
+	for (i = 0; i < REFRESHES; i++) {
+		progress(1460 * 64);
+		skew += INTERVAL * EBD_TICKS_PER_MS;
+		t = cpu();
+		drain(poll, &passes);
+		t = cpu() - t;
+		refresh += t;
+		if (t > most)
+			most = t;
+	}
+	refresh /= REFRESHES;
+	printf("%-10s %4.1f ns a pass, %6.2f us a refresh (at most %7.2f), "
+	       "%.4f%% of the CPU\n", how, idle * 1e9, refresh * 1e6, most * 1e6,
+	       refresh * 1000 / INTERVAL * 100);
+	return draws - before;
+}
+
+int main(void)
+{
+	int ok = 1, r, i;
+
+	for (i = 0; i < sizeof(backdrop); i++)
+		backdrop[i] = i * 7;
+	IP4_ADDR(&netif.ip_addr, 10, 0, 0, 2);
+
+	r = shows();
+	printf("panel shows the transfer: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = budget();
+	printf("drawing kept to the budget: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	r = bench("panel", netpanel_poll, netpanel_progress) > 0;
+	printf("panel redrawn: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = bench("no panel", netpanel_poll_off, netpanel_progress_off) == 0;
+	printf("nothing drawn without the panel: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	printf("paneltest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
@@ -0,0 +1,253 @@
+/*
+ * rxtest - receives with lwip/ebd.c from etherboot/drivers/net/forcedeth.c
+ * over the emulated NIC of nicsim.c, first copying each frame out of the
+ * driver's buffers, then with the driver receiving straight into pool
+ * pbufs. Checks that every frame comes up whole and in order, that an
+ * overrun of the rx ring is counted, and that with the pool used up the
+ * driver drops frames but keeps its ring armed, and picks up again once
+ * the pbufs come back. Then times ebd_input for both ways, in MB/s and
+ * CPU time per MB.
+ *
+ * usage: rxtest
+ */
+
+#include <time.h>
+#include "httpd.h"
+#include "ebd.c"
+#include "nicsim.h"
+
+#define RX_RING		32	/* FORCEDETH_RX_RING */
+#define BATCH		16	/* frames that arrive between two polls */
+#define BENCH_FRAMES	400000
+
+/* the stack above ebd_input, which is rx_input here */
+void dhcp_fine_tmr(void) {}
+void dhcp_coarse_tmr(void) {}
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr,
+	struct ip_addr *server) { return ERR_OK; }
+void dhcp_stop(struct netif *netif) {}
+void httpd_init(void) {}
+void fleet_init(void) {}
+void fleet_tmr(void) {}
+void httpboot_start(struct netif *netif) {}
+void httpboot_poll(void) {}
+void netpanel_poll(struct netif *netif, u32_t now) {}
+void netcfg_load(struct netcfg *cfg) {}
+void netcfg_save(const struct netcfg *cfg) {}
+unsigned long currticks(void) { return 0; }
+
+static struct netif netif;
+static unsigned char frame[EBD_FRAME_LEN];
+
+/* what rx_input got */
+static struct pbuf *held[PBUF_POOL_SIZE];
+static int holding, nheld, verify, bad;
+static u32_t next_seq;
+static long got, lost;
+
+/* frame seq, len bytes long: to us from 10.0.0.1, with an IP header
+   and then seq and bytes that depend on it */
+static void make_frame(u32_t seq, int len)
+{
+	struct ip_hdr *iphdr = (struct ip_hdr *)&frame[14];
+	int i;
+
+	memcpy(frame, forcedeth_hw_addr, 6);
+	memset(frame + 6, 0x02, 6);
+	frame[12] = 0x08;
+	frame[13] = 0x00;
+	memset(iphdr, 0, IP_HLEN);
+	IPH_VHLTOS_SET(iphdr, 4, IP_HLEN / 4, 0);
+	IPH_LEN_SET(iphdr, htons(len - 14));
+	IPH_TTL_SET(iphdr, 64);
+	IPH_PROTO_SET(iphdr, IP_PROTO_UDP);
+	IP4_ADDR(&iphdr->src, 10, 0, 0, 1);
+	iphdr->dest = netif.ip_addr;
+	IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, IP_HLEN));
+	memcpy(&frame[14 + IP_HLEN], &seq, 4);
+	for (i = 14 + IP_HLEN + 4; i < len; i++)
+		frame[i] = seq + i;
+}
+
+static err_t rx_input(struct pbuf *p, struct netif *inp)
+{
+	u32_t seq;
+
+	memcpy(&seq, (u8_t *)p->payload + IP_HLEN, 4);
+	if (seq < next_seq || p->next != NULL)
+		bad++;
+	lost += seq - next_seq;
+	next_seq = seq + 1;
+	if (verify) {
+		make_frame(seq, 14 + p->tot_len);
+		if (memcmp(p->payload, &frame[14], p->tot_len) != 0)
+			bad++;
+	}
+	got++;
+	if (holding)
+		held[nheld++] = p;
+	else
+		pbuf_free(p);
+	return ERR_OK;
+}
+
+static void release(void)
+{
+	while (nheld > 0)
+		pbuf_free(held[--nheld]);
+}
+
+/* frames of every length, a batch at a time */
+static int whole(void)
+{
+	u32_t seq = next_seq;
+	int len, n;
+
+	verify = 1;
+	got = lost = bad = 0;
+	for (len = 60; len <= EBD_FRAME_LEN; len += n) {
+		for (n = 0; n < BATCH && len + n <= EBD_FRAME_LEN; n++) {
+			make_frame(seq++, len + n);
+			nicsim_deliver(frame, len + n);
+		}
+		ebd_input(&netif);
+	}
+	verify = 0;
+	return got == EBD_FRAME_LEN - 60 + 1 && lost == 0 && bad == 0;
+}
+
+/* the ring overruns while nobody polls */
+static int overrun(void)
+{
+	struct nic_stats *stats = eth_stats();
+	unsigned long nobuf = stats->rx_nobuf;
+	u32_t seq = next_seq;
+	int i, taken = 0;
+
+	got = lost = bad = 0;
+	for (i = 0; i < RX_RING + 8; i++) {
+		make_frame(seq++, EBD_FRAME_LEN);
+		taken += nicsim_deliver(frame, EBD_FRAME_LEN);
+	}
+	while (ebd_input(&netif) > 0)
+		;
+	/* the ones the NIC had no room for are missed by the stack too */
+	next_seq = seq;
+	return taken == RX_RING && got == RX_RING && bad == 0 &&
+	       stats->rx_nobuf == nobuf + 1 && nicsim_rx_armed() == RX_RING;
+}
+
+/* the stack keeps the frames until the pool runs out */
+static int exhaust(void)
+{
+	struct nic_stats *stats = eth_stats();
+	unsigned long dropped = stats->rx_dropped;
+	u32_t seq = next_seq;
+	int i, j, armed = 1;
+
+	got = bad = 0;
+	holding = 1;
+	for (i = 0; i < 10; i++) {
+		for (j = 0; j < BATCH; j++) {
+			make_frame(seq++, EBD_FRAME_LEN);
+			nicsim_deliver(frame, EBD_FRAME_LEN);
+		}
+		ebd_input(&netif);
+		armed &= nicsim_rx_armed() == RX_RING;
+	}
+	holding = 0;
+	dropped = stats->rx_dropped - dropped;
+	printf("pool of %d used up: %ld frames kept, %lu dropped\n",
+	       PBUF_POOL_SIZE, got, dropped);
+	if (!armed || bad || got != nheld || got + dropped != 10 * BATCH ||
+	    dropped == 0)
+		return 0;
+
+	/* and once they are back nothing is dropped any more */
+	release();
+	dropped = stats->rx_dropped;
+	got = 0;
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < BATCH; j++) {
+			make_frame(seq++, EBD_FRAME_LEN);
+			nicsim_deliver(frame, EBD_FRAME_LEN);
+		}
+		ebd_input(&netif);
+	}
+	return got == 4 * BATCH && bad == 0 && stats->rx_dropped == dropped;
+}
+
+static double cpu(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* full frames, as in a download, BATCH to a poll */
+static void bench(const char *how)
+{
+	double t = 0, t0, mb;
+	u32_t seq = next_seq;
+	int i, j;
+
+	got = lost = bad = 0;
+	for (i = 0; i < BENCH_FRAMES / BATCH; i++) {
+		for (j = 0; j < BATCH; j++) {
+			make_frame(seq++, EBD_FRAME_LEN);
+			nicsim_deliver(frame, EBD_FRAME_LEN);
+		}
+		t0 = cpu();
+		ebd_input(&netif);
+		t += cpu() - t0;
+	}
+	mb = (double)got * EBD_FRAME_LEN / 1e6;
+	printf("%-10s %7.1f MB/s, %5.0f us CPU per MB\n", how, mb / t, t / mb * 1e6);
+}
+
+int main(void)
+{
+	struct ip_addr ipaddr, netmask, gw;
+	int ok = 1, r;
+
+	nicsim_init();
+	stats_init();
+	mem_init();
+	memp_init();
+	pbuf_init();
+	netif_init();
+	etharp_init();
+	IP4_ADDR(&ipaddr, 10, 0, 0, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	IP4_ADDR(&gw, 0, 0, 0, 0);
+	netif_add(&netif, &ipaddr, &netmask, &gw, NULL, ebd_init, rx_input);
+
+	/* copying out of the driver's buffers */
+	r = whole();
+	printf("copied, every length: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	bench("copied");
+
+	/* lending it pbufs, the frames already in the ring are copied once */
+	ebd_zero_copy = eth_rx_buffers(ebd_rx_alloc, ebd_rx_free,
+				       PBUF_POOL_BUFSIZE - EBD_RX_ALIGN);
+	r = ebd_zero_copy && whole();
+	printf("zero copy, every length: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = overrun();
+	printf("rx ring overrun: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = exhaust();
+	printf("pbuf pool used up: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	bench("zero copy");
+
+	/* nothing but the ring's own pbufs left out of the pool */
+	r = lwip_stats.pbuf.used == RX_RING && nheld == 0;
+	printf("no pbufs leaked: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	printf("rxtest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
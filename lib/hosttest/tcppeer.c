@@ -0,0 +1,575 @@
+/*
+ * tcppeer - a TCP client and the wire between it and lwIP on the build
+ * machine, in virtual time. The wire has a bit rate and a delay each
+ * way. The client does slow start, delayed ACKs once past the first
+ * few segments (as Linux does), a persist timer and a go-back-N
+ * retransmit, which is all a test of the box needs. The host
+ * time the box spends in box_input and box_poll is measured and added
+ * to the virtual clock, peer_slow times over for a CPU that many times
+ * slower than the build machine's.
+ *
+ * Nothing is lost on the wire, only the box may drop what it cannot
+ * take.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tcppeer.h"
+
+#define TH_FIN	0x01
+#define TH_SYN	0x02
+#define TH_RST	0x04
+#define TH_PSH	0x08
+#define TH_ACK	0x10
+
+#define SEQ_LT(a, b)	((int32_t)((a) - (b)) < 0)
+#define SEQ_LEQ(a, b)	((int32_t)((a) - (b)) <= 0)
+
+#define PEER_WND	65535
+#define DELACK		(40 * PEER_MS)
+#define PERSIST		(200 * PEER_MS)
+#define RTO_MIN		(200 * PEER_MS)
+#define QUICKACKS	16	/* segments ACKed at once on a new connection */
+
+struct packet {
+	struct packet *next;
+	uint64_t at;		/* when it has arrived */
+	int len;
+	unsigned char data[PEER_MTU];
+};
+
+struct wire {
+	struct packet *head, *tail;
+	uint64_t free;		/* when the sender is done with the last one */
+};
+
+uint64_t peer_now;
+uint64_t peer_rate = 100000000;
+uint64_t peer_delay = 100000;	/* 0.1ms, one switch */
+int peer_slow = 1;
+struct peer_counts peer_counts;
+
+static struct wire to_box, to_peer;
+static struct peer_conn *conns[4];
+static uint16_t next_lport = 40000;
+static uint16_t ip_id;
+
+static int in_box;
+static uint64_t box_host0, box_virt0;
+
+static uint64_t host_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+uint64_t peer_clock(void)
+{
+	if (!in_box)
+		return peer_now;
+	return box_virt0 + (host_ns() - box_host0) * peer_slow;
+}
+
+static void box_enter(void)
+{
+	in_box = 1;
+	box_virt0 = peer_now;
+	box_host0 = host_ns();
+}
+
+static void box_leave(void)
+{
+	uint64_t t = peer_clock();
+
+	peer_counts.box_ns += t - peer_now;
+	peer_now = t;
+	in_box = 0;
+}
+
+/* an ethernet frame of len bytes of IP takes the header, the padding
+   to 60, the FCS, the preamble and the gap on the wire */
+static void wire_send(struct wire *w, const unsigned char *data, int len, uint64_t now)
+{
+	struct packet *p = malloc(sizeof(*p));
+	int bytes = (len + 14 < 60 ? 60 : len + 14) + 4 + 8 + 12;
+
+	if (w->free < now)
+		w->free = now;
+	w->free += bytes * 8 * 1000000000ULL / peer_rate;
+	p->at = w->free + peer_delay;
+	p->len = len;
+	memcpy(p->data, data, len);
+	p->next = NULL;
+	if (w->tail != NULL)
+		w->tail->next = p;
+	else
+		w->head = p;
+	w->tail = p;
+}
+
+static struct packet *wire_due(struct wire *w)
+{
+	struct packet *p = w->head;
+
+	if (p == NULL || p->at > peer_now)
+		return NULL;
+	w->head = p->next;
+	if (w->head == NULL)
+		w->tail = NULL;
+	return p;
+}
+
+static void wire_flush(struct wire *w)
+{
+	struct packet *p;
+
+	while ((p = w->head) != NULL) {
+		w->head = p->next;
+		free(p);
+	}
+	w->tail = NULL;
+	w->free = 0;
+}
+
+static void put16(unsigned char *p, uint32_t v)
+{
+	p[0] = v >> 8;
+	p[1] = v;
+}
+
+static void put32(unsigned char *p, uint32_t v)
+{
+	put16(p, v >> 16);
+	put16(p + 2, v);
+}
+
+static uint32_t get16(const unsigned char *p)
+{
+	return p[0] << 8 | p[1];
+}
+
+static uint32_t get32(const unsigned char *p)
+{
+	return get16(p) << 16 | get16(p + 2);
+}
+
+static uint32_t sum(uint32_t acc, const unsigned char *p, int len)
+{
+	for (; len > 1; p += 2, len -= 2)
+		acc += get16(p);
+	if (len)
+		acc += p[0] << 8;
+	return acc;
+}
+
+static uint16_t fold(uint32_t acc)
+{
+	while (acc >> 16)
+		acc = (acc & 0xffff) + (acc >> 16);
+	return ~acc;
+}
+
+/* the TCP checksum over the pseudo header and the segment */
+static uint16_t tcp_sum(const unsigned char *ip, int len)
+{
+	int hl = (ip[0] & 15) * 4;
+	uint32_t acc = sum(0, ip + 12, 8) + 6 + len - hl;
+
+	return fold(sum(acc, ip + hl, len - hl));
+}
+
+static void send_segment(struct peer_conn *c, uint32_t seq, int flags,
+			 const unsigned char *data, int len)
+{
+	unsigned char pkt[PEER_MTU];
+	int hl = flags & TH_SYN ? 24 : 20;
+	unsigned char *th = pkt + 20;
+
+	memset(pkt, 0, 20 + hl);
+	pkt[0] = 0x45;
+	put16(pkt + 2, 20 + hl + len);
+	put16(pkt + 4, ip_id++);
+	pkt[8] = 64;
+	pkt[9] = 6;
+	put32(pkt + 12, PEER_ADDR);
+	put32(pkt + 16, BOX_ADDR);
+	put16(pkt + 10, fold(sum(0, pkt, 20)));
+
+	put16(th, c->lport);
+	put16(th + 2, c->port);
+	put32(th + 4, seq);
+	if (flags & TH_ACK)
+		put32(th + 8, c->rcv_nxt);
+	th[12] = hl / 4 << 4;
+	th[13] = flags;
+	put16(th + 14, PEER_WND);
+	if (flags & TH_SYN) {
+		th[20] = 2;
+		th[21] = 4;
+		put16(th + 22, PEER_MTU - 40);
+	}
+	memcpy(th + hl, data, len);
+	put16(th + 16, tcp_sum(pkt, 20 + hl + len));
+
+	wire_send(&to_box, pkt, 20 + hl + len, peer_now);
+	peer_counts.to_box++;
+	if (flags & TH_ACK) {
+		if (c->unacked && c->quickacks > 0)
+			c->quickacks--;
+		c->unacked = 0;
+		c->ack_at = 0;
+	}
+}
+
+static void send_ack(struct peer_conn *c)
+{
+	send_segment(c, c->snd_nxt, TH_ACK, NULL, 0);
+}
+
+/* sends what the windows allow */
+static void output(struct peer_conn *c)
+{
+	if (c->state != PEER_ESTABLISHED)
+		return;
+
+	while (!c->fin_sent) {
+		uint32_t sent = c->snd_nxt - c->iss - 1;
+		uint32_t inflight = c->snd_nxt - c->snd_una;
+		uint32_t limit = c->wnd < c->cwnd ? c->wnd : c->cwnd;
+		uint32_t n = c->txlen - sent;
+
+		if (n > c->mss)
+			n = c->mss;
+		if (n == 0) {
+			if (c->closing) {
+				send_segment(c, c->snd_nxt++, TH_FIN | TH_ACK, NULL, 0);
+				c->fin_sent = 1;
+				if (SEQ_LT(c->snd_max, c->snd_nxt))
+					c->snd_max = c->snd_nxt;
+				if (!c->rto_at)
+					c->rto_at = peer_now + c->rto;
+			}
+			break;
+		}
+		if (inflight + n > limit) {
+			/* a closed window is probed once the persist timer runs out */
+			if (inflight == 0 && c->wnd < n && !c->persist_at)
+				c->persist_at = peer_now + PERSIST;
+			break;
+		}
+		send_segment(c, c->snd_nxt, TH_ACK | (sent + n == c->txlen ? TH_PSH : 0),
+			     c->tx + sent, n);
+		c->snd_nxt += n;
+		if (SEQ_LT(c->snd_max, c->snd_nxt))
+			c->snd_max = c->snd_nxt;
+		c->persist_at = 0;
+		if (!c->rto_at)
+			c->rto_at = peer_now + c->rto;
+	}
+}
+
+/* go back to the first unacknowledged byte */
+static void rewind_to_una(struct peer_conn *c)
+{
+	if (c->snd_nxt == c->snd_una)
+		return;
+	peer_counts.retransmits++;
+	c->snd_nxt = c->snd_una;
+	if (c->fin_sent && SEQ_LEQ(c->snd_una, c->iss + 1 + c->txlen))
+		c->fin_sent = 0;
+	c->cwnd = c->mss;
+	c->dupacks = 0;
+}
+
+static struct peer_conn *find_conn(uint16_t port, uint16_t lport)
+{
+	int i;
+
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++)
+		if (conns[i] != NULL && conns[i]->port == port && conns[i]->lport == lport)
+			return conns[i];
+	return NULL;
+}
+
+static void peer_input(const unsigned char *pkt, int len)
+{
+	const unsigned char *th;
+	struct peer_conn *c;
+	uint32_t seq, ack, wnd;
+	int hl, thl, flags, dlen, i;
+
+	hl = (pkt[0] & 15) * 4;
+	if (len < 40 || get16(pkt + 2) != len || pkt[9] != 6 ||
+	    fold(sum(0, pkt, hl)) != 0 || tcp_sum(pkt, len) != 0) {
+		peer_counts.bad_sums++;
+		return;
+	}
+	th = pkt + hl;
+	c = find_conn(get16(th), get16(th + 2));
+	if (c == NULL || c->state == PEER_CLOSED)
+		return;
+
+	seq = get32(th + 4);
+	ack = get32(th + 8);
+	thl = (th[12] >> 4) * 4;
+	flags = th[13];
+	wnd = get16(th + 14);
+	dlen = len - hl - thl;
+
+	if (flags & TH_RST) {
+		c->reset = 1;
+		c->state = PEER_CLOSED;
+		return;
+	}
+
+	if (c->state == PEER_SYN_SENT) {
+		if ((flags & (TH_SYN | TH_ACK)) != (TH_SYN | TH_ACK) || ack != c->iss + 1)
+			return;
+		c->mss = 536;
+		for (i = 20; i + 4 <= thl; i += th[i] > 1 ? th[i + 1] : 1)
+			if (th[i] == 2)
+				c->mss = get16(th + i + 2);
+			else if (th[i] == 0)
+				break;
+		if (c->mss > PEER_MTU - 40)
+			c->mss = PEER_MTU - 40;
+		c->rcv_nxt = seq + 1;
+		c->snd_una = c->snd_nxt = c->snd_max = ack;
+		c->wnd = wnd;
+		c->cwnd = 10 * c->mss;
+		c->rto_at = 0;
+		c->state = PEER_ESTABLISHED;
+		send_ack(c);
+		output(c);
+		return;
+	}
+
+	if (flags & TH_ACK) {
+		if (SEQ_LT(c->snd_una, ack) && SEQ_LEQ(ack, c->snd_max)) {
+			uint32_t acked = ack - c->snd_una;
+
+			c->snd_una = ack;
+			if (SEQ_LT(c->snd_nxt, ack))
+				c->snd_nxt = ack;
+			c->cwnd += acked < c->mss ? acked : c->mss;
+			if (c->cwnd > 1 << 20)
+				c->cwnd = 1 << 20;
+			c->dupacks = 0;
+			c->rto = RTO_MIN;
+			c->rto_at = c->snd_una == c->snd_max ? 0 : peer_now + c->rto;
+		} else if (ack == c->snd_una && dlen == 0 && wnd == c->wnd &&
+			   c->snd_nxt != c->snd_una && ++c->dupacks == 3) {
+			rewind_to_una(c);
+		}
+		c->wnd = wnd;
+	}
+
+	if (dlen > 0) {
+		if (seq == c->rcv_nxt && !c->fin_rcvd) {
+			if (c->rxlen + dlen > c->rxcap) {
+				c->rxcap = (c->rxlen + dlen) * 2;
+				c->rx = realloc(c->rx, c->rxcap);
+			}
+			memcpy(c->rx + c->rxlen, th + thl, dlen);
+			c->rxlen += dlen;
+			c->rcv_nxt += dlen;
+			if (++c->unacked >= 2 || c->quickacks > 0)
+				send_ack(c);
+			else if (!c->ack_at)
+				c->ack_at = peer_now + DELACK;
+		} else {
+			send_ack(c);
+		}
+	}
+
+	if ((flags & TH_FIN) && seq + dlen == c->rcv_nxt && !c->fin_rcvd) {
+		c->fin_rcvd = 1;
+		c->rcv_nxt++;
+		send_ack(c);
+	}
+
+	if (c->fin_sent && c->fin_rcvd && c->snd_una == c->snd_max)
+		c->state = PEER_CLOSED;
+	output(c);
+}
+
+static void timers(void)
+{
+	int i;
+
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++) {
+		struct peer_conn *c = conns[i];
+
+		if (c == NULL || c->state == PEER_CLOSED)
+			continue;
+		if (c->ack_at && c->ack_at <= peer_now)
+			send_ack(c);
+		if (c->rto_at && c->rto_at <= peer_now) {
+			c->rto_at = 0;
+			c->rto *= 2;
+			if (c->state == PEER_SYN_SENT) {
+				peer_counts.retransmits++;
+				send_segment(c, c->iss, TH_SYN, NULL, 0);
+				c->rto_at = peer_now + c->rto;
+			} else {
+				rewind_to_una(c);
+			}
+		}
+		if (c->persist_at && c->persist_at <= peer_now) {
+			uint32_t sent = c->snd_nxt - c->iss - 1;
+
+			c->persist_at = 0;
+			if (c->snd_nxt == c->snd_una && sent < c->txlen) {
+				/* one byte past the window */
+				send_segment(c, c->snd_nxt++, TH_ACK, c->tx + sent, 1);
+				if (SEQ_LT(c->snd_max, c->snd_nxt))
+					c->snd_max = c->snd_nxt;
+				c->rto_at = peer_now + c->rto;
+			}
+		}
+		output(c);
+	}
+}
+
+static uint64_t next_timer(uint64_t next)
+{
+	int i;
+
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++) {
+		struct peer_conn *c = conns[i];
+
+		if (c == NULL || c->state == PEER_CLOSED)
+			continue;
+		if (c->ack_at && c->ack_at < next)
+			next = c->ack_at;
+		if (c->rto_at && c->rto_at < next)
+			next = c->rto_at;
+		if (c->persist_at && c->persist_at < next)
+			next = c->persist_at;
+	}
+	return next;
+}
+
+void peer_box_output(const unsigned char *pkt, int len)
+{
+	wire_send(&to_peer, pkt, len, peer_clock());
+	peer_counts.to_peer++;
+}
+
+void peer_box_reset(void)
+{
+	int i;
+
+	if (in_box)
+		box_leave();
+	wire_flush(&to_box);
+	wire_flush(&to_peer);
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++)
+		if (conns[i] != NULL)
+			conns[i]->state = PEER_CLOSED;
+}
+
+struct peer_conn *peer_connect(uint16_t port)
+{
+	struct peer_conn *c = calloc(1, sizeof(*c));
+	int i;
+
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++)
+		if (conns[i] == NULL)
+			break;
+	if (i == sizeof(conns) / sizeof(conns[0])) {
+		fprintf(stderr, "tcppeer: too many connections\n");
+		exit(2);
+	}
+	conns[i] = c;
+	c->state = PEER_SYN_SENT;
+	c->port = port;
+	c->lport = next_lport++;
+	c->iss = 1000000 * c->lport;
+	c->snd_una = c->iss;
+	c->snd_nxt = c->snd_max = c->iss + 1;
+	c->mss = 536;
+	c->rto = RTO_MIN;
+	c->quickacks = QUICKACKS;
+	send_segment(c, c->iss, TH_SYN, NULL, 0);
+	c->rto_at = peer_now + 1000 * PEER_MS;
+	return c;
+}
+
+void peer_send(struct peer_conn *c, const void *data, int len)
+{
+	if (c->txlen + len > c->txcap) {
+		c->txcap = (c->txlen + len) * 2;
+		c->tx = realloc(c->tx, c->txcap);
+	}
+	memcpy(c->tx + c->txlen, data, len);
+	c->txlen += len;
+	output(c);
+}
+
+void peer_close(struct peer_conn *c)
+{
+	c->closing = 1;
+	output(c);
+}
+
+void peer_consume(struct peer_conn *c, int n)
+{
+	memmove(c->rx, c->rx + n, c->rxlen - n);
+	c->rxlen -= n;
+}
+
+void peer_free(struct peer_conn *c)
+{
+	int i;
+
+	for (i = 0; i < sizeof(conns) / sizeof(conns[0]); i++)
+		if (conns[i] == c)
+			conns[i] = NULL;
+	free(c->tx);
+	free(c->rx);
+	free(c);
+}
+
+int peer_run(struct peer_conn *c, int (*done)(struct peer_conn *c), uint64_t limit)
+{
+	uint64_t end = peer_now + limit, next, box_next;
+	struct packet *p;
+
+	for (;;) {
+		box_enter();
+		box_next = box_poll(peer_now);
+		box_leave();
+		while ((p = wire_due(&to_box)) != NULL) {
+			box_enter();
+			box_input(p->data, p->len);
+			box_leave();
+			free(p);
+		}
+		while ((p = wire_due(&to_peer)) != NULL) {
+			peer_input(p->data, p->len);
+			free(p);
+		}
+		timers();
+
+		if (done(c))
+			return 1;
+		if (c->reset || peer_now >= end)
+			return 0;
+
+		next = next_timer(end);
+		if (box_next < next)
+			next = box_next;
+		if (to_box.head != NULL && to_box.head->at < next)
+			next = to_box.head->at;
+		if (to_peer.head != NULL && to_peer.head->at < next)
+			next = to_peer.head->at;
+		if (next > peer_now)
+			peer_now = next;
+	}
+}
@@ -0,0 +1,83 @@
+/*
+ * tcppeer - the other end of a TCP connection to lwIP running on the
+ * build machine, see tcppeer.c. Knows nothing of lwIP, the box side is
+ * reached through box_input and box_poll only, which the test supplies.
+ */
+
+#ifndef _HOSTTEST_TCPPEER_H_
+#define _HOSTTEST_TCPPEER_H_
+
+#include <stdint.h>
+
+#define PEER_ADDR	0x0a000001	/* 10.0.0.1, the client */
+#define BOX_ADDR	0x0a000002	/* 10.0.0.2 */
+#define PEER_MTU	1500
+
+#define PEER_MS		1000000ULL	/* the virtual clock counts ns */
+
+enum {
+	PEER_SYN_SENT,
+	PEER_ESTABLISHED,
+	PEER_CLOSED		/* reset, or both FINs acknowledged */
+};
+
+struct peer_conn {
+	int state;
+	uint16_t port, lport;
+	uint32_t iss, snd_una, snd_nxt, snd_max, rcv_nxt;
+	uint32_t wnd;		/* the box's */
+	uint32_t cwnd, mss;
+	int dupacks;
+
+	/* what the client has to send, tx[0] is sequence number iss + 1 */
+	unsigned char *tx;
+	uint32_t txlen, txcap;
+	/* what the box sent, until the test takes it */
+	unsigned char *rx;
+	uint32_t rxlen, rxcap;
+
+	int closing;		/* send a FIN once tx is out */
+	int fin_sent, fin_rcvd, reset;
+	int unacked;		/* segments received since the last ACK */
+	int quickacks;		/* left to ACK without delay */
+	uint64_t ack_at, rto_at, persist_at, rto;
+};
+
+/* the wire, and the host time the box takes, made virtual time */
+extern uint64_t peer_now;
+extern uint64_t peer_rate;	/* bit/s */
+extern uint64_t peer_delay;	/* ns each way */
+extern int peer_slow;		/* box time counts this many times over */
+
+struct peer_counts {
+	int to_box, to_peer;	/* packets */
+	int retransmits;
+	int bad_sums;		/* from the box */
+	uint64_t box_ns;	/* virtual time spent in box_input and box_poll */
+};
+extern struct peer_counts peer_counts;
+
+/* supplied by the test: hands the box an IP packet, runs its timers and
+   says when they are next due */
+void box_input(const unsigned char *pkt, int len);
+uint64_t box_poll(uint64_t now);
+
+/* for the box's netif output */
+void peer_box_output(const unsigned char *pkt, int len);
+/* the virtual time now, for the box's clock */
+uint64_t peer_clock(void);
+/* the box left box_input or box_poll with a longjmp, as a reset does:
+   forget the connections and what is on the wire */
+void peer_box_reset(void);
+
+struct peer_conn *peer_connect(uint16_t port);
+void peer_send(struct peer_conn *c, const void *data, int len);
+void peer_close(struct peer_conn *c);
+/* the test has used n bytes of c->rx */
+void peer_consume(struct peer_conn *c, int n);
+/* runs the box and the client until done(c), for at most limit ns;
+   returns 0 on a timeout or a reset */
+int peer_run(struct peer_conn *c, int (*done)(struct peer_conn *c), uint64_t limit);
+void peer_free(struct peer_conn *c);
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * tftptest - downloads a file with tftp() from etherboot/core/nic.c
+ * against a simulated server: one that knows no options, one that only
+ * takes blksize, and ones that agree to windows of 1 to 16 blocks, with
+ * no loss and with every 50th and every 7th DATA lost. The Makefile
+ * cuts tftp() out of nic.c into bin/nic_tftp.c, since the rest of nic.c
+ * needs a NIC.
+ *
+ * usage: tftptest
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <arpa/inet.h>
+
+#define __unused __attribute__((unused))
+
+struct iphdr {
+	uint8_t verhdrlen, service;
+	uint16_t len, ident, frags;
+	uint8_t ttl, protocol;
+	uint16_t chksum;
+	struct { uint32_t s_addr; } src, dest;
+} __attribute__((packed));
+
+struct udphdr {
+	uint16_t src, dest, len, chksum;
+} __attribute__((packed));
+
+#include "tftp.h"
+
+/* what tftp() takes from etherboot.h */
+#define ETH_HLEN		14
+#define TIMEOUT			100
+#define MAX_TFTP_RETRIES	20
+#define ARP_CLIENT		0
+#define ARP_SERVER		1
+
+typedef int (*reply_t)(int ival, void *ptr, unsigned short ptype,
+	struct iphdr *ip, struct udphdr *udp);
+
+static struct { struct { uint32_t s_addr; } ipaddr; } arptable[2];
+static struct { unsigned char packet[2048]; unsigned int packetlen; } nic;
+
+/* etherboot's strtoul hands back a const end pointer */
+static unsigned long eb_strtoul(const char *p, const char **end, int base)
+{
+	return strtoul(p, (char **)end, base);
+}
+#define strtoul eb_strtoul
+
+static long rfc2131_sleep_interval(long base, int exp) { return base; }
+static void rx_qdrain(void) {}
+static int udp_transmit(unsigned long destip, unsigned int srcsock,
+	unsigned int destsock, int len, const void *buf);
+static int await_reply(reply_t reply, int ival, void *ptr, long timeout);
+
+#include "nic_tftp.c"
+
+#define FILE_LEN	(4 * 1024 * 1024 + 12345)
+#define QUEUE_LEN	64
+
+/* the server */
+static int server_rexmt;	/* resends its window when no ACK comes */
+static int server_opts;		/* -1 no options, 0 blksize, else windowsize */
+static int server_loss;		/* every that many DATA get lost, 0 none */
+static int blksize, window, blocks, acked;
+static int acks, sent, lost;
+
+static unsigned char file[FILE_LEN];
+
+/* what is on the way to the client */
+static struct { unsigned char d[1600]; } queue[QUEUE_LEN];
+static int qhead, qtail;
+
+static struct tftp_t *queue_add(void)
+{
+	struct tftp_t *t = (struct tftp_t *)queue[qtail].d;
+
+	qtail = (qtail + 1) % QUEUE_LEN;
+	t->udp.src = htons(3000);
+	return t;
+}
+
+static void send_data(int b)
+{
+	struct tftp_t *t;
+	int off = (b - 1) * blksize, len = FILE_LEN - off;
+
+	if (len < 0)
+		return;
+	if (len > blksize)
+		len = blksize;
+	sent++;
+	if (server_loss && rand() % server_loss == 0) {
+		lost++;
+		return;
+	}
+	t = queue_add();
+	t->opcode = htons(TFTP_DATA);
+	t->u.data.block = htons(b);
+	memcpy(t->u.data.download, file + off, len);
+	t->udp.len = htons(sizeof(struct udphdr) + 4 + len);
+}
+
+/* the window behind the last ACK */
+static void send_window(void)
+{
+	int b;
+
+	for (b = acked + 1; b <= acked + window && b <= blocks; b++)
+		send_data(b);
+}
+
+/* the options of a read request, answered with an OACK or block 1 */
+static void read_request(const char *p)
+{
+	struct tftp_t *t;
+	char oack[100];
+	int len = 0, val;
+
+	p += strlen(p) + 1;	/* file name */
+	p += strlen(p) + 1;	/* mode */
+	while (*p != '\0' && server_opts >= 0) {
+		const char *name = p;
+
+		p += strlen(p) + 1;
+		val = atoi(p);
+		p += strlen(p) + 1;
+		if (!strcasecmp(name, "blksize")) {
+			blksize = val;
+			len += sprintf(oack + len, "blksize") + 1;
+			len += sprintf(oack + len, "%d", val) + 1;
+		}
+		if (!strcasecmp(name, "windowsize") && server_opts > 0) {
+			window = val < server_opts ? val : server_opts;
+			len += sprintf(oack + len, "windowsize") + 1;
+			len += sprintf(oack + len, "%d", window) + 1;
+		}
+	}
+	blocks = FILE_LEN / blksize + 1;
+	if (len == 0) {
+		send_data(1);
+		return;
+	}
+	t = queue_add();
+	t->opcode = htons(TFTP_OACK);
+	memcpy(t->u.oack.data, oack, len);
+	t->udp.len = htons(sizeof(struct udphdr) + 2 + len);
+}
+
+static int udp_transmit(unsigned long destip, unsigned int srcsock,
+	unsigned int destsock, int len, const void *buf)
+{
+	const struct tftpreq_t *r = buf;
+
+	switch (ntohs(r->opcode)) {
+	case TFTP_RRQ:
+		read_request((const char *)r->u.rrq);
+		break;
+	case TFTP_ACK:
+		/* the server goes on behind the ACKed block, what it had
+		   sent past it is as good as lost */
+		acks++;
+		acked = ntohs(r->u.ack.block);
+		qhead = qtail;
+		send_window();
+		break;
+	}
+	return 1;
+}
+
+static int await_reply(reply_t reply, int ival, void *ptr, long timeout)
+{
+	int tries;
+
+	/* the server's own timeouts, if it has them */
+	for (tries = 0; tries < 5 && qhead == qtail && server_rexmt &&
+		     acked < blocks; tries++)
+		send_window();
+	if (qhead == qtail)
+		return 0;
+	memcpy(&nic.packet[ETH_HLEN], queue[qhead].d, sizeof(queue[qhead].d));
+	qhead = (qhead + 1) % QUEUE_LEN;
+	return 1;
+}
+
+static unsigned char got[FILE_LEN];
+static int gotlen, gotall;
+
+static int take(unsigned char *data, unsigned int block, unsigned int len, int eof)
+{
+	memcpy(got + gotlen, data, len);
+	gotlen += len;
+	if (eof) {
+		gotall = 1;
+		return 0;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	static const int opts[] = { -1, 0, 1, 4, 8, 16 };
+	static const int losses[] = { 0, 50, 7 };
+	int i, o, l, ok = 1, good, must;
+
+	for (i = 0; i < FILE_LEN; i++)
+		file[i] = rand();
+
+	for (server_rexmt = 0; server_rexmt < 2; server_rexmt++)
+	for (l = 0; l < 3; l++)
+	for (o = 0; o < 6; o++) {
+		server_opts = opts[o];
+		server_loss = losses[l];
+		srand(l * 10 + o);
+		blksize = TFTP_DEFAULTSIZE_PACKET;
+		window = 1;
+		acked = acks = sent = lost = 0;
+		qhead = qtail = 0;
+		gotlen = gotall = 0;
+
+		tftp("kernel", take);
+
+		good = gotall && gotlen == FILE_LEN && !memcmp(got, file, FILE_LEN);
+		/* with no loss a full window takes one ACK, and the OACK one */
+		if (!server_loss && acks > blocks / window + 2)
+			good = 0;
+		/* in lock step only the server resends, RFC 1350 has the
+		   client wait for that */
+		must = server_rexmt || window > 1 || !server_loss;
+		printf("rexmt %d options %2d loss 1/%-2d: %-6s %6d acks %6d DATA sent %5d lost\n",
+		       server_rexmt, server_opts, server_loss,
+		       good ? "ok" : must ? "FAILED" : "stuck", acks, sent, lost);
+		if (must)
+			ok &= good;
+	}
+	printf("tftptest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
@@ -0,0 +1,231 @@
+/*
+ * txtest - sends pbuf chains with lwip/ebd.c through
+ * etherboot/drivers/net/forcedeth.c over the emulated NIC of nicsim.c.
+ * Checks that the frame on the wire is the chain's pieces gathered into
+ * the tx ring buffer and padded to the ethernet minimum, that longer
+ * chains and drivers that cannot gather get the frame linearized, and
+ * that a tx ring the NIC does not empty ends in a counted drop rather
+ * than a hang. Then times ebd_low_level_output for a TCP segment of
+ * header and data, gathered and linearized.
+ *
+ * usage: txtest
+ */
+
+#include <time.h>
+#include "httpd.h"
+#include "ebd.c"
+#include "nicsim.h"
+
+#define TX_RING		16	/* FORCEDETH_TX_RING */
+#define BENCH_FRAMES	2000000
+
+/* the stack around ebd_low_level_output, which is called directly */
+void dhcp_fine_tmr(void) {}
+void dhcp_coarse_tmr(void) {}
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr,
+	struct ip_addr *server) { return ERR_OK; }
+void dhcp_stop(struct netif *netif) {}
+void httpd_init(void) {}
+void fleet_init(void) {}
+void fleet_tmr(void) {}
+void httpboot_start(struct netif *netif) {}
+void httpboot_poll(void) {}
+void netpanel_poll(struct netif *netif, u32_t now) {}
+void netcfg_load(struct netcfg *cfg) {}
+void netcfg_save(const struct netcfg *cfg) {}
+unsigned long currticks(void) { return 0; }
+
+static struct netif netif;
+
+/* what the chains are cut from: a frame from us, then bytes */
+static unsigned char data[EBD_FRAME_LEN + 100];
+
+/* the last frame on the wire */
+static unsigned char wire[2048];
+static int wire_len;
+
+static void tx(const unsigned char *frame, int len)
+{
+	memcpy(wire, frame, len);
+	wire_len = len;
+}
+
+/* a chain of n pieces over the first len bytes of data, the first
+   header bytes long and the rest as even as they come */
+static struct pbuf *chain(int len, int n, int header)
+{
+	struct pbuf *p, *q;
+	int off = 0, piece, i;
+
+	p = NULL;
+	for (i = 0; i < n; i++) {
+		if (i == 0 && n > 1)
+			piece = header;
+		else
+			piece = (len - off) / (n - i);
+		q = pbuf_alloc(PBUF_RAW, piece, PBUF_ROM);
+		q->payload = &data[off];
+		off += piece;
+		if (p == NULL)
+			p = q;
+		else
+			pbuf_cat(p, q);
+	}
+	return p;
+}
+
+/* sends len bytes in n pieces and looks at what came out */
+static int send_chain(int len, int n)
+{
+	struct pbuf *p = chain(len, n, 14);
+	long sent = nicsim_sent;
+	int want = len < 60 ? 60 : len;
+	err_t err;
+	int i;
+
+	wire_len = 0;
+	err = ebd_low_level_output(&netif, p);
+	pbuf_free(p);
+	if (err != ERR_OK || nicsim_sent != sent + 1 || wire_len != want ||
+	    memcmp(wire, data, len) != 0)
+		return 0;
+	for (i = len; i < want; i++)
+		if (wire[i] != 0)
+			return 0;
+	return 1;
+}
+
+static int lengths(void)
+{
+	static const int len[] = { 42, 59, 60, 61, 98, 590, 1514 };
+	static const int pieces[] = { 1, 2, 3, EBD_TX_FRAGS, EBD_TX_FRAGS + 1, 20 };
+	int i, j, ok = 1;
+
+	for (i = 0; i < sizeof(len) / sizeof(len[0]); i++)
+		for (j = 0; j < sizeof(pieces) / sizeof(pieces[0]); j++)
+			if (len[i] >= 14 + pieces[j] && !send_chain(len[i], pieces[j])) {
+				printf("%d bytes in %d pieces FAILED\n", len[i], pieces[j]);
+				ok = 0;
+			}
+	return ok;
+}
+
+/* the NIC stops taking frames, then carries on */
+static int ring_full(void)
+{
+	struct nic_stats *stats = eth_stats();
+	unsigned long dropped = stats->tx_dropped;
+	long sent = nicsim_sent;
+	struct pbuf *p;
+	int i, queued = 0;
+	err_t err;
+
+	nicsim_tx_stalled = 1;
+	nicsim_udelay = 0;
+	p = chain(1514, 2, 54);
+	for (i = 0; i < TX_RING; i++)
+		queued += ebd_low_level_output(&netif, p) == ERR_OK;
+	err = ebd_low_level_output(&netif, p);
+	if (queued != TX_RING || err != ERR_MEM || nicsim_sent != sent ||
+	    stats->tx_dropped != dropped + 1 || nicsim_udelay == 0) {
+		pbuf_free(p);
+		return 0;
+	}
+
+	/* the one waiting lets the NIC send the rest */
+	nicsim_tx_stalled = 0;
+	err = ebd_low_level_output(&netif, p);
+	pbuf_free(p);
+	return err == ERR_OK && nicsim_sent == sent + TX_RING + 1 &&
+	       stats->tx_dropped == dropped + 1;
+}
+
+/* more than the ring buffer holds is dropped, not sent cut short */
+static int too_long(void)
+{
+	struct pbuf *p = chain(EBD_FRAME_LEN + 4, 2, 14);
+	long sent = nicsim_sent;
+	err_t err;
+
+	err = ebd_low_level_output(&netif, p);
+	pbuf_free(p);
+	return err == ERR_MEM && nicsim_sent == sent;
+}
+
+static double cpu(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* a full TCP segment: headers in one pbuf and the data in another */
+static void bench(const char *how)
+{
+	struct pbuf *p = chain(EBD_FRAME_LEN, 2, 54);
+	double t, mb;
+	int i;
+
+	nicsim_tx = NULL;
+	t = cpu();
+	for (i = 0; i < BENCH_FRAMES; i++)
+		ebd_low_level_output(&netif, p);
+	t = cpu() - t;
+	nicsim_tx = tx;
+	pbuf_free(p);
+	mb = (double)BENCH_FRAMES * EBD_FRAME_LEN / 1e6;
+	printf("%-12s %5.0f ns a frame, %7.1f MB/s, %4.0f us CPU per MB\n", how,
+	       t / BENCH_FRAMES * 1e9, mb / t, t / mb * 1e6);
+}
+
+int main(void)
+{
+	struct ip_addr ipaddr, netmask, gw;
+	int ok = 1, r, i;
+
+	nicsim_init();
+	nicsim_tx = tx;
+	stats_init();
+	mem_init();
+	memp_init();
+	pbuf_init();
+	netif_init();
+	IP4_ADDR(&ipaddr, 10, 0, 0, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	IP4_ADDR(&gw, 0, 0, 0, 0);
+	netif_add(&netif, &ipaddr, &netmask, &gw, NULL, ebd_init, ip_input);
+
+	/* the linearized frames get our address put in, so it is there */
+	memset(data, 0x02, 6);
+	memcpy(data + 6, forcedeth_hw_addr, 6);
+	data[12] = 0x08;
+	data[13] = 0x00;
+	for (i = 14; i < sizeof(data); i++)
+		data[i] = i * 7;
+
+	r = lengths();
+	printf("gathered, every length and piece count: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = ring_full();
+	printf("tx ring full: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	r = too_long();
+	printf("frame too long: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	bench("gathered");
+
+	nicsim_no_gather();
+	r = lengths();
+	printf("linearized, every length and piece count: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+	bench("linearized");
+
+	/* the chains all went back */
+	r = lwip_stats.memp[MEMP_PBUF].used == 0;
+	printf("no pbufs leaked: %s\n", r ? "ok" : "FAILED");
+	ok &= r;
+
+	printf("txtest: %s\n", ok ? "ok" : "FAILED");
+	return !ok;
+}
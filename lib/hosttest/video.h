@@ -0,0 +1,23 @@
+/*
+ * Host stand-in for include/video.h, for the calls lwip/netpanel.c makes
+ * to draw its lines. paneltest.c has them, as drivers/video draws them.
+ */
+
+#ifndef _HOSTTEST_VIDEO_H_
+#define _HOSTTEST_VIDEO_H_
+
+typedef DWORD RGBA;	/* 32 bits, as unsigned long on the Xbox */
+
+typedef struct {
+	BYTE * m_pBitmapData;
+	int m_nWidth;
+	int m_nHeight;
+	int m_nBytesPerPixel;
+} JPEG;
+
+int BootVideoOverlayString(DWORD * pdwaTopLeftDestination, DWORD m_dwCountBytesPerLineDestination, RGBA rgbaOpaqueness, const char * szString);
+void BootVideoClearScreen(JPEG * pJpeg, int nStartLine, int nEndLine);
+
+extern JPEG jpegBackdrop;
+
+#endif
@@ -0,0 +1,481 @@
+/*
+ * webtest - lwip/webserver.c on the lwIP core of this tree, talked to
+ * by the simulated client of tcppeer.c over a 100Mbit wire in virtual
+ * time. Fetches a page, then flashes a 1MB image with a multipart POST
+ * and reads it back from /flash.bin. Prints how long the upload and
+ * the readback took and how much of that the box was busy. A reflash
+ * resets the box, which here starts lwIP afresh. Last a resumable
+ * upload in chunks, with a chunk that has a bad CRC, a resume at an
+ * offset off the block grid and a commit with the wrong SHA-1. Then
+ * /stats.json, against the packets the client counted.
+ *
+ * -slow counts the time the box spends in lwIP that many times over,
+ * for a CPU slower than the build machine's; -rtt sets the round trip
+ * of the wire in ms.
+ *
+ * usage: webtest [-slow n] [-rtt ms]
+ */
+
+#define _GNU_SOURCE	/* memmem */
+#include <setjmp.h>
+#include "config.h"
+
+#include "webserver.c"
+
+#include "tcppeer.h"
+
+#define IMAGE_LEN	(1024 * 1024)
+
+char mem_setup[1], mem_pm[FLASH_STAGING_SIZE], mem_initrd[1];
+char mem_flash[IMAGE_LEN];
+char eeprom[EEPROM_SIZE];
+const KNOWN_FLASH_TYPE aknownflashtypesDefault[1];
+struct netpanel netpanel;
+
+unsigned long simple_strtoul(const char *cp, char **endp, unsigned int base)
+{
+	return strtoul(cp, endp, base);
+}
+
+u32_t ebd_clock(void)
+{
+	return peer_clock() * EBD_TICKS_PER_MS / PEER_MS;
+}
+
+void netpanel_transfer(const char *activity, struct ip_addr *from, u32_t expected) {}
+void netpanel_progress(u32_t len) {}
+void netcfg_load(struct netcfg *cfg) { memset(cfg, 0, sizeof(*cfg)); }
+void netcfg_save(const struct netcfg *cfg) {}
+void BootEepromReadEntireEEPROM(void) {}
+void ClearScreen(void) {}
+
+/* the NIC's counters, as /stats.json shows them */
+static struct nic_stats nic_stats = { .rx_frames = 1001, .rx_nobuf = 7, .tx_dropped = 3 };
+
+struct nic_stats *eth_stats(void)
+{
+	return &nic_stats;
+}
+
+bool BootFlashGetDescriptor(OBJECT_FLASH *pof, KNOWN_FLASH_TYPE *pkft)
+{
+	pof->m_dwLengthInBytes = IMAGE_LEN;
+	strcpy(pof->m_szFlashDescription, "host flash");
+	return true;
+}
+
+/* a reflash ends in a reset, which leaves box_input or box_poll */
+static jmp_buf box_reset;
+static char *flashed;
+static int flashed_len;
+
+int BootReflashAndReset(BYTE *pbNewData, DWORD dwStartOffset, DWORD dwLength)
+{
+	flashed = (char *)pbNewData;
+	flashed_len = dwLength;
+	longjmp(box_reset, 1);
+}
+
+static struct netif box_netif;
+static int box_dropped;
+
+static err_t box_output(struct netif *netif, struct pbuf *p, struct ip_addr *ipaddr)
+{
+	unsigned char pkt[PEER_MTU];
+	struct pbuf *q;
+	int len = 0;
+
+	for (q = p; q != NULL; q = q->next) {
+		memcpy(pkt + len, q->payload, q->len);
+		len += q->len;
+	}
+	peer_box_output(pkt, len);
+	return ERR_OK;
+}
+
+static err_t box_netif_init(struct netif *netif)
+{
+	netif->name[0] = 'h';
+	netif->name[1] = 't';
+	netif->mtu = PEER_MTU;
+	netif->output = box_output;
+	return ERR_OK;
+}
+
+/* the packet in pool pbufs, as ebd.c hands frames to lwIP */
+void box_input(const unsigned char *pkt, int len)
+{
+	struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL), *q;
+	int off = 0;
+
+	if (p == NULL) {
+		box_dropped++;
+		return;
+	}
+	for (q = p; q != NULL; q = q->next) {
+		memcpy(q->payload, pkt + off, q->len);
+		off += q->len;
+	}
+	box_netif.input(p, &box_netif);
+}
+
+static uint64_t tcp_next;
+/* the packets before the last boot, which lwIP's counters forgot */
+static struct peer_counts boot_counts;
+
+uint64_t box_poll(uint64_t now)
+{
+	if (now >= tcp_next) {
+		tcp_next = now + TCP_TMR_INTERVAL * PEER_MS;
+		tcp_tmr();
+	}
+	return tcp_next;
+}
+
+/* what run_lwip does, less the NIC and DHCP; also what a reset clears
+   in webserver.c */
+static void box_boot(void)
+{
+	struct ip_addr ipaddr, netmask, gw;
+
+	staging_owner = NULL;
+	memset(&upload, 0, sizeof(upload));
+	readback_probed = 0;
+	stats_init();
+	boot_counts = peer_counts;
+	mem_init();
+	memp_init();
+	pbuf_init();
+	netif_init();
+	ip_init();
+	udp_init();
+	tcp_init();
+	IP4_ADDR(&ipaddr, 10,0,0,2);
+	IP4_ADDR(&netmask, 255,255,255,0);
+	IP4_ADDR(&gw, 10,0,0,1);
+	netif_add(&box_netif, &ipaddr, &netmask, &gw, NULL, box_netif_init, ip_input);
+	netif_set_default(&box_netif);
+	httpd_init();
+	tcp_next = peer_now;
+}
+
+static int failed;
+
+static void check(int ok, const char *what)
+{
+	if (!ok) {
+		printf("webtest: %s FAILED\n", what);
+		failed = 1;
+	}
+}
+
+/* a whole response in c->rx: the header and Content-Length bytes */
+static int response_len(struct peer_conn *c)
+{
+	char *hdr = (char *)c->rx, *end, *cl;
+	int hlen;
+
+	if (c->rxlen == 0)
+		return 0;
+	end = memmem(hdr, c->rxlen, "\r\n\r\n", 4);
+	hlen = end != NULL ? end + 4 - hdr : 0;
+	if (end == NULL) {
+		end = memmem(hdr, c->rxlen, "\n\n", 2);
+		hlen = end != NULL ? end + 2 - hdr : 0;
+	}
+	if (end == NULL)
+		return 0;
+	cl = memmem(hdr, hlen, "Content-Length:", 15);
+	if (cl == NULL)
+		return 0;
+	hlen += atoi(cl + 15);
+	return c->rxlen >= hlen ? hlen : 0;
+}
+
+static int response_done(struct peer_conn *c)
+{
+	return response_len(c) > 0;
+}
+
+static int never(struct peer_conn *c)
+{
+	return 0;
+}
+
+/* sends a request and waits for the whole response, which is left at
+   the start of c->rx; returns its length */
+static int request(struct peer_conn *c, const char *req, int reqlen, const char *body, int len)
+{
+	peer_send(c, req, reqlen);
+	if (len)
+		peer_send(c, body, len);
+	if (!peer_run(c, response_done, 60000 * PEER_MS))
+		return 0;
+	return response_len(c);
+}
+
+static int status_is(struct peer_conn *c, const char *status)
+{
+	return c->rxlen > 9 + strlen(status) && memcmp(c->rx + 9, status, strlen(status)) == 0;
+}
+
+static void test_page(void)
+{
+	struct peer_conn *c = peer_connect(80);
+	static const char req[] = "GET / HTTP/1.1\r\nHost: 10.0.0.2\r\n\r\n";
+	int len = request(c, req, sizeof(req) - 1, NULL, 0);
+
+	check(len == http_files[0].len && memcmp(c->rx, http_files[0].data, len) == 0,
+	      "GET /");
+	peer_consume(c, len);
+	peer_close(c);
+	peer_run(c, never, 2000 * PEER_MS);
+	check(c->state == PEER_CLOSED && !c->reset, "close");
+	peer_free(c);
+}
+
+/* the SHA-1 of the image in mem_flash, in hex */
+static char image_sha1[2 * SHA1HashSize + 1];
+
+static void test_upload(void)
+{
+	static const char boundary[] = "----hosttest7e3b";
+	struct peer_conn *c;
+	char *body, hdr[256];
+	u8_t digest[SHA1HashSize];
+	SHA1Context sha1;
+	uint64_t t0, box0, ns, rate;
+	int i, len, hlen, segs0;
+
+	for (i = 0; i < IMAGE_LEN; i++)
+		mem_flash[i] = rand();
+	/* no BiosIdentifier, the SHA-1 is what is checked */
+	memset(mem_flash + IMAGE_LEN - 64, 0, 64);
+	SHA1Reset(&sha1);
+	SHA1Input(&sha1, (u8_t *)mem_flash, IMAGE_LEN);
+	SHA1Result(&sha1, digest);
+	for (i = 0; i < SHA1HashSize; i++)
+		sprintf(&image_sha1[2 * i], "%02x", digest[i]);
+
+	body = malloc(IMAGE_LEN + 1024);
+	len = sprintf(body, "--%s\r\nContent-Disposition: form-data; name=\"sha1\"\r\n\r\n%s\r\n"
+		      "--%s\r\nContent-Disposition: form-data; name=\"bios\"; filename=\"x.bin\"\r\n"
+		      "Content-Type: application/octet-stream\r\n\r\n", boundary, image_sha1, boundary);
+	memcpy(body + len, mem_flash, IMAGE_LEN);
+	len += IMAGE_LEN;
+	len += sprintf(body + len, "\r\n--%s--\r\n", boundary);
+	hlen = sprintf(hdr, "POST /upload HTTP/1.1\r\nHost: 10.0.0.2\r\n"
+		       "Content-Type: multipart/form-data; boundary=%s\r\n"
+		       "Content-Length: %d\r\n\r\n", boundary, len);
+
+	/* the box flashes, and resets, once the reply is queued and the
+	   client has acknowledged some of it */
+	flashed = NULL;
+	t0 = peer_now;
+	box0 = peer_counts.box_ns;
+	segs0 = peer_counts.to_box;
+	c = peer_connect(80);
+	peer_send(c, hdr, hlen);
+	peer_send(c, body, len);
+	if (setjmp(box_reset) == 0)
+		peer_run(c, never, 60000 * PEER_MS);
+	peer_box_reset();
+	check(flashed == mem_pm && flashed_len == IMAGE_LEN &&
+	      memcmp(mem_pm, mem_flash, IMAGE_LEN) == 0, "flashed image");
+	check(response_len(c) == http_files[2].len &&
+	      memcmp(c->rx, http_files[2].data, http_files[2].len) == 0, "POST reply");
+
+	ns = peer_now - t0;
+	rate = IMAGE_LEN * 1000000000ULL / ns;
+	printf("webtest: 1MB upload flashing after %dms, %d.%02dMB/s, box busy %d%%, %d segments\n",
+	       (int)(ns / PEER_MS), (int)(rate / 1000000), (int)(rate / 10000 % 100),
+	       (int)((peer_counts.box_ns - box0) * 100 / ns), peer_counts.to_box - segs0);
+	peer_free(c);
+	free(body);
+	box_boot();
+}
+
+/* the image test_upload flashed, read back */
+static void test_readback(void)
+{
+	static const char req[] = "GET /flash.bin HTTP/1.1\r\nHost: 10.0.0.2\r\n\r\n";
+	static const char info[] = "GET /info.json HTTP/1.1\r\nHost: 10.0.0.2\r\n\r\n";
+	struct peer_conn *c = peer_connect(80);
+	uint64_t t0, box0, ns, rate;
+	int len, hlen;
+
+	t0 = peer_now;
+	box0 = peer_counts.box_ns;
+	len = request(c, req, sizeof(req) - 1, NULL, 0);
+	ns = peer_now - t0;
+	hlen = len - IMAGE_LEN;
+	check(status_is(c, "200 OK") && hlen > 0 &&
+	      memcmp(c->rx + hlen, mem_flash, IMAGE_LEN) == 0, "GET /flash.bin");
+	rate = IMAGE_LEN * 1000000000ULL / ns;
+	printf("webtest: 1MB readback in %dms, %d.%02dMB/s, box busy %d%%\n",
+	       (int)(ns / PEER_MS), (int)(rate / 1000000), (int)(rate / 10000 % 100),
+	       (int)((peer_counts.box_ns - box0) * 100 / ns));
+	peer_consume(c, len);
+
+	/* on the same connection */
+	len = request(c, info, sizeof(info) - 1, NULL, 0);
+	c->rx[len - 1] = 0;
+	check(status_is(c, "200 OK") && strstr((char *)c->rx, image_sha1) != NULL,
+	      "GET /info.json");
+	peer_consume(c, len);
+	peer_close(c);
+	peer_run(c, never, 2000 * PEER_MS);
+	check(c->state == PEER_CLOSED && !c->reset, "close");
+	peer_free(c);
+}
+
+#define CHUNKED_LEN	(256 * 1024)
+#define CHUNK_LEN	(64 * 1024)
+
+static char chunked[CHUNKED_LEN];
+
+/* PUT /upload of len bytes of chunked at off, claimed to have the CRC32
+   crc; returns the length of the reply */
+static int put_chunk(struct peer_conn *c, int off, int len, u32_t crc)
+{
+	char hdr[256];
+	int hlen;
+
+	hlen = sprintf(hdr, "PUT /upload?size=%d&offset=%d&crc=%08x HTTP/1.1\r\n"
+		       "Host: 10.0.0.2\r\nContent-Length: %d\r\n\r\n",
+		       CHUNKED_LEN, off, (unsigned int)crc, len);
+	return request(c, hdr, hlen, chunked + off, len);
+}
+
+/* GET /upload.json, checks its missing ranges are missing */
+static int upload_missing(struct peer_conn *c, const char *missing)
+{
+	static const char req[] = "GET /upload.json HTTP/1.1\r\nHost: 10.0.0.2\r\n\r\n";
+	int len = request(c, req, sizeof(req) - 1, NULL, 0), ok;
+
+	c->rx[len - 1] = 0;
+	ok = status_is(c, "200 OK") && strstr((char *)c->rx, missing) != NULL;
+	peer_consume(c, len);
+	return ok;
+}
+
+/* a resumable upload in 64KB chunks: one with a bad CRC and one at an
+   offset off the block grid are refused and leave what was received
+   alone, and a commit with the wrong SHA-1 gives the staging area back */
+static void test_chunked(void)
+{
+	static const char commit[] = "PUT /upload?commit=1&sha1="
+		"0123456789012345678901234567890123456789 HTTP/1.1\r\n"
+		"Host: 10.0.0.2\r\nContent-Length: 0\r\n\r\n";
+	struct peer_conn *c = peer_connect(80);
+	u32_t crc[CHUNKED_LEN / CHUNK_LEN];
+	int i, len, other;
+
+	for (i = 0; i < CHUNKED_LEN; i++)
+		chunked[i] = rand();
+	for (i = 0; i < CHUNKED_LEN / CHUNK_LEN; i++)
+		crc[i] = crc32_update(0, (u8_t *)chunked + i * CHUNK_LEN, CHUNK_LEN);
+
+	len = put_chunk(c, 0, CHUNK_LEN, crc[0]);
+	check(status_is(c, "200 OK"), "first chunk");
+	peer_consume(c, len);
+
+	len = put_chunk(c, CHUNK_LEN, CHUNK_LEN, crc[1] ^ 1);
+	check(status_is(c, "422"), "chunk with a bad CRC");
+	peer_consume(c, len);
+
+	/* the client got its resume point wrong */
+	len = put_chunk(c, CHUNK_LEN + 100, CHUNK_LEN, crc[1]);
+	check(status_is(c, "400"), "chunk off the block grid");
+	peer_consume(c, len);
+	check(upload_missing(c, "\"missing\": [[65536, 196608]]"), "missing after refused chunks");
+
+	for (i = 1; i < CHUNKED_LEN / CHUNK_LEN; i++) {
+		len = put_chunk(c, i * CHUNK_LEN, CHUNK_LEN, crc[i]);
+		check(status_is(c, "200 OK"), "resumed chunk");
+		peer_consume(c, len);
+	}
+	check(upload_missing(c, "\"missing\": []"), "nothing missing");
+
+	len = request(c, commit, sizeof(commit) - 1, NULL, 0);
+	check(status_is(c, "422"), "commit with a bad SHA-1");
+	peer_consume(c, len);
+	check(upload_missing(c, "\"size\": 0,"), "upload ended");
+	/* nobody holds the staging area any more */
+	check(httpd_staging_claim(&other) != NULL, "staging area given back");
+	httpd_staging_release(&other);
+
+	peer_close(c);
+	peer_run(c, never, 2000 * PEER_MS);
+	check(c->state == PEER_CLOSED && !c->reset, "close");
+	peer_free(c);
+}
+
+/* counter name of group group in the reply in c->rx, -1 if missing */
+static int stats_value(struct peer_conn *c, const char *group, const char *name)
+{
+	char key[32], *s = strstr((char *)c->rx, group);
+
+	sprintf(key, "\"%s\": ", name);
+	if (s == NULL || (s = strstr(s, key)) == NULL)
+		return -1;
+	return atoi(s + strlen(key));
+}
+
+/* GET /stats.json: the NIC's counters, and lwIP's against the packets
+   the client saw; the reply is made between the request and the end */
+static void test_stats(void)
+{
+	static const char req[] = "GET /stats.json HTTP/1.1\r\nHost: 10.0.0.2\r\n\r\n";
+	struct peer_conn *c = peer_connect(80);
+	int to_box, to_peer, len, recv, xmit;
+
+	peer_run(c, never, 200 * PEER_MS);
+	to_box = peer_counts.to_box - boot_counts.to_box;
+	to_peer = peer_counts.to_peer - boot_counts.to_peer;
+	len = request(c, req, sizeof(req) - 1, NULL, 0);
+	check(status_is(c, "200 OK"), "GET /stats.json");
+	c->rx[len - 1] = 0;
+	check(stats_value(c, "\"nic\"", "rx_frames") == 1001 &&
+	      stats_value(c, "\"nic\"", "rx_nobuf") == 7 &&
+	      stats_value(c, "\"nic\"", "tx_dropped") == 3, "NIC counters");
+	xmit = stats_value(c, "\"ip\"", "xmit");
+	recv = stats_value(c, "\"ip\"", "recv");
+	check(xmit >= to_peer && xmit <= peer_counts.to_peer - boot_counts.to_peer,
+	      "IP packets sent");
+	check(recv > to_box && recv <= peer_counts.to_box - boot_counts.to_box,
+	      "IP packets received");
+	check(stats_value(c, "\"tcp\"", "xmit") > 0, "TCP segments sent");
+	peer_consume(c, len);
+
+	peer_close(c);
+	peer_run(c, never, 2000 * PEER_MS);
+	check(c->state == PEER_CLOSED && !c->reset, "close");
+	peer_free(c);
+}
+
+int main(int argc, char **argv)
+{
+	int i;
+
+	for (i = 1; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-slow") == 0)
+			peer_slow = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "-rtt") == 0)
+			peer_delay = atoi(argv[i + 1]) * PEER_MS / 2;
+	}
+
+	box_boot();
+	test_page();
+	test_upload();
+	test_readback();
+	test_chunked();
+	test_stats();
+	check(peer_counts.bad_sums == 0, "checksums");
+	check(box_dropped == 0, "pool");
+
+	if (failed)
+		return 1;
+	printf("webtest: ok\n");
+	return 0;
+}
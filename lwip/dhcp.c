@@ -92,6 +92,7 @@ static void dhcp_handle_nak(struct netif *netif);
 static void dhcp_handle_offer(struct netif *netif);
 
 static err_t dhcp_discover(struct netif *netif);
+static err_t dhcp_reboot(struct netif *netif);
 static err_t dhcp_select(struct netif *netif);
 static void dhcp_check(struct netif *netif);
 static void dhcp_bind(struct netif *netif);
@@ -232,10 +233,11 @@ static err_t dhcp_select(struct netif *netif)
     dhcp_option(dhcp, DHCP_OPTION_SERVER_ID, 4);
     dhcp_option_long(dhcp, ntohl(dhcp->server_ip_addr.addr));
 
-    dhcp_option(dhcp, DHCP_OPTION_PARAMETER_REQUEST_LIST, 3);
+    dhcp_option(dhcp, DHCP_OPTION_PARAMETER_REQUEST_LIST, 4);
     dhcp_option_byte(dhcp, DHCP_OPTION_SUBNET_MASK);
     dhcp_option_byte(dhcp, DHCP_OPTION_ROUTER);
     dhcp_option_byte(dhcp, DHCP_OPTION_BROADCAST);
+    dhcp_option_byte(dhcp, DHCP_OPTION_BOOTFILE);
 
     dhcp_option_trailer(dhcp);
     /* shrink the pbuf to the actual content length */
@@ -333,6 +335,15 @@ static void dhcp_timeout(struct netif *netif)
   if ((dhcp->state == DHCP_BACKING_OFF) || (dhcp->state == DHCP_SELECTING)) {
     LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE, ("dhcp_timeout(): restarting discovery\n"));
     dhcp_discover(netif);
+  /* the server did not confirm the lease we had */
+  } else if (dhcp->state == DHCP_REBOOTING) {
+    LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE, ("dhcp_timeout(): REBOOTING, DHCP request timed out\n"));
+    if (dhcp->tries < 2) {
+      dhcp_reboot(netif);
+    } else {
+      LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE, ("dhcp_timeout(): REBOOTING, restarting discovery\n"));
+      dhcp_discover(netif);
+    }
   /* receiving the requested lease timed out */
   } else if (dhcp->state == DHCP_REQUESTING) {
     LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE, ("dhcp_timeout(): REQUESTING, DHCP request timed out\n"));
@@ -449,6 +460,12 @@ static void dhcp_handle_ack(struct netif *netif)
   /* (y)our internet address */
   ip_addr_set(&dhcp->offered_ip_addr, &dhcp->msg_in->yiaddr);
 
+  /* server address, an ACK to INIT-REBOOT is the first we hear of it */
+  option_ptr = dhcp_get_option_ptr(dhcp, DHCP_OPTION_SERVER_ID);
+  if (option_ptr != NULL) {
+    dhcp->server_ip_addr.addr = htonl(dhcp_get_option_long(&option_ptr[2]));
+  }
+
 /**
  * Patch #1308
  * TODO: we must check if the file field is not overloaded by DHCP options!
@@ -481,6 +498,22 @@ static void dhcp_handle_ack(struct netif *netif)
   if (option_ptr != NULL) {
     dhcp->offered_bc_addr.addr = htonl(dhcp_get_option_long(&option_ptr[2]));
   }
+
+  /* boot file name, from option 67 or else the file field, unless
+     that was overloaded with options */
+  dhcp->boot_file[0] = 0;
+  option_ptr = dhcp_get_option_ptr(dhcp, DHCP_OPTION_BOOTFILE);
+  if (option_ptr != NULL) {
+    u8_t n = option_ptr[1];
+    if (n >= DHCP_BOOT_FILE_LEN) {
+      n = DHCP_BOOT_FILE_LEN - 1;
+    }
+    memcpy(dhcp->boot_file, &option_ptr[2], n);
+    dhcp->boot_file[n] = 0;
+  } else if (dhcp_get_option_ptr(dhcp, DHCP_OPTION_OVERLOAD) == NULL) {
+    memcpy(dhcp->boot_file, dhcp->msg_in->file, DHCP_BOOT_FILE_LEN - 1);
+    dhcp->boot_file[DHCP_BOOT_FILE_LEN - 1] = 0;
+  }
 }
 
 /**
@@ -497,6 +530,24 @@ static void dhcp_handle_ack(struct netif *netif)
  *
  */
 err_t dhcp_start(struct netif *netif)
+{
+  return dhcp_start_reboot(netif, NULL, NULL);
+}
+
+/**
+ * Start DHCP negotiation, asking for a lease held before.
+ *
+ * Instead of discovering a server, the client goes through INIT-REBOOT
+ * (RFC 2131 3.2) and asks to keep the given address, which saves the
+ * DISCOVER/OFFER round. If no server confirms it, the client falls
+ * back to discovery, a NAK restarts discovery at once.
+ *
+ * @param netif The lwIP network interface
+ * @param ipaddr address leased before, NULL or 0.0.0.0 discovers
+ * @param server server that leased it, NULL if not known
+ * @return lwIP error code
+ */
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr, struct ip_addr *server)
 {
   struct dhcp *dhcp = netif->dhcp;
   err_t result = ERR_OK;
@@ -531,7 +582,15 @@ err_t dhcp_start(struct netif *netif)
     LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE | 3, ("dhcp_start(): restarting DHCP configuration\n"));
   }
   /* (re)start the DHCP negotiation */
-  result = dhcp_discover(netif);
+  if ((ipaddr != NULL) && (ipaddr->addr != 0)) {
+    ip_addr_set(&dhcp->offered_ip_addr, ipaddr);
+    if (server != NULL) {
+      ip_addr_set(&dhcp->server_ip_addr, server);
+    }
+    result = dhcp_reboot(netif);
+  } else {
+    result = dhcp_discover(netif);
+  }
   if (result != ERR_OK) {
     /* free resources allocated above */
     dhcp_stop(netif);
@@ -696,10 +755,11 @@ static err_t dhcp_discover(struct netif *netif)
     dhcp_option(dhcp, DHCP_OPTION_MAX_MSG_SIZE, DHCP_OPTION_MAX_MSG_SIZE_LEN);
     dhcp_option_short(dhcp, 576);
 
-    dhcp_option(dhcp, DHCP_OPTION_PARAMETER_REQUEST_LIST, 3);
+    dhcp_option(dhcp, DHCP_OPTION_PARAMETER_REQUEST_LIST, 4);
     dhcp_option_byte(dhcp, DHCP_OPTION_SUBNET_MASK);
     dhcp_option_byte(dhcp, DHCP_OPTION_ROUTER);
     dhcp_option_byte(dhcp, DHCP_OPTION_BROADCAST);
+    dhcp_option_byte(dhcp, DHCP_OPTION_BOOTFILE);
 
     dhcp_option_trailer(dhcp);
 
@@ -727,6 +787,59 @@ static err_t dhcp_discover(struct netif *netif)
 }
 
 
+/**
+ * Ask to keep the lease for offered_ip_addr, the INIT-REBOOT state.
+ *
+ * The request carries no server identifier and is broadcast, any
+ * server that knows the lease answers with an ACK or a NAK.
+ */
+static err_t dhcp_reboot(struct netif *netif)
+{
+  struct dhcp *dhcp = netif->dhcp;
+  err_t result = ERR_OK;
+  u16_t msecs;
+  LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | 3, ("dhcp_reboot()\n"));
+  dhcp_set_state(dhcp, DHCP_REBOOTING);
+  /* create and initialize the DHCP message header */
+  result = dhcp_create_request(netif);
+  if (result == ERR_OK)
+  {
+    dhcp_option(dhcp, DHCP_OPTION_MESSAGE_TYPE, DHCP_OPTION_MESSAGE_TYPE_LEN);
+    dhcp_option_byte(dhcp, DHCP_REQUEST);
+
+    dhcp_option(dhcp, DHCP_OPTION_MAX_MSG_SIZE, DHCP_OPTION_MAX_MSG_SIZE_LEN);
+    dhcp_option_short(dhcp, 576);
+
+    dhcp_option(dhcp, DHCP_OPTION_REQUESTED_IP, 4);
+    dhcp_option_long(dhcp, ntohl(dhcp->offered_ip_addr.addr));
+
+    dhcp_option(dhcp, DHCP_OPTION_PARAMETER_REQUEST_LIST, 4);
+    dhcp_option_byte(dhcp, DHCP_OPTION_SUBNET_MASK);
+    dhcp_option_byte(dhcp, DHCP_OPTION_ROUTER);
+    dhcp_option_byte(dhcp, DHCP_OPTION_BROADCAST);
+    dhcp_option_byte(dhcp, DHCP_OPTION_BOOTFILE);
+
+    dhcp_option_trailer(dhcp);
+
+    pbuf_realloc(dhcp->p_out, sizeof(struct dhcp_msg) - DHCP_OPTIONS_LEN + dhcp->options_out_len);
+
+    /* set receive callback function with netif as user data */
+    udp_recv(dhcp->pcb, dhcp_recv, netif);
+    udp_bind(dhcp->pcb, IP_ADDR_ANY, DHCP_CLIENT_PORT);
+    udp_connect(dhcp->pcb, IP_ADDR_ANY, DHCP_SERVER_PORT);
+    udp_sendto(dhcp->pcb, dhcp->p_out, IP_ADDR_BROADCAST, DHCP_SERVER_PORT);
+    dhcp_delete_request(netif);
+    LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE, ("dhcp_reboot: REBOOTING\n"));
+  } else {
+    LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | 2, ("dhcp_reboot: could not allocate DHCP request\n"));
+  }
+  dhcp->tries++;
+  msecs = dhcp->tries < 10 ? dhcp->tries * 500 : 10 * 1000;
+  dhcp->request_timeout = (msecs + DHCP_FINE_TIMER_MSECS - 1) / DHCP_FINE_TIMER_MSECS;
+  LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | DBG_STATE, ("dhcp_reboot(): set request timeout %u msecs\n", msecs));
+  return result;
+}
+
 /**
  * Bind the interface to the offered IP address.
  *
@@ -1202,6 +1315,7 @@ static void dhcp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, struct ip_
     /* already bound to the given lease address? */
     else if ((dhcp->state == DHCP_REBOOTING) || (dhcp->state == DHCP_REBINDING) || (dhcp->state == DHCP_RENEWING)) {
       dhcp->request_timeout = 0;
+      dhcp_handle_ack(netif);
       dhcp_bind(netif);
     }
   }
@@ -1211,7 +1325,12 @@ static void dhcp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, struct ip_
      (dhcp->state == DHCP_REBINDING) || (dhcp->state == DHCP_RENEWING  ))) {
     LWIP_DEBUGF(DHCP_DEBUG | DBG_TRACE | 1, ("DHCP_NAK received\n"));
     dhcp->request_timeout = 0;
-    dhcp_handle_nak(netif);
+    /* the lease we had is gone, no use backing off before asking anew */
+    if (dhcp->state == DHCP_REBOOTING) {
+      dhcp_discover(netif);
+    } else {
+      dhcp_handle_nak(netif);
+    }
   }
   /* received a DHCP_OFFER in DHCP_SELECTING state? */
   else if ((msg_type == DHCP_OFFER) && (dhcp->state == DHCP_SELECTING)) {
@@ -1,23 +1,79 @@
 
 #include "lwip/stats.h"
 #include "lwip/mem.h"
+#include "lwip/icmp.h"
+#include "lwip/inet.h"
 #include "netif/etharp.h"
 #include "lwip/tcp.h"
 #include "boot.h"
+#include "netcfg.h"
+#include "ebd.h"
+#include "netpanel.h"
+#include "httpboot.h"
+#include "fleet.h"
 
 struct eth_addr ethaddr= {0,0x0d,0xff,0xff,0,0};
 
+/* biggest frame the NIC hands us or we send, header included */
+#define EBD_FRAME_LEN 1514
+
+/* frames ebd_input takes from the NIC in one go */
+#define EBD_RX_BUDGET 32
+
+/* the NIC receives into pool pbufs this far in, which word aligns the IP
+   header behind the 14 byte ethernet header */
+#define EBD_RX_ALIGN 2
+
 void eth_transmit(const char *d, unsigned int t, unsigned int s, const void *p);
 int eth_poll_into(char *buf, int *len);
+int eth_rx_buffers(void *(*alloc)(unsigned char **buf),
+	void (*release)(void *cookie), unsigned int size);
+int eth_poll_buffer(void **cookie, unsigned int *len);
+
+/* most pieces a frame is sent in, longer pbuf chains are linearized */
+#define EBD_TX_FRAGS 8
+
+/* set when the NIC receives straight into pbufs */
+static int ebd_zero_copy = 0;
+
+static void *
+ebd_rx_alloc(unsigned char **buf)
+{
+	struct pbuf *p;
+
+	p = pbuf_alloc(PBUF_RAW, PBUF_POOL_BUFSIZE, PBUF_POOL);
+	if (p == NULL)
+		return NULL;
+	pbuf_header(p, -EBD_RX_ALIGN);
+	*buf = p->payload;
+	return p;
+}
+
+static void
+ebd_rx_free(void *cookie)
+{
+	pbuf_free((struct pbuf *)cookie);
+}
 
 static struct pbuf *
 ebd_poll(struct netif *netif)
 {
 	struct pbuf *p, *q;
 	char *bufptr;
-	char buf[1500];
+	char buf[EBD_FRAME_LEN];
 	int len;
 
+	if (ebd_zero_copy) {
+		void *cookie;
+		unsigned int n;
+
+		if (!eth_poll_buffer(&cookie, &n))
+			return NULL;
+		p = cookie;
+		pbuf_realloc(p, n);
+		return p;
+	}
+
 	if (!eth_poll_into(buf, &len))
 		return NULL;
 
@@ -29,6 +85,8 @@ ebd_poll(struct netif *netif)
 			bufptr += q->len;
 		}
 	} else {
+		LINK_STATS_INC(link.memerr);
+		LINK_STATS_INC(link.drop);
 		printk("Could not allocate pbufs\n");
 	}
 	return p;
@@ -37,10 +95,29 @@ ebd_poll(struct netif *netif)
 static err_t
 ebd_low_level_output(struct netif *netif, struct pbuf *p)
 {
-	char buf[1500];
+	struct nic_frag frag[EBD_TX_FRAGS];
+	char buf[EBD_FRAME_LEN];
 	char *bufptr;
 	struct eth_hdr *h;
 	struct pbuf *q;
+	int n = 0;
+
+	/* the driver copies the pieces straight into its ring buffer */
+	for(q = p; q != NULL && n < EBD_TX_FRAGS; q = q->next) {
+		frag[n].data = q->payload;
+		frag[n].len = q->len;
+		n++;
+	}
+	if (q == NULL) {
+		switch (eth_transmit_frags(frag, n)) {
+		case 1:
+			LINK_STATS_INC(link.xmit);
+			return ERR_OK;
+		case 0:
+			LINK_STATS_INC(link.drop);
+			return ERR_MEM;
+		}
+	}
 
 	bufptr = &buf[0];
 	h = (struct eth_hdr *)bufptr;
@@ -49,6 +126,68 @@ ebd_low_level_output(struct netif *netif, struct pbuf *p)
 		bufptr += q->len;
 	}
 	eth_transmit (&h->dest.addr[0], ntohs (h->type), p->tot_len - 14, &buf[14]);
+	LINK_STATS_INC(link.xmit);
+	return ERR_OK;
+}
+
+/*
+ * Answers an ICMP echo request for our address with the frame it came
+ * in: addresses swapped, the type changed and the checksum patched.
+ * Neither ip_input nor the ARP table is involved and nothing is
+ * allocated, so pings get answered at the rate they come in. Returns 0
+ * for anything else, and for anything odd, which then takes the normal
+ * path and is counted there.
+ */
+static int
+ebd_echo(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *eth = p->payload;
+	struct ip_hdr *iphdr;
+	struct icmp_echo_hdr *iecho;
+	struct eth_addr mac;
+	struct ip_addr addr;
+	int hlen, len;
+
+	if (p->next != NULL || p->len < 14 + IP_HLEN + sizeof(struct icmp_echo_hdr))
+		return 0;
+	iphdr = (struct ip_hdr *)((u8_t *)p->payload + 14);
+	hlen = IPH_HL(iphdr) * 4;
+	len = ntohs(IPH_LEN(iphdr));
+	if (IPH_V(iphdr) != 4 || IPH_PROTO(iphdr) != IP_PROTO_ICMP ||
+	    (IPH_OFFSET(iphdr) & htons(IP_OFFMASK | IP_MF)) != 0 ||
+	    hlen < IP_HLEN || len < hlen + sizeof(struct icmp_echo_hdr) ||
+	    14 + len > p->len || netif->ip_addr.addr == 0 ||
+	    !ip_addr_cmp(&iphdr->dest, &netif->ip_addr))
+		return 0;
+	iecho = (struct icmp_echo_hdr *)((u8_t *)iphdr + hlen);
+	if (ICMPH_TYPE(iecho) != ICMP_ECHO ||
+	    inet_chksum(iphdr, hlen) != 0 || inet_chksum(iecho, len - hlen) != 0)
+		return 0;
+
+	IP_STATS_INC(ip.recv);
+	ICMP_STATS_INC(icmp.recv);
+
+	mac = eth->dest;
+	eth->dest = eth->src;
+	eth->src = mac;
+	/* swapping the addresses leaves the IP header checksum alone */
+	addr = iphdr->src;
+	iphdr->src = iphdr->dest;
+	iphdr->dest = addr;
+	ICMPH_TYPE_SET(iecho, ICMP_ER);
+	/* adjust the checksum, as icmp_input does */
+	if (iecho->chksum >= htons(0xffff - (ICMP_ECHO << 8))) {
+		iecho->chksum += htons(ICMP_ECHO << 8) + 1;
+	} else {
+		iecho->chksum += htons(ICMP_ECHO << 8);
+	}
+	/* drop the padding of short frames */
+	pbuf_realloc(p, 14 + len);
+
+	ICMP_STATS_INC(icmp.xmit);
+	IP_STATS_INC(ip.xmit);
+	ebd_low_level_output(netif, p);
+	return 1;
 }
 
 static err_t
@@ -64,51 +203,113 @@ ebd_output(struct netif *netif, struct pbuf *p,
 	return ERR_OK;
 }
 
-int
-ebd_wait(struct netif *netif, u16_t time)
+/* the PM timer only counts on in its low 24 bits */
+#define EBD_TICKS_MASK 0xffffff
+
+/*
+ * PM timer ticks since the first call, carried past the 24 bit wrap.
+ * Must be called at least every 4.6 seconds, which the main loop does.
+ */
+u32_t
+ebd_clock(void)
+{
+	extern unsigned long currticks(void);
+	static u32_t last, now;
+	static int started = 0;
+	u32_t ticks;
+
+	ticks = currticks();
+	if (started)
+		now += (ticks - last) & EBD_TICKS_MASK;
+	started = 1;
+	last = ticks;
+	return now;
+}
+
+/*
+ * The deadline after one that just expired. A timer that fell more
+ * than a period behind is not run again to catch up, the next run is
+ * a period from now.
+ */
+static u32_t
+ebd_next(u32_t deadline, u32_t now, u32_t msecs)
 {
-  unsigned long delay_ticks;
-  static unsigned long start_ticks = 0;
-  extern unsigned long currticks(void);
+	deadline += msecs * EBD_TICKS_PER_MS;
+	if (EBD_DUE(now, deadline))
+		deadline = now + msecs * EBD_TICKS_PER_MS;
+	return deadline;
+}
 
-  delay_ticks = time * 3579;
-  if (!start_ticks)
-	  start_ticks = currticks();
+/*
+ * Hands what the NIC has queued up, at most EBD_RX_BUDGET frames, to
+ * the stack. Returns the number of frames taken.
+ */
+static int
+ebd_input(struct netif *netif)
+{
+  int got;
 
-  while (1) {
+  for (got = 0; got < EBD_RX_BUDGET; got++) {
 	  struct eth_hdr *ethhdr;
 	  struct pbuf *p, *q;
 	  
 	  p = ebd_poll (netif);
-	  if (p) {
-		  ethhdr = p->payload;
-		  q = NULL;
-		  switch (htons(ethhdr->type)) {
-		  case ETHTYPE_IP:
-			  q = etharp_ip_input(netif, p);
-			  pbuf_header(p, -14);
-			  netif->input(p, netif);
-			  break;
-		  case ETHTYPE_ARP:
-			  q = etharp_arp_input(netif, &ethaddr, p);
-			  break;
-		  default:
+	  if (p == NULL)
+		  break;
+	  LINK_STATS_INC(link.recv);
+	  ethhdr = p->payload;
+	  q = NULL;
+	  switch (htons(ethhdr->type)) {
+	  case ETHTYPE_IP:
+		  if (ebd_echo(netif, p)) {
 			  pbuf_free(p);
 			  break;
 		  }
-		  if (q != NULL) {
-			  ebd_low_level_output(netif, q);
-			  pbuf_free(q);
-		  }
-		  return 1;
-	  } else {
-		  unsigned long ticks = currticks () - start_ticks;
-		  if (ticks > delay_ticks) {
-			  start_ticks = 0;
-			  return 0;
-		  }
+		  q = etharp_ip_input(netif, p);
+		  pbuf_header(p, -14);
+		  netif->input(p, netif);
+		  break;
+	  case ETHTYPE_ARP:
+		  q = etharp_arp_input(netif, &ethaddr, p);
+		  break;
+	  default:
+		  LINK_STATS_INC(link.proterr);
+		  LINK_STATS_INC(link.drop);
+		  pbuf_free(p);
+		  break;
+	  }
+	  if (q != NULL) {
+		  ebd_low_level_output(netif, q);
+		  pbuf_free(q);
 	  }
   }
+  return got;
+}
+
+/*
+ * Remembers a lease once DHCP has bound one, so the next boot can ask
+ * for it straight away. CMOS is only touched when the lease changed.
+ */
+static void
+ebd_keep_lease(struct netif *netif, struct netcfg *cfg)
+{
+	struct dhcp *dhcp = netif->dhcp;
+
+	if (dhcp == NULL || dhcp->state != DHCP_BOUND)
+		return;
+	if (ip_addr_cmp(&cfg->ipaddr, &netif->ip_addr) &&
+	    ip_addr_cmp(&cfg->netmask, &netif->netmask) &&
+	    ip_addr_cmp(&cfg->gw, &netif->gw) &&
+	    ip_addr_cmp(&cfg->server, &dhcp->server_ip_addr))
+		return;
+
+	/* the fallback may have been changed over the web meanwhile */
+	netcfg_load(cfg);
+	ip_addr_set(&cfg->ipaddr, &netif->ip_addr);
+	ip_addr_set(&cfg->netmask, &netif->netmask);
+	ip_addr_set(&cfg->gw, &netif->gw);
+	ip_addr_set(&cfg->server, &dhcp->server_ip_addr);
+	netcfg_save(cfg);
 }
 
 extern char forcedeth_hw_addr[6];
@@ -130,7 +331,9 @@ int run_lwip(void)
 {
 	struct ip_addr ipaddr, netmask, gw;
 	struct netif netif;
+	struct netcfg cfg;
 
+	stats_init();
 	mem_init();
 	memp_init();
 	pbuf_init(); 
@@ -139,6 +342,8 @@ int run_lwip(void)
 	udp_init();
 	tcp_init();
 	etharp_init();
+	ebd_zero_copy = eth_rx_buffers(ebd_rx_alloc, ebd_rx_free,
+				       PBUF_POOL_BUFSIZE - EBD_RX_ALIGN);
 	printk("TCP/IP initialized.\n");
 	
 /*	IP4_ADDR(&gw, 192,168,99,1);
@@ -150,40 +355,75 @@ int run_lwip(void)
 	IP4_ADDR(&netmask, 255,255,255,255);
 	
 	netif_add(&netif, &ipaddr, &netmask, &gw, NULL, ebd_init, ip_input);
-	dhcp_start(&netif);
+	/* ask for the lease of the last boot first, if there was one */
+	netcfg_load(&cfg);
+	dhcp_start_reboot(&netif, &cfg.ipaddr, &cfg.server);
 
 	netif_set_default(&netif);
 	
 	httpd_init();
+	fleet_init();
 	
-    int divisor = 0;
-	int first = 1;
+	u32_t now, tcp_next, fine_next, coarse_next, arp_next, fleet_next, fallback_at;
+	int first = 1, netboot = 0;
+
+	now = ebd_clock();
+	tcp_next = now + TCP_TMR_INTERVAL * EBD_TICKS_PER_MS;
+	fine_next = now + DHCP_FINE_TIMER_MSECS * EBD_TICKS_PER_MS;
+	coarse_next = now + DHCP_COARSE_TIMER_SECS * 1000 * EBD_TICKS_PER_MS;
+	arp_next = now + ARP_TMR_INTERVAL * EBD_TICKS_PER_MS;
+	fleet_next = now + FLEET_TMR_INTERVAL * EBD_TICKS_PER_MS;
+	fallback_at = now + cfg.dhcp_wait * 1000 * EBD_TICKS_PER_MS;
+
+	/* take in what has arrived, then run every timer that is due, so
+	   a busy link cannot hold the timers off */
 	while (1) {
-		
-		if (!ebd_wait(&netif, TCP_TMR_INTERVAL)) {
-			if (divisor++ == 60 * 4) {
-				if (first && netif.dhcp->state != DHCP_BOUND) {
-					printk ("DHCP FAILED - Falling back to 192.168.0.99\n");
-					dhcp_stop (&netif);
-					IP4_ADDR(&gw, 192,168,0,1);
-					IP4_ADDR(&ipaddr, 192,168,0,99);
-					IP4_ADDR(&netmask, 255,255,255,0);
-					netif_set_ipaddr(&netif, &ipaddr);
-					netif_set_netmask(&netif, &netmask);
-					netif_set_gw(&netif, &gw);
-				}
-				first = 0;
-				dhcp_coarse_tmr();
-				divisor=0;
-			}
-			if (divisor & 1)
-				dhcp_fine_tmr();
+		ebd_input(&netif);
+		now = ebd_clock();
+
+		if (EBD_DUE(now, tcp_next)) {
+			tcp_next = ebd_next(tcp_next, now, TCP_TMR_INTERVAL);
 			tcp_tmr();
-			//else
-			//	printk("Got packet!! \n");
+		}
+		if (EBD_DUE(now, fine_next)) {
+			fine_next = ebd_next(fine_next, now, DHCP_FINE_TIMER_MSECS);
+			dhcp_fine_tmr();
+		}
+		if (EBD_DUE(now, coarse_next)) {
+			coarse_next = ebd_next(coarse_next, now,
+					       DHCP_COARSE_TIMER_SECS * 1000);
+			dhcp_coarse_tmr();
+		}
+		if (first && EBD_DUE(now, fallback_at)) {
+			if (netif.dhcp == NULL || netif.dhcp->state != DHCP_BOUND) {
+				printk ("DHCP FAILED - Falling back to %d.%d.%d.%d\n",
+					ip4_addr1(&cfg.fallback_ip), ip4_addr2(&cfg.fallback_ip),
+					ip4_addr3(&cfg.fallback_ip), ip4_addr4(&cfg.fallback_ip));
+				dhcp_stop (&netif);
+				netif_set_ipaddr(&netif, &cfg.fallback_ip);
+				netif_set_netmask(&netif, &cfg.fallback_mask);
+				netif_set_gw(&netif, &cfg.fallback_gw);
+			}
+			first = 0;
+		}
+		ebd_keep_lease(&netif, &cfg);
+		/* once there is an address, see if there is something to
+		   boot from the network */
+		if (!netboot && (!first || (netif.dhcp != NULL &&
+					    netif.dhcp->state == DHCP_BOUND))) {
+			httpboot_start(&netif);
+			netboot = 1;
+		}
+		httpboot_poll();
+		netpanel_poll(&netif, now);
+		if (EBD_DUE(now, arp_next)) {
+			arp_next = ebd_next(arp_next, now, ARP_TMR_INTERVAL);
+			etharp_tmr();
+		}
+		if (EBD_DUE(now, fleet_next)) {
+			fleet_next = ebd_next(fleet_next, now, FLEET_TMR_INTERVAL);
+			fleet_tmr();
 		}
 	}
 	
 }
-
-
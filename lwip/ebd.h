@@ -0,0 +1,22 @@
+#ifndef __EBD_H__
+#define __EBD_H__
+
+#include "lwip/arch.h"
+#include "nic_shared.h"
+
+/* PM timer ticks per millisecond (3.579545MHz) */
+#define EBD_TICKS_PER_MS 3580
+
+/* a deadline that is now or in the past */
+#define EBD_DUE(now, deadline) ((s32_t)((now) - (deadline)) >= 0)
+
+/* PM timer ticks since the main loop started */
+u32_t ebd_clock(void);
+
+/* frames the NIC received but never handed up, for whatever reason */
+#define EBD_RX_LOST(s) ((s)->rx_errors + (s)->rx_missed + (s)->rx_overruns + \
+			(s)->rx_nobuf + (s)->rx_dropped)
+
+int run_lwip(void);
+
+#endif /* __EBD_H__ */
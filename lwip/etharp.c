@@ -126,10 +126,17 @@ struct etharp_entry {
   struct pbuf *p;
 #endif
   u8_t ctime;
+  /** next entry in the same hash bucket, -1 for none */
+  s8_t next;
 };
 
 static const struct eth_addr ethbroadcast = {{0xff,0xff,0xff,0xff,0xff,0xff}};
 static struct etharp_entry arp_table[ARP_TABLE_SIZE];
+/** first entry of each hash bucket, -1 for none. Every non-empty entry
+ * is in the bucket of its IP address, empty entries are in none. */
+static s8_t arp_hash[ARP_HASH_SIZE];
+/** the entry last found, most frames come from the same peer */
+static s8_t arp_last;
 
 static s8_t find_arp_entry(void);
 #define ARP_INSERT_FLAG 1
@@ -152,7 +159,75 @@ etharp_init(void)
     arp_table[i].p = NULL;
 #endif
     arp_table[i].ctime = 0;
+    arp_table[i].next = -1;
   }
+  for(i = 0; i < ARP_HASH_SIZE; ++i) {
+    arp_hash[i] = -1;
+  }
+  arp_last = 0;
+}
+
+/**
+ * The hash bucket of an IP address. Hosts on the local network differ
+ * in the last bytes of their address.
+ */
+static u8_t
+etharp_hash(struct ip_addr *ipaddr)
+{
+  u32_t a = ntohl(ipaddr->addr);
+  return (a ^ (a >> 8)) & (ARP_HASH_SIZE - 1);
+}
+
+/**
+ * Puts a newly filled in entry into the bucket of its IP address.
+ */
+static void
+etharp_hash_add(s8_t i)
+{
+  u8_t h = etharp_hash(&arp_table[i].ipaddr);
+  arp_table[i].next = arp_hash[h];
+  arp_hash[h] = i;
+}
+
+/**
+ * Takes an entry out of its bucket, before it is emptied.
+ */
+static void
+etharp_hash_remove(s8_t i)
+{
+  s8_t *link = &arp_hash[etharp_hash(&arp_table[i].ipaddr)];
+
+  while (*link != -1) {
+    if (*link == i) {
+      *link = arp_table[i].next;
+      break;
+    }
+    link = &arp_table[*link].next;
+  }
+  arp_table[i].next = -1;
+}
+
+/**
+ * Finds the pending or stable entry for an IP address.
+ *
+ * @return The ARP entry index, or -1 if the address is not in the table.
+ */
+static s8_t
+etharp_lookup(struct ip_addr *ipaddr)
+{
+  s8_t i;
+
+  if (arp_table[arp_last].state != ETHARP_STATE_EMPTY &&
+      ip_addr_cmp(ipaddr, &arp_table[arp_last].ipaddr)) {
+    return arp_last;
+  }
+  for (i = arp_hash[etharp_hash(ipaddr)]; i != -1; i = arp_table[i].next) {
+    if (ip_addr_cmp(ipaddr, &arp_table[i].ipaddr)) {
+      arp_last = i;
+      return i;
+    }
+  }
+  return -1;
 }
 
 /**
@@ -183,6 +258,7 @@ etharp_tmr(void)
       LWIP_DEBUGF(ETHARP_DEBUG, ("etharp_timer: expired pending entry %u.\n", i));
   empty:
       /* empty old entry */      
+      etharp_hash_remove(i);
       arp_table[i].state = ETHARP_STATE_EMPTY;
 #if ARP_QUEUEING
       /* and empty packet queue */
@@ -242,6 +318,7 @@ find_arp_entry(void)
     etharp_dequeue(i);
 #endif
     LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("find_arp_entry: recycling oldest stable entry %u\n", i));
+    etharp_hash_remove(i);
     arp_table[i].state = ETHARP_STATE_EMPTY;
     arp_table[i].ctime = 0;
   }
@@ -341,81 +418,76 @@ update_arp_entry(struct netif *netif, struct ip_addr *ipaddr, struct eth_addr *e
     LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: will not add 0.0.0.0 to ARP cache\n"));
     return NULL;
   }
-  /* Walk through the ARP mapping table and try to find an entry to
-  update. If none is found, the IP -> MAC address mapping is
-  inserted in the ARP table. */
-  for (i = 0; i < ARP_TABLE_SIZE; ++i) {
-    /* Check if the source IP address of the incoming packet matches
-    the IP address in this ARP table entry. */
-    if (ip_addr_cmp(ipaddr, &arp_table[i].ipaddr)) {
-      /* pending entry? */
-      if (arp_table[i].state == ETHARP_STATE_PENDING) {
-        LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: pending entry %u goes stable\n", i));
-        /* A pending entry was found, mark it stable */
-        arp_table[i].state = ETHARP_STATE_STABLE;
-        /* fall-through to next if */
-      }
-      /* stable entry? (possibly just marked to become stable) */
-      if (arp_table[i].state == ETHARP_STATE_STABLE) {
+  /* Look the IP address up in the ARP mapping table and update its
+  entry. If there is none, the IP -> MAC address mapping is inserted
+  in the ARP table. */
+  i = etharp_lookup(ipaddr);
+  if (i != -1) {
+    /* pending entry? */
+    if (arp_table[i].state == ETHARP_STATE_PENDING) {
+      LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: pending entry %u goes stable\n", i));
+      /* A pending entry was found, mark it stable */
+      arp_table[i].state = ETHARP_STATE_STABLE;
+      /* fall-through to next if */
+    }
+    /* stable entry? (possibly just marked to become stable) */
+    if (arp_table[i].state == ETHARP_STATE_STABLE) {
 #if ARP_QUEUEING
-        struct pbuf *p;
-        struct eth_hdr *ethhdr;
+      struct pbuf *p;
+      struct eth_hdr *ethhdr;
 #endif
-        LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: updating stable entry %u\n", i));
-        /* An old entry found, update this and return. */
-        for (k = 0; k < netif->hwaddr_len; ++k) {
-          arp_table[i].ethaddr.addr[k] = ethaddr->addr[k];
-        }
-        /* reset time stamp */
-        arp_table[i].ctime = 0;
+      LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: updating stable entry %u\n", i));
+      /* An old entry found, update this and return. */
+      for (k = 0; k < netif->hwaddr_len; ++k) {
+        arp_table[i].ethaddr.addr[k] = ethaddr->addr[k];
+      }
+      /* reset time stamp */
+      arp_table[i].ctime = 0;
 /* this is where we will send out queued packets! */
 #if ARP_QUEUEING
-        /* get the first packet on the queue (if any) */
-        p = arp_table[i].p;
-        /* (another) queued packet present? */
-        while (p != NULL) {
-          struct pbuf *q, *n;
-          /* search for second packet on queue (n) */
-          q = p;
-          while (q->tot_len > q->len) {
-            LWIP_ASSERT("q->next != NULL (while q->tot_len > q->len)", q->next != NULL);
-            /* proceed to next pbuf of this packet */
-            q = q->next;
-          }
-          /* { q = last pbuf of this packet, q->tot_len == q->len } */
-          LWIP_ASSERT("q->tot_len == q->len", q->tot_len == q->len);
-          /* remember next packet on queue */
-          n = q->next;
-          /* { n = first pbuf of next packet, or NULL if no next packet } */
-          /* terminate this packet pbuf chain */
-          q->next = NULL;
-          /* fill-in Ethernet header */
-          ethhdr = p->payload;
-          for (k = 0; k < netif->hwaddr_len; ++k) {
-            ethhdr->dest.addr[k] = ethaddr->addr[k];
-            ethhdr->src.addr[k] = netif->hwaddr[k];
-          }
-          ethhdr->type = htons(ETHTYPE_IP);
-          LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: sending queued IP packet %p.\n", (void *)p));
-          /* send the queued IP packet */
-          netif->linkoutput(netif, p);
-          /* free the queued IP packet */
-          pbuf_free(p);
-          /* proceed to next packet on queue */
-          p = n;
+      /* get the first packet on the queue (if any) */
+      p = arp_table[i].p;
+      /* (another) queued packet present? */
+      while (p != NULL) {
+        struct pbuf *q, *n;
+        /* search for second packet on queue (n) */
+        q = p;
+        while (q->tot_len > q->len) {
+          LWIP_ASSERT("q->next != NULL (while q->tot_len > q->len)", q->next != NULL);
+          /* proceed to next pbuf of this packet */
+          q = q->next;
         }
-        /* NULL attached buffer*/
-        arp_table[i].p = NULL;
-#endif
-        /* IP addresses should only occur once in the ARP entry, we are done */
-        return NULL;
+        /* { q = last pbuf of this packet, q->tot_len == q->len } */
+        LWIP_ASSERT("q->tot_len == q->len", q->tot_len == q->len);
+        /* remember next packet on queue */
+        n = q->next;
+        /* { n = first pbuf of next packet, or NULL if no next packet } */
+        /* terminate this packet pbuf chain */
+        q->next = NULL;
+        /* fill-in Ethernet header */
+        ethhdr = p->payload;
+        for (k = 0; k < netif->hwaddr_len; ++k) {
+          ethhdr->dest.addr[k] = ethaddr->addr[k];
+          ethhdr->src.addr[k] = netif->hwaddr[k];
+        }
+        ethhdr->type = htons(ETHTYPE_IP);
+        LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: sending queued IP packet %p.\n", (void *)p));
+        /* send the queued IP packet */
+        netif->linkoutput(netif, p);
+        /* free the queued IP packet */
+        pbuf_free(p);
+        /* proceed to next packet on queue */
+        p = n;
       }
-    } /* if STABLE */
-  } /* for all ARP entries */
+      /* NULL attached buffer*/
+      arp_table[i].p = NULL;
+#endif
+      /* IP addresses should only occur once in the ARP entry, we are done */
+      return NULL;
+    }
+  } /* if found */
 
   /* no matching ARP entry was found */
-  LWIP_ASSERT("update_arp_entry: i == ARP_TABLE_SIZE", i == ARP_TABLE_SIZE);
-
   LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("update_arp_entry: IP address not yet in table\n"));
   /* allowed to insert an entry? */
   if ((ETHARP_ALWAYS_INSERT) || (flags & ARP_INSERT_FLAG))
@@ -438,6 +510,7 @@ update_arp_entry(struct netif *netif, struct ip_addr *ipaddr, struct eth_addr *e
     arp_table[i].ctime = 0;
     /* mark as stable */
     arp_table[i].state = ETHARP_STATE_STABLE;
+    etharp_hash_add(i);
     /* no queued packet */
 #if ARP_QUEUEING
     arp_table[i].p = NULL;
@@ -478,6 +551,13 @@ etharp_ip_input(struct netif *netif, struct pbuf *p)
     /* do nothing */
     return NULL;
   }
+#if ETHARP_LEARN_OWN_ONLY
+  /* broadcasts of the other hosts on a busy segment would fill the
+     table with peers we never talk to */
+  if (!ip_addr_cmp(&(hdr->ip.dest), &(netif->ip_addr))) {
+    return NULL;
+  }
+#endif
 
   LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("etharp_ip_input: updating ETHARP table.\n"));
   /* update ARP table, ask to insert entry */
@@ -684,13 +764,9 @@ etharp_output(struct netif *netif, struct ip_addr *ipaddr, struct pbuf *q)
     }
 
     /* Ethernet address for IP destination address is in ARP cache? */
-    for (i = 0; i < ARP_TABLE_SIZE; ++i) {
-      /* match found? */
-      if (arp_table[i].state == ETHARP_STATE_STABLE &&
-        ip_addr_cmp(ipaddr, &arp_table[i].ipaddr)) {
-        dest = &arp_table[i].ethaddr;
-        break;
-      }
+    i = etharp_lookup(ipaddr);
+    if (i != -1 && arp_table[i].state == ETHARP_STATE_STABLE) {
+      dest = &arp_table[i].ethaddr;
     }
     /* could not find the destination Ethernet address in ARP cache? */
     if (dest == NULL) {
@@ -762,31 +838,28 @@ err_t etharp_query(struct netif *netif, struct ip_addr *ipaddr, struct pbuf *q)
   (void)q;
   srcaddr = (struct eth_addr *)netif->hwaddr;
   /* bail out if this IP address is pending */
-  for (i = 0; i < ARP_TABLE_SIZE; ++i) {
-    if (ip_addr_cmp(ipaddr, &arp_table[i].ipaddr)) {
-      if (arp_table[i].state == ETHARP_STATE_PENDING) {
-        LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE | DBG_STATE, ("etharp_query: requested IP already pending as entry %u\n", i));
-        /* break out of for-loop, user may wish to queue a packet on a pending entry */
-        /* TODO: we will issue a new ARP request, which should not occur too often */
-        /* we might want to run a faster timer on ARP to limit this */
-        break;
-      }
-      else if (arp_table[i].state == ETHARP_STATE_STABLE) {
-        LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE | DBG_STATE, ("etharp_query: requested IP already stable as entry %u\n", i));
-        /* User wishes to queue a packet on a stable entry (or does she want to send
-         * out the packet immediately, we will not know), so we force an ARP request.
-         * Upon response we will send out the queued packet in etharp_update().
-         * 
-         * Alternatively, we could accept the stable entry, and just send out the packet
-         * immediately. I chose to implement the former approach.
-         */
-        perform_arp_request = (q?1:0);
-        break;
-      }
+  i = etharp_lookup(ipaddr);
+  if (i != -1) {
+    if (arp_table[i].state == ETHARP_STATE_PENDING) {
+      LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE | DBG_STATE, ("etharp_query: requested IP already pending as entry %u\n", i));
+      /* user may wish to queue a packet on a pending entry */
+      /* TODO: we will issue a new ARP request, which should not occur too often */
+      /* we might want to run a faster timer on ARP to limit this */
+    }
+    else if (arp_table[i].state == ETHARP_STATE_STABLE) {
+      LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE | DBG_STATE, ("etharp_query: requested IP already stable as entry %u\n", i));
+      /* User wishes to queue a packet on a stable entry (or does she want to send
+       * out the packet immediately, we will not know), so we force an ARP request.
+       * Upon response we will send out the queued packet in etharp_update().
+       * 
+       * Alternatively, we could accept the stable entry, and just send out the packet
+       * immediately. I chose to implement the former approach.
+       */
+      perform_arp_request = (q?1:0);
     }
   }
   /* queried address not yet in ARP table? */
-  if (i == ARP_TABLE_SIZE) {
+  if (i == -1) {
     LWIP_DEBUGF(ETHARP_DEBUG | DBG_TRACE, ("etharp_query: IP address not found in ARP table\n"));
     /* find an available (unused or old) entry */
     i = find_arp_entry();
@@ -798,6 +871,7 @@ err_t etharp_query(struct netif *netif, struct ip_addr *ipaddr, struct pbuf *q)
     /* i is available, create ARP entry */
     arp_table[i].state = ETHARP_STATE_PENDING;
     ip_addr_set(&arp_table[i].ipaddr, ipaddr);
+    etharp_hash_add(i);
   }
   /* { i is now valid } */
 #if ARP_QUEUEING /* queue packet (even on a stable entry, see above) */
@@ -0,0 +1,304 @@
+/*
+ * Fleet flashing, the receiving end. See fleet.h for the packets.
+ *
+ * Chunks are written straight into the staging area and marked in a
+ * bitmap. Whenever a pass ends, or the sender has been quiet for a
+ * while, the missing ranges are NAKed to the sender. Once all chunks
+ * are in and the SHA-1 of the image matches the announced one, the
+ * image is flashed like a web upload.
+ *
+ * lwIP here has no IGMP and ip_input only takes packets for our own
+ * address or broadcasts, so the sender broadcasts on the subnet.
+ */
+
+#include "lwip/udp.h"
+#include "lwip/inet.h"
+#include "lwip/netif.h"
+
+#include "boot.h"
+#include "memory_layout.h"
+#include "sha1.h"
+#include "httpd.h"
+#include "fleet.h"
+#include "netpanel.h"
+
+#define FLEET_MAX_CHUNKS (FLASH_STAGING_SIZE / FLEET_CHUNK_MIN)
+
+/* timer ticks without data before the missing chunks are NAKed */
+#define FLEET_IDLE_NAK 4
+
+enum fleet_state {
+	FL_IDLE,
+	FL_RECEIVING,
+	FL_CHECK,	/* all chunks in, checked from fleet_tmr */
+	FL_BUSY,	/* a web upload has the staging area, the next
+			   announce tries again */
+	FL_DONE		/* this session is finished with, good or bad */
+};
+
+static struct {
+	struct udp_pcb *pcb;
+	enum fleet_state state;
+	u32_t session;
+	u32_t len;
+	u16_t chunk;
+	u32_t nchunks;
+	u32_t missing;
+	u8_t sha1[SHA1HashSize];
+	u8_t have[FLEET_MAX_CHUNKS / 8];
+	char *image;
+
+	struct ip_addr sender;
+	u16_t port;
+	int idle;	/* timer ticks since the last chunk */
+	int nakin;	/* ticks until a NAK is due, 0 for none */
+} fl;
+
+static u32_t
+fleet_get32(const u8_t *p)
+{
+	return ((u32_t)p[0] << 24) | ((u32_t)p[1] << 16) | ((u32_t)p[2] << 8) | p[3];
+}
+
+static void
+fleet_put32(u8_t *p, u32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+/* copies len bytes from offset off of a pbuf chain */
+static void
+fleet_copy(struct pbuf *p, int off, u8_t *dest, int len)
+{
+	for (; p != NULL && len > 0; p = p->next) {
+		int n;
+
+		if (off >= p->len) {
+			off -= p->len;
+			continue;
+		}
+		n = p->len - off;
+		if (n > len)
+			n = len;
+		memcpy (dest, (u8_t *)p->payload + off, n);
+		dest += n;
+		len -= n;
+		off = 0;
+	}
+}
+
+static struct pbuf *
+fleet_packet(int type, int len)
+{
+	struct pbuf *p = pbuf_alloc (PBUF_TRANSPORT, len, PBUF_RAM);
+	u8_t *b;
+
+	if (p == NULL)
+		return NULL;
+	b = p->payload;
+	memset (b, 0, len);
+	memcpy (b, FLEET_MAGIC, 4);
+	b[4] = type;
+	b[5] = FLEET_VERSION;
+	fleet_put32 (&b[8], fl.session);
+	return p;
+}
+
+static void
+fleet_send(struct pbuf *p)
+{
+	udp_sendto (fl.pcb, p, &fl.sender, fl.port);
+	pbuf_free (p);
+}
+
+static void
+fleet_status(int status)
+{
+	struct pbuf *p = fleet_packet (FLEET_STATUS, FLEET_STATUS_LEN);
+
+	if (p == NULL)
+		return;
+	((u8_t *)p->payload)[12] = status;
+	fleet_send (p);
+}
+
+static int
+fleet_has(u32_t n)
+{
+	return fl.have[n >> 3] & (1 << (n & 7));
+}
+
+/* tells the sender which chunks are still missing, as many ranges as
+   fit; the rest follow with the next NAK */
+static void
+fleet_nak(void)
+{
+	struct pbuf *p = fleet_packet (FLEET_NAK, FLEET_HDR_LEN + 4 + 8 * FLEET_NAK_MAX);
+	u8_t *b;
+	u32_t n = 0, first;
+	int ranges = 0;
+
+	if (p == NULL)
+		return;
+	b = p->payload;
+	while (n < fl.nchunks && ranges < FLEET_NAK_MAX) {
+		if (fleet_has (n)) {
+			n++;
+			continue;
+		}
+		first = n;
+		while (n < fl.nchunks && !fleet_has (n))
+			n++;
+		fleet_put32 (&b[16 + 8 * ranges], first);
+		fleet_put32 (&b[20 + 8 * ranges], n - first);
+		ranges++;
+	}
+	b[12] = ranges >> 8;
+	b[13] = ranges;
+	pbuf_realloc (p, 16 + 8 * ranges);
+	fleet_send (p);
+}
+
+static void
+fleet_announce(struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+	u8_t b[FLEET_ANNOUNCE_LEN];
+	u32_t session, len;
+	u16_t chunk;
+
+	if (p->tot_len < FLEET_ANNOUNCE_LEN)
+		return;
+	fleet_copy (p, 0, b, FLEET_ANNOUNCE_LEN);
+	session = fleet_get32 (&b[8]);
+
+	if (session != fl.session || fl.state == FL_IDLE || fl.state == FL_BUSY) {
+		len = fleet_get32 (&b[12]);
+		chunk = (b[16] << 8) | b[17];
+		if (len == 0 || len > FLASH_STAGING_SIZE ||
+		    chunk < FLEET_CHUNK_MIN || chunk > FLEET_CHUNK_MAX)
+			return;
+
+		fl.session = session;
+		ip_addr_set (&fl.sender, addr);
+		fl.port = port;
+		fl.image = httpd_staging_claim (&fl);
+		if (fl.image == NULL) {
+			fl.state = FL_BUSY;
+			fleet_status (FLEET_ST_BUSY);
+			return;
+		}
+		fl.len = len;
+		fl.chunk = chunk;
+		fl.nchunks = (len + chunk - 1) / chunk;
+		fl.missing = fl.nchunks;
+		memcpy (fl.sha1, &b[20], SHA1HashSize);
+		memset (fl.have, 0, sizeof (fl.have));
+		fl.idle = 0;
+		fl.nakin = 0;
+		fl.state = FL_RECEIVING;
+		netpanel_transfer ("Fleet flashing", addr, len);
+		printk ("Fleet flashing: receiving %d bytes from %d.%d.%d.%d\n", (int)len,
+			ip4_addr1(addr), ip4_addr2(addr), ip4_addr3(addr), ip4_addr4(addr));
+	}
+
+	/* NAK after a pass, at a time of its own for each box so the
+	   sender is not hit by all of them at once */
+	if (fl.state == FL_RECEIVING && (((b[18] << 8) | b[19]) & FLEET_END_OF_PASS) &&
+	    fl.nakin == 0 && netif_default != NULL)
+		fl.nakin = 1 + (ip4_addr4(&netif_default->ip_addr) & 3);
+}
+
+static void
+fleet_data(struct pbuf *p)
+{
+	u8_t b[FLEET_HDR_LEN + 4];
+	u32_t n, len;
+
+	if (fl.state != FL_RECEIVING || p->tot_len < sizeof (b))
+		return;
+	fleet_copy (p, 0, b, sizeof (b));
+	n = fleet_get32 (&b[12]);
+	if (fleet_get32 (&b[8]) != fl.session || n >= fl.nchunks)
+		return;
+
+	fl.idle = 0;
+	if (fleet_has (n))
+		return;
+	len = n == fl.nchunks - 1 ? fl.len - n * fl.chunk : fl.chunk;
+	if (p->tot_len - sizeof (b) != len)
+		return;
+
+	fleet_copy (p, sizeof (b), (u8_t *)fl.image + n * fl.chunk, len);
+	fl.have[n >> 3] |= 1 << (n & 7);
+	netpanel_progress (len);
+	if (--fl.missing == 0)
+		fl.state = FL_CHECK;
+}
+
+static void
+fleet_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+	u8_t b[FLEET_HDR_LEN];
+
+	if (p->tot_len >= FLEET_HDR_LEN) {
+		fleet_copy (p, 0, b, FLEET_HDR_LEN);
+		if (memcmp (b, FLEET_MAGIC, 4) == 0 && b[5] == FLEET_VERSION) {
+			if (b[4] == FLEET_ANNOUNCE)
+				fleet_announce (p, addr, port);
+			else if (b[4] == FLEET_DATA)
+				fleet_data (p);
+		}
+	}
+	pbuf_free (p);
+}
+
+void
+fleet_init(void)
+{
+	fl.pcb = udp_new ();
+	if (fl.pcb == NULL)
+		return;
+	udp_bind (fl.pcb, IP_ADDR_ANY, FLEET_PORT);
+	udp_recv (fl.pcb, fleet_recv, NULL);
+}
+
+/* called every FLEET_TMR_INTERVAL ms from the main loop */
+void
+fleet_tmr(void)
+{
+	SHA1Context sha1;
+	u8_t digest[SHA1HashSize];
+
+	if (fl.state == FL_RECEIVING) {
+		if ((fl.nakin && --fl.nakin == 0) || ++fl.idle >= FLEET_IDLE_NAK) {
+			fl.nakin = 0;
+			fl.idle = 0;
+			fleet_nak ();
+		}
+		return;
+	}
+	if (fl.state != FL_CHECK)
+		return;
+
+	SHA1Reset (&sha1);
+	SHA1Input (&sha1, (const uint8_t *)fl.image, fl.len);
+	SHA1Result (&sha1, digest);
+	if (memcmp (digest, fl.sha1, SHA1HashSize) != 0) {
+		printk ("Fleet flashing: SHA-1 mismatch, waiting for the next pass\n");
+		fleet_status (FLEET_ST_BADHASH);
+		memset (fl.have, 0, sizeof (fl.have));
+		fl.missing = fl.nchunks;
+		fl.state = FL_RECEIVING;
+		return;
+	}
+
+	fleet_status (FLEET_ST_FLASHING);
+	/* only returns if the image must not be flashed */
+	httpd_flash_image (fl.image, fl.len);
+	fleet_status (FLEET_ST_REJECTED);
+	httpd_staging_release (&fl);
+	fl.state = FL_DONE;
+}
@@ -0,0 +1,67 @@
+#ifndef __FLEET_H__
+#define __FLEET_H__
+
+/*
+ * Fleet flashing: one sender broadcasts a BIOS image to every box in
+ * web flasher mode on the subnet. This header describes the packets
+ * and is shared with the host sender, lib/fleetsend/fleetsend.c.
+ *
+ * All packets start with the same 12 bytes, numbers are big endian:
+ *
+ *	0	"XFLT"
+ *	4	type
+ *	5	FLEET_VERSION
+ *	6	reserved, 0
+ *	8	session, picked by the sender for each image
+ *
+ * ANNOUNCE, sender to all, sent again from time to time:
+ *	12	image length
+ *	16	chunk size
+ *	18	flags, FLEET_END_OF_PASS after the last chunk of a pass
+ *	20	SHA-1 of the image
+ *
+ * DATA, sender to all:
+ *	12	chunk number, the chunk follows
+ *
+ * NAK, box to sender, the chunks it misses:
+ *	12	number of ranges, at most FLEET_NAK_MAX
+ *	14	reserved, 0
+ *	16	ranges of first chunk and number of chunks, 4 bytes each
+ *
+ * STATUS, box to sender, once the image is complete or refused:
+ *	12	one of FLEET_ST_...
+ */
+
+#define FLEET_PORT		4747
+#define FLEET_MAGIC		"XFLT"
+#define FLEET_VERSION		1
+
+#define FLEET_ANNOUNCE		1
+#define FLEET_DATA		2
+#define FLEET_NAK		3
+#define FLEET_STATUS		4
+
+#define FLEET_HDR_LEN		12
+#define FLEET_ANNOUNCE_LEN	40
+#define FLEET_NAK_MAX		64
+#define FLEET_STATUS_LEN	13
+
+#define FLEET_END_OF_PASS	1
+
+/* chunks have to fit a frame together with the headers */
+#define FLEET_CHUNK_MIN		256
+#define FLEET_CHUNK_MAX		1408
+#define FLEET_CHUNK_DEFAULT	1024
+
+#define FLEET_ST_FLASHING	0	/* SHA-1 matched, the box flashes */
+#define FLEET_ST_BADHASH	1	/* SHA-1 mismatch, waits for the next pass */
+#define FLEET_ST_REJECTED	2	/* not a BIOS image it may flash */
+#define FLEET_ST_BUSY		3	/* a web upload has the staging area, the
+					   box tries again at the next ANNOUNCE */
+
+#define FLEET_TMR_INTERVAL	250
+
+void fleet_init(void);
+void fleet_tmr(void);
+
+#endif /* __FLEET_H__ */
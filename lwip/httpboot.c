@@ -0,0 +1,577 @@
+/*
+ * Network boot over HTTP.
+ *
+ * A boot script is fetched first, from the URL in DHCP option 67 (or
+ * the DHCP boot file name) if it starts with http://, else from
+ * NET_BOOT_URL in config.h. It takes the linuxboot.cfg keywords, plus
+ * one for a BIOS image:
+ *
+ *	kernel http://192.168.0.1/xbox/vmlinuz
+ *	initrd initrd.gz
+ *	append root=/dev/ram0 video=xbox:640x480
+ *	bios cromwell.bin
+ *
+ * URLs without http:// are taken relative to the script. With a bios
+ * line the image is checked and flashed like an upload, and the box
+ * resets. Otherwise the kernel and the initrd are fetched and booted.
+ *
+ * Files are written from the TCP receive callback straight to where
+ * they are used: the kernel setup to KERNEL_SETUP, the rest of the
+ * kernel to KERNEL_PM_CODE and the initrd to INITRD_START. There is
+ * no DNS, hosts have to be given as addresses.
+ */
+
+#include "lwip/tcp.h"
+#include "lwip/inet.h"
+#include "lwip/dhcp.h"
+
+#include "boot.h"
+#include "memory_layout.h"
+#include "httpd.h"
+#include "httpboot.h"
+#include "netpanel.h"
+#include "ebd.h"
+
+int sprintf(char * buf, const char *fmt, ...);
+int strncmp(const char * cs, const char * ct, size_t count);
+size_t strlen(const char * s);
+unsigned long simple_strtoul(const char *cp, char **endp, unsigned int base);
+
+/* longest URL, and longest header or script line */
+#define HB_URL_MAX 256
+#define HB_LINE_MAX 512
+
+/* the boot script has to fit here */
+#define HB_SCRIPT_MAX 2048
+
+/* tcp_poll calls, one every two seconds, without data before a
+   download is given up */
+#define HB_IDLE_POLLS 10
+
+/* no Content-Length, the body ends when the server closes */
+#define HB_NO_LENGTH 0xffffffffUL
+
+/* the kernel setup sectors must not reach the GDT */
+#define HB_SETUP_MAX (GDT_LOC - KERNEL_SETUP)
+
+/* what is being fetched, in order */
+enum hb_step {
+	HB_IDLE,
+	HB_SCRIPT,
+	HB_BIOS,
+	HB_KERNEL,
+	HB_INITRD,
+	HB_FLASH,	/* downloads done, waiting for httpboot_poll */
+	HB_BOOT,
+	HB_FAILED
+};
+
+static struct {
+	enum hb_step step;
+	int busy;			/* a download is under way */
+	struct tcp_pcb *pcb;
+	int idle;
+
+	/* the response being parsed */
+	char line[HB_LINE_MAX];
+	int linepos;
+	int inbody;
+	int status;
+	u32_t length;			/* Content-Length, or HB_NO_LENGTH */
+	u32_t got;
+	u32_t max;
+	int (*sink)(const char *data, int len, u32_t off);
+	u32_t start;			/* ebd_clock() */
+
+	/* from the script */
+	char script[HB_SCRIPT_MAX + 1];
+	char base[HB_URL_MAX];		/* URL of the script */
+	char kernel[HB_URL_MAX];
+	char initrd[HB_URL_MAX];
+	char bios[HB_URL_MAX];
+	char append[HB_LINE_MAX];
+
+	u32_t setuplen;
+	u32_t kernellen;
+	u32_t initrdlen;
+	u32_t bioslen;
+} hb;
+
+static void hb_fail(const char *why);
+
+/* case blind match of a header name */
+static int
+hb_header_is(const char *line, const char *name)
+{
+	for (; *name; line++, name++)
+		if ((*line | 0x20) != (*name | 0x20))
+			return 0;
+	return 1;
+}
+
+/*
+ * Splits http://a.b.c.d[:port]/path into address, port and path.
+ * Returns 0 if the URL is not one we can fetch.
+ */
+static int
+hb_parse_url(const char *url, struct ip_addr *addr, u16_t *port, const char **path)
+{
+	char host[16];
+	struct in_addr a;
+	int i;
+
+	if (strncmp (url, "http://", 7) != 0)
+		return 0;
+	url += 7;
+	for (i = 0; url[i] && url[i] != ':' && url[i] != '/'; i++) {
+		if (i == sizeof (host) - 1)
+			return 0;
+		host[i] = url[i];
+	}
+	host[i] = 0;
+	if (!inet_aton (host, &a))
+		return 0;
+	addr->addr = a.s_addr;
+
+	url += i;
+	*port = 80;
+	if (*url == ':')
+		*port = simple_strtoul (url + 1, (char **)&url, 10);
+	*path = *url == '/' ? url : "/";
+	return 1;
+}
+
+/* a URL from the script, resolved against the script's own URL */
+static void
+hb_resolve(char *dest, const char *url)
+{
+	const char *slash;
+	int n;
+
+	if (strncmp (url, "http://", 7) == 0 || hb.base[0] == 0) {
+		n = 0;
+	} else if (url[0] == '/') {
+		/* the server part of the base */
+		slash = hb.base + 7;
+		while (*slash && *slash != '/')
+			slash++;
+		n = slash - hb.base;
+	} else {
+		slash = hb.base + strlen (hb.base);
+		while (slash > hb.base && slash[-1] != '/')
+			slash--;
+		n = slash - hb.base;
+	}
+	if (n + strlen (url) >= HB_URL_MAX) {
+		dest[0] = 0;
+		return;
+	}
+	memcpy (dest, hb.base, n);
+	strcpy (dest + n, url);
+}
+
+/* the value after the keyword, up to the end of the line */
+static const char *
+hb_value(const char *line, const char *key)
+{
+	int n = strlen (key);
+
+	if (strncmp (line, key, n) != 0 || (line[n] != ' ' && line[n] != '\t'))
+		return NULL;
+	line += n;
+	while (*line == ' ' || *line == '\t')
+		line++;
+	return line;
+}
+
+static void
+hb_parse_script(void)
+{
+	char *line, *end;
+	const char *v;
+
+	hb.script[hb.got] = 0;
+	hb.kernel[0] = hb.initrd[0] = hb.bios[0] = hb.append[0] = 0;
+	for (line = hb.script; *line; line = end) {
+		end = line;
+		while (*end && *end != '\n')
+			end++;
+		if (*end)
+			*end++ = 0;
+		if (end - line >= 2 && end[-2] == '\r')
+			end[-2] = 0;
+
+		if ((v = hb_value (line, "kernel")) != NULL)
+			hb_resolve (hb.kernel, v);
+		else if ((v = hb_value (line, "initrd")) != NULL)
+			hb_resolve (hb.initrd, v);
+		else if ((v = hb_value (line, "bios")) != NULL)
+			hb_resolve (hb.bios, v);
+		else if ((v = hb_value (line, "append")) != NULL &&
+			 strlen (v) < sizeof (hb.append))
+			strcpy (hb.append, v);
+	}
+}
+
+static int
+hb_script_sink(const char *data, int len, u32_t off)
+{
+	memcpy (&hb.script[off], data, len);
+	return 1;
+}
+
+static int
+hb_bios_sink(const char *data, int len, u32_t off)
+{
+	memcpy ((char *)FLASH_STAGING_START + off, data, len);
+	return 1;
+}
+
+/* the setup sectors go to KERNEL_SETUP, the rest to KERNEL_PM_CODE */
+static int
+hb_kernel_sink(const char *data, int len, u32_t off)
+{
+	while (len > 0) {
+		int n;
+
+		if (off < hb.setuplen) {
+			n = hb.setuplen - off;
+			if (n > len)
+				n = len;
+			memcpy ((char *)KERNEL_SETUP + off, data, n);
+			/* the boot sector says how many setup sectors follow */
+			if (off + n == 512 && hb.setuplen == 512) {
+				u8_t sects = ((u8_t *)KERNEL_SETUP)[0x1f1];
+
+				hb.setuplen = ((sects ? sects : 4) + 1) * 512;
+				if (hb.setuplen > HB_SETUP_MAX)
+					return 0;
+			}
+		} else {
+			n = len;
+			if (off - hb.setuplen + n > MAX_KERNEL_SIZE)
+				return 0;
+			memcpy ((char *)KERNEL_PM_CODE + off - hb.setuplen, data, n);
+		}
+		data += n;
+		off += n;
+		len -= n;
+	}
+	return 1;
+}
+
+static int
+hb_initrd_sink(const char *data, int len, u32_t off)
+{
+	memcpy ((char *)INITRD_START + off, data, len);
+	return 1;
+}
+
+/* takes in a piece of the response, returns 0 to give up */
+static int
+hb_input(const char *data, int len)
+{
+	while (len > 0 && !hb.inbody) {
+		char c = *data++;
+
+		len--;
+		if (c == '\r')
+			continue;
+		if (c != '\n') {
+			if (hb.linepos < HB_LINE_MAX - 1)
+				hb.line[hb.linepos++] = c;
+			continue;
+		}
+		hb.line[hb.linepos] = 0;
+		hb.linepos = 0;
+
+		if (hb.status == 0) {
+			/* HTTP/1.x 200 OK */
+			if (strncmp (hb.line, "HTTP/", 5) != 0)
+				return 0;
+			hb.status = simple_strtoul (hb.line + 9, NULL, 10);
+			if (hb.status != 200) {
+				printk ("HTTP boot: server answered %s\n", hb.line);
+				return 0;
+			}
+		} else if (hb.line[0] == 0) {
+			hb.inbody = 1;
+		} else if (hb_header_is (hb.line, "Content-Length:")) {
+			hb.length = simple_strtoul (hb.line + 15 + (hb.line[15] == ' '), NULL, 10);
+			if (hb.length > hb.max) {
+				printk ("HTTP boot: %d bytes do not fit\n", (int)hb.length);
+				return 0;
+			}
+			netpanel.expected = hb.length;
+		}
+	}
+
+	if (len > 0) {
+		if (hb.got + len > hb.max) {
+			printk ("HTTP boot: more than %d bytes\n", (int)hb.max);
+			return 0;
+		}
+		if (!hb.sink (data, len, hb.got))
+			return 0;
+		hb.got += len;
+		netpanel_progress (len);
+	}
+	return 1;
+}
+
+static void
+hb_close(void)
+{
+	if (hb.pcb == NULL)
+		return;
+	tcp_arg (hb.pcb, NULL);
+	tcp_recv (hb.pcb, NULL);
+	tcp_err (hb.pcb, NULL);
+	tcp_poll (hb.pcb, NULL, 0);
+	if (tcp_close (hb.pcb) != ERR_OK)
+		tcp_abort (hb.pcb);
+	hb.pcb = NULL;
+}
+
+/* a download has ended with the server closing the connection */
+static void
+hb_done(void)
+{
+	u32_t ms = (ebd_clock () - hb.start) / EBD_TICKS_PER_MS;
+
+	hb_close ();
+	hb.busy = 0;
+	if (!hb.inbody || (hb.length != HB_NO_LENGTH && hb.got != hb.length)) {
+		hb_fail ("connection closed early");
+		return;
+	}
+	if (ms > 0 && hb.got > 64 * 1024)
+		printk ("HTTP boot: %d bytes in %d ms, %d KB/s\n", (int)hb.got,
+			(int)ms, (int)(hb.got / 1024 * 1000 / ms));
+
+	switch (hb.step) {
+	case HB_SCRIPT:
+		hb_parse_script ();
+		if (hb.bios[0]) {
+			hb.step = HB_BIOS;
+		} else if (hb.kernel[0]) {
+			hb.step = HB_KERNEL;
+		} else {
+			hb_fail ("the boot script names no kernel and no bios");
+		}
+		break;
+	case HB_BIOS:
+		hb.bioslen = hb.got;
+		hb.step = HB_FLASH;
+		break;
+	case HB_KERNEL:
+		if (hb.got <= hb.setuplen ||
+		    memcmp ((char *)KERNEL_SETUP + 0x202, "HdrS", 4) != 0) {
+			hb_fail ("not a bzImage kernel");
+			return;
+		}
+		hb.kernellen = hb.got;
+		hb.step = hb.initrd[0] ? HB_INITRD : HB_BOOT;
+		break;
+	case HB_INITRD:
+		hb.initrdlen = hb.got;
+		hb.step = HB_BOOT;
+		break;
+	default:
+		break;
+	}
+}
+
+static err_t
+hb_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+	struct pbuf *q;
+
+	if (err != ERR_OK || p == NULL) {
+		if (p != NULL)
+			pbuf_free (p);
+		hb_done ();
+		return ERR_OK;
+	}
+
+	hb.idle = 0;
+	for (q = p; q != NULL; q = q->next) {
+		if (!hb_input (q->payload, q->len)) {
+			pbuf_free (p);
+			hb_close ();
+			hb.busy = 0;
+			hb_fail ("download aborted");
+			return ERR_OK;
+		}
+	}
+	/* the data is where it belongs, the window can open again */
+	tcp_recved (pcb, p->tot_len);
+	pbuf_free (p);
+	return ERR_OK;
+}
+
+static void
+hb_err(void *arg, err_t err)
+{
+	/* the pcb is gone already */
+	hb.pcb = NULL;
+	hb.busy = 0;
+	hb_fail ("connection failed");
+}
+
+static err_t
+hb_poll(void *arg, struct tcp_pcb *pcb)
+{
+	if (++hb.idle == HB_IDLE_POLLS) {
+		tcp_err (pcb, NULL);
+		tcp_abort (pcb);
+		hb.pcb = NULL;
+		hb.busy = 0;
+		hb_fail ("server stopped sending");
+		return ERR_ABRT;
+	}
+	return ERR_OK;
+}
+
+static err_t
+hb_connected(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+	struct ip_addr addr;
+	const char *path;
+	char *req = hb.line;
+	u16_t port;
+	int len;
+
+	if (err != ERR_OK)
+		return err;
+	hb_parse_url (arg, &addr, &port, &path);
+	len = sprintf (req, "GET %s HTTP/1.0\r\nHost: %d.%d.%d.%d\r\n"
+		       "User-Agent: " PROG_NAME "/" VERSION "\r\n\r\n",
+		       path, ip4_addr1(&addr), ip4_addr2(&addr),
+		       ip4_addr3(&addr), ip4_addr4(&addr));
+	if (tcp_write (pcb, req, len, 1) != ERR_OK)
+		return ERR_MEM;
+	tcp_output (pcb);
+	return ERR_OK;
+}
+
+/* starts fetching url, the body goes to sink, at most max bytes */
+static void
+hb_fetch(const char *url, u32_t max, int (*sink)(const char *, int, u32_t))
+{
+	struct ip_addr addr;
+	const char *path;
+	u16_t port;
+
+	if (!hb_parse_url (url, &addr, &port, &path)) {
+		printk ("HTTP boot: cannot fetch %s (http://address/path only)\n", url);
+		hb_fail ("bad URL");
+		return;
+	}
+	printk ("HTTP boot: %s\n", url);
+
+	hb.linepos = 0;
+	hb.inbody = 0;
+	hb.status = 0;
+	hb.length = HB_NO_LENGTH;
+	hb.got = 0;
+	hb.max = max;
+	hb.sink = sink;
+	hb.idle = 0;
+	hb.start = ebd_clock ();
+	netpanel_transfer ("HTTP boot", &addr, 0);
+
+	hb.pcb = tcp_new ();
+	if (hb.pcb == NULL) {
+		hb_fail ("out of connections");
+		return;
+	}
+	hb.busy = 1;
+	tcp_arg (hb.pcb, (void *)url);
+	tcp_recv (hb.pcb, hb_recv);
+	tcp_err (hb.pcb, hb_err);
+	tcp_poll (hb.pcb, hb_poll, 4);
+	if (tcp_connect (hb.pcb, &addr, port, hb_connected) != ERR_OK) {
+		hb_close ();
+		hb.busy = 0;
+		hb_fail ("cannot connect");
+	}
+}
+
+static void
+hb_fail(const char *why)
+{
+	printk ("HTTP boot failed: %s\n", why);
+	if (hb.step >= HB_BIOS)
+		httpd_staging_release (&hb);
+	hb.step = HB_FAILED;
+}
+
+void
+httpboot_start(struct netif *netif)
+{
+	const char *url = NULL;
+
+	if (hb.step != HB_IDLE)
+		return;
+
+	if (netif->dhcp != NULL && strncmp (netif->dhcp->boot_file, "http://", 7) == 0)
+		url = netif->dhcp->boot_file;
+#ifdef NET_BOOT_URL
+	if (url == NULL)
+		url = NET_BOOT_URL;
+#endif
+	if (url == NULL || strlen (url) >= HB_URL_MAX)
+		return;
+
+	strcpy (hb.base, url);
+	hb.step = HB_SCRIPT;
+}
+
+void
+httpboot_poll(void)
+{
+	extern void eth_disable(void);
+	extern void startLinux(void* initrdStart, unsigned long initrdSize, const char* appendLine);
+
+	if (hb.busy)
+		return;
+
+	switch (hb.step) {
+	case HB_SCRIPT:
+		hb_fetch (hb.base, HB_SCRIPT_MAX, hb_script_sink);
+		break;
+	case HB_BIOS:
+	case HB_KERNEL:
+		/* both land in the area uploads are staged in */
+		if (httpd_staging_claim (&hb) == NULL) {
+			hb_fail ("an upload is in progress");
+			break;
+		}
+		if (hb.step == HB_BIOS) {
+			hb_fetch (hb.bios, FLASH_STAGING_SIZE, hb_bios_sink);
+		} else {
+			hb.setuplen = 512;
+			hb_fetch (hb.kernel, HB_SETUP_MAX + MAX_KERNEL_SIZE, hb_kernel_sink);
+		}
+		break;
+	case HB_INITRD:
+		hb_fetch (hb.initrd, MAX_INITRD_SIZE, hb_initrd_sink);
+		break;
+	case HB_FLASH:
+		/* only returns if the image must not be flashed */
+		httpd_flash_image ((char *)FLASH_STAGING_START, hb.bioslen);
+		hb_fail ("BIOS image rejected");
+		break;
+	case HB_BOOT:
+		printk ("HTTP boot: starting kernel, %d bytes, initrd %d bytes\n",
+			(int)hb.kernellen, (int)hb.initrdlen);
+		printk ("HTTP boot: append %s\n", hb.append);
+		/* no more DMA from the NIC into memory the kernel owns */
+		eth_disable ();
+		startLinux ((void *)INITRD_START, hb.initrdlen, hb.append);
+		break;
+	default:
+		break;
+	}
+}
@@ -0,0 +1,11 @@
+#ifndef __HTTPBOOT_H__
+#define __HTTPBOOT_H__
+
+#include "lwip/netif.h"
+
+/* looks for a boot script URL, from DHCP or NET_BOOT_URL */
+void httpboot_start(struct netif *netif);
+/* moves the boot on, called from the main loop outside of any callback */
+void httpboot_poll(void);
+
+#endif /* __HTTPBOOT_H__ */
@@ -34,4 +34,8 @@
 
 void httpd_init(void);
 
+char *httpd_staging_claim(void *owner);
+void httpd_staging_release(void *owner);
+void httpd_flash_image(char *image, int len);
+
 #endif /* __HTTPD_H__ */
@@ -48,22 +48,114 @@
 
 
 
+#if defined(__i386__) || defined(__x86_64__)
+/* sum of n 32 byte blocks at p added to sum, one add-with-carry per
+   32-bit word with the carry folded back in after each block */
+static u32_t
+lwip_chksum_blocks(u32_t sum, const void *p, int n)
+{
+  __asm__ __volatile__ (
+    "1:\n\t"
+    "addl  0(%1), %k0\n\t"
+    "adcl  4(%1), %k0\n\t"
+    "adcl  8(%1), %k0\n\t"
+    "adcl 12(%1), %k0\n\t"
+    "adcl 16(%1), %k0\n\t"
+    "adcl 20(%1), %k0\n\t"
+    "adcl 24(%1), %k0\n\t"
+    "adcl 28(%1), %k0\n\t"
+    "adcl $0, %k0\n\t"
+    "lea 32(%1), %1\n\t"
+    "decl %2\n\t"
+    "jnz 1b"
+    : "+r" (sum), "+r" (p), "+r" (n)
+    :
+    : "cc", "memory");
+  return sum;
+}
+#else
+static u32_t
+lwip_chksum_blocks(u32_t sum, const void *p, int n)
+{
+  const u32_t *pw = p;
+  u32_t w;
+  int i;
+
+  while (n-- > 0) {
+    for (i = 0; i < 8; i++) {
+      w = *pw++;
+      sum += w;
+      if (sum < w) {
+        sum++;
+      }
+    }
+  }
+  return sum;
+}
+#endif
+
+/* lwip_chksum:
+ *
+ * Sums the 16-bit words at dataptr in one's complement, returning the
+ * folded sum in the same byte order as the data. Works a 32-bit word at a
+ * time, 32 bytes per pass of the unrolled loop.
+ */
 static u16_t
 lwip_chksum(void *dataptr, int len)
 {
-  u32_t acc;
+  u8_t *pb = dataptr;
+  u32_t acc = 0;
+  u32_t w;
+  int odd;
 
   LWIP_DEBUGF(INET_DEBUG, ("lwip_chksum(%p, %d)\n", (void *)dataptr, len));
-  for(acc = 0; len > 1; len -= 2) {
-      /*    acc = acc + *((u16_t *)dataptr)++;*/
-    acc += *(u16_t *)dataptr;
-    dataptr = (void *)((u16_t *)dataptr + 1);
+
+  /* summed from an odd address every 16-bit word is taken byte swapped,
+     which swaps the bytes of the sum as well. Start one byte in, as the
+     high half of a word, and swap the result back at the end */
+  odd = ((mem_ptr_t)pb & 1) && len > 0;
+  if (odd) {
+    u16_t t = 0;
+
+    ((u8_t *)&t)[1] = *pb++;
+    acc = t;
+    len--;
+  }
+
+  /* align to 32 bits */
+  if (((mem_ptr_t)pb & 2) && len > 1) {
+    acc += *(u16_t *)pb;
+    pb += 2;
+    len -= 2;
+  }
+
+  if (len >= 32) {
+    acc = lwip_chksum_blocks(acc, pb, len >> 5);
+    pb += len & ~31;
+    len &= 31;
+  }
+
+  for (; len > 3; len -= 4) {
+    w = *(u32_t *)pb & 0xffffffffUL;
+    acc = (acc + w) & 0xffffffffUL;
+    if (acc < w) {
+      acc++;
+    }
+    pb += 4;
+  }
+
+  /* fold to 16 bits before adding the rest so it cannot overflow */
+  acc = (acc >> 16) + (acc & 0xffffUL);
+  if (len > 1) {
+    acc += *(u16_t *)pb;
+    pb += 2;
+    len -= 2;
   }
 
   /* add up any odd byte */
   if (len == 1) {
-    acc += htons((u16_t)((*(u8_t *)dataptr) & 0xff) << 8);
-    LWIP_DEBUGF(INET_DEBUG, ("inet: chksum: odd byte %d\n", (unsigned int)(*(u8_t *)dataptr)));
+    acc += htons((u16_t)((*(u8_t *)pb) & 0xff) << 8);
+    LWIP_DEBUGF(INET_DEBUG, ("inet: chksum: odd byte %d\n", (unsigned int)(*(u8_t *)pb)));
   } else {
     LWIP_DEBUGF(INET_DEBUG, ("inet: chksum: no odd byte\n"));
   }
@@ -73,6 +165,10 @@ lwip_chksum(void *dataptr, int len)
     acc = (acc >> 16) + (acc & 0xffffUL);
   }
 
+  if (odd) {
+    acc = ((acc & 0xff) << 8) | ((acc >> 8) & 0xff);
+  }
+
   return (u16_t)acc;
 }
 
@@ -13,6 +13,9 @@
 /** period (in milliseconds) of the application calling dhcp_fine_tmr() */
 #define DHCP_FINE_TIMER_MSECS 500 
 
+/** longest boot file name kept, with its terminating zero */
+#define DHCP_BOOT_FILE_LEN 128
+
 struct dhcp
 {
   /** current DHCP state machine state */
@@ -46,6 +49,8 @@ struct dhcp
   u32_t offered_t0_lease; /* lease period (in seconds) */
   u32_t offered_t1_renew; /* recommended renew time (usually 50% of lease period) */
   u32_t offered_t2_rebind; /* recommended rebind time (usually 66% of lease period)  */
+  /** boot file name from the last ACK, empty if none */
+  char boot_file[DHCP_BOOT_FILE_LEN];
 /** Patch #1308
  *  TODO: See dhcp.c "TODO"s
  */
@@ -96,6 +101,8 @@ PACK_STRUCT_END
 
 /** start DHCP configuration */
 err_t dhcp_start(struct netif *netif);
+/** start DHCP configuration, asking for a lease held before */
+err_t dhcp_start_reboot(struct netif *netif, struct ip_addr *ipaddr, struct ip_addr *server);
 /** stop DHCP configuration */
 void dhcp_stop(struct netif *netif);
 /** enforce lease renewal */
@@ -185,6 +185,19 @@ a lot of data that needs to be copied, this should be set high. */
 #define ETHARP_ALWAYS_INSERT            1
 #endif
 
+/** Number of hash buckets for ARP table lookups, a power of two */
+#ifndef ARP_HASH_SIZE
+#define ARP_HASH_SIZE                   16
+#endif
+
+/**
+ * If defined to 1, IP packets only add cache entries if they are
+ * addressed to us, not if they are broadcasts.
+ */
+#ifndef ETHARP_LEARN_OWN_ONLY
+#define ETHARP_LEARN_OWN_ONLY           0
+#endif
+
 /* ---------- IP options ---------- */
 /* Define IP_FORWARD to 1 if you wish to have the ability to forward
    IP packets across network interfaces. If you are going to run lwIP
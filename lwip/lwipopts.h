@@ -42,8 +42,9 @@
 #define MEM_ALIGNMENT           2
 
 /* MEM_SIZE: the size of the heap memory. If the application will send
-a lot of data that needs to be copied, this should be set high. */
-#define MEM_SIZE                262144 //10000
+a lot of data that needs to be copied, this should be set high. Full
+send buffers on all MEMP_NUM_TCP_PCB connections take about 48KB. */
+#define MEM_SIZE                147456 //10000
 
 /* MEMP_NUM_PBUF: the number of memp struct pbufs. If the application
    sends a lot of data out of ROM (or other static memory), this
@@ -54,7 +55,7 @@ a lot of data that needs to be copied, this should be set high. */
 #define MEMP_NUM_UDP_PCB        4
 /* MEMP_NUM_TCP_PCB: the number of simulatenously active TCP
    connections. */
-#define MEMP_NUM_TCP_PCB        2
+#define MEMP_NUM_TCP_PCB        8
 /* MEMP_NUM_TCP_PCB_LISTEN: the number of listening TCP
    connections. */
 #define MEMP_NUM_TCP_PCB_LISTEN 8
@@ -81,11 +82,16 @@ a lot of data that needs to be copied, this should be set high. */
 #define MEMP_NUM_SYS_TIMEOUT    0
 
 /* ---------- Pbuf options ---------- */
-/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool. */
-#define PBUF_POOL_SIZE          128
+/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool. Enough to
+   hold a full receive window of full-size frames, plus a few spare, on
+   top of the 32 lent to the NIC's receive ring. The pool lives outside
+   MEM_SIZE, which was cut back by the same amount: heap and pool take
+   about 265KB together, against 274KB with the old 128 byte pbufs. */
+#define PBUF_POOL_SIZE          80
 
-/* PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool. */
-#define PBUF_POOL_BUFSIZE       128
+/* PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool. A whole
+   ethernet frame (1514) plus PBUF_LINK_HLEN fits in a single pbuf. */
+#define PBUF_POOL_BUFSIZE       1536
 
 /* PBUF_LINK_HLEN: the number of bytes that should be allocated for a
    link level header. */
@@ -100,17 +106,18 @@ a lot of data that needs to be copied, this should be set high. */
 #define TCP_QUEUE_OOSEQ         1
 
 /* TCP Maximum segment size. */
-#define TCP_MSS                 128
+#define TCP_MSS                 1460
 
 /* TCP sender buffer space (bytes). */
-#define TCP_SND_BUF             256
+#define TCP_SND_BUF             4 * TCP_MSS
 
 /* TCP sender buffer space (pbufs). This must be at least = 2 *
    TCP_SND_BUF/TCP_MSS for things to work. */
 #define TCP_SND_QUEUELEN        4 * TCP_SND_BUF/TCP_MSS
 
-/* TCP receive window. */
-#define TCP_WND                 45 * TCP_MSS //512
+/* TCP receive window. The largest a u16_t can announce, this lwIP
+   has no window scaling. */
+#define TCP_WND                 0xffff //512
 
 /* Maximum number of retransmissions of data segments. */
 #define TCP_MAXRTX              12
@@ -130,6 +137,13 @@ a lot of data that needs to be copied, this should be set high. */
  * reasonably static number of hosts. Typically for embedded devices.
  */
 #define ETHARP_ALWAYS_INSERT 1
+/* Number of hash buckets of the ARP table, a power of two. */
+#define ARP_HASH_SIZE 32
+/* If 1, only IP packets addressed to us add to the ARP table, not the
+   broadcasts of every host on the segment. A host that only broadcasts
+   to us (a fleet sender, a DHCP server) then costs an ARP request and,
+   without ARP_QUEUEING, the first packet sent to it. */
+#define ETHARP_LEARN_OWN_ONLY 0
 
 /* ---------- IP options ---------- */
 /* Define IP_FORWARD to 1 if you wish to have the ability to forward
@@ -161,18 +175,9 @@ a lot of data that needs to be copied, this should be set high. */
 
 
 /* ---------- Statistics options ---------- */
-/*#define STATS*/
-
-#ifdef STATS
-#define LINK_STATS
-#define IP_STATS
-#define ICMP_STATS
-#define UDP_STATS
-#define TCP_STATS
-#define MEM_STATS
-#define MEMP_STATS
-#define PBUF_STATS
-#define SYS_STATS
-#endif /* STATS */
+/* Served as /stats.json and summed up on the status panel. The rest
+   of the counters default to on in opt.h, there is no sys layer. */
+#define LWIP_STATS              1
+#define SYS_STATS               0
 
 #endif /* __LWIPOPTS_H__ */
@@ -0,0 +1,91 @@
+/*
+ * Network settings kept in CMOS, so a box comes up on the network
+ * without a full DHCP exchange and without compiled in addresses.
+ *
+ * The record lives in the upper CMOS bank, which the RTC and the
+ * PC BIOS leave alone. It is a magic byte, struct netcfg and a
+ * checksum byte that makes the sum of the record zero.
+ */
+
+#include "boot.h"
+#include "lwip/ip_addr.h"
+#include "lwip/inet.h"
+#include "netcfg.h"
+
+/* upper bank index and data ports */
+#define NETCFG_CMOS_INDEX 0x72
+#define NETCFG_CMOS_DATA 0x73
+
+/* where in the upper bank the record starts */
+#define NETCFG_CMOS_BASE 0x60
+
+#define NETCFG_MAGIC 0x4e
+
+#define NETCFG_LEN (1 + sizeof (struct netcfg) + 1)
+
+/* the config.h addresses are a,b,c,d lists, expanded before IP4_ADDR
+   sees them */
+#define NETCFG_IP4_ADDR(ipaddr, abcd) IP4_ADDR(ipaddr, abcd)
+
+static u8_t
+netcfg_read(int i)
+{
+	IoOutputByte (NETCFG_CMOS_INDEX, NETCFG_CMOS_BASE + i);
+	return IoInputByte (NETCFG_CMOS_DATA);
+}
+
+static void
+netcfg_write(int i, u8_t b)
+{
+	IoOutputByte (NETCFG_CMOS_INDEX, NETCFG_CMOS_BASE + i);
+	IoOutputByte (NETCFG_CMOS_DATA, b);
+}
+
+/* the record as it is laid out in CMOS, with its checksum filled in */
+static void
+netcfg_image(const struct netcfg *cfg, u8_t *image)
+{
+	u8_t sum = 0;
+	int i;
+
+	image[0] = NETCFG_MAGIC;
+	memcpy (&image[1], cfg, sizeof (*cfg));
+	for (i = 0; i < NETCFG_LEN - 1; i++)
+		sum += image[i];
+	image[NETCFG_LEN - 1] = -sum;
+}
+
+void
+netcfg_load(struct netcfg *cfg)
+{
+	u8_t image[NETCFG_LEN];
+	u8_t sum = 0;
+	int i;
+
+	for (i = 0; i < NETCFG_LEN; i++) {
+		image[i] = netcfg_read (i);
+		sum += image[i];
+	}
+	if (image[0] == NETCFG_MAGIC && sum == 0) {
+		memcpy (cfg, &image[1], sizeof (*cfg));
+		return;
+	}
+
+	memset (cfg, 0, sizeof (*cfg));
+	NETCFG_IP4_ADDR(&cfg->fallback_ip, NET_FALLBACK_IP);
+	NETCFG_IP4_ADDR(&cfg->fallback_mask, NET_FALLBACK_MASK);
+	NETCFG_IP4_ADDR(&cfg->fallback_gw, NET_FALLBACK_GW);
+	cfg->dhcp_wait = NET_DHCP_WAIT;
+}
+
+void
+netcfg_save(const struct netcfg *cfg)
+{
+	u8_t image[NETCFG_LEN];
+	int i;
+
+	netcfg_image (cfg, image);
+	for (i = 0; i < NETCFG_LEN; i++)
+		if (netcfg_read (i) != image[i])
+			netcfg_write (i, image[i]);
+}
@@ -0,0 +1,26 @@
+#ifndef __NETCFG_H__
+#define __NETCFG_H__
+
+#include "lwip/ip_addr.h"
+
+/* network settings kept in CMOS across boots */
+struct netcfg {
+	/* the last DHCP lease, 0.0.0.0 when there is none */
+	struct ip_addr ipaddr;
+	struct ip_addr netmask;
+	struct ip_addr gw;
+	struct ip_addr server;
+	/* what to use when no DHCP server answers in dhcp_wait seconds */
+	struct ip_addr fallback_ip;
+	struct ip_addr fallback_mask;
+	struct ip_addr fallback_gw;
+	u8_t dhcp_wait;
+};
+
+/* fills in cfg from CMOS, or with the config.h defaults if CMOS holds
+   no valid record */
+void netcfg_load(struct netcfg *cfg);
+/* writes cfg to CMOS, bytes that did not change are left alone */
+void netcfg_save(const struct netcfg *cfg);
+
+#endif /* __NETCFG_H__ */
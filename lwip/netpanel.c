@@ -0,0 +1,179 @@
+/*
+ * Status panel for the network flasher, at the bottom of the screen.
+ *
+ * Drawing text is slow, every glyph is blitted pixel by pixel, so the
+ * panel is never drawn from inside a callback. netpanel_poll runs from
+ * the main loop: every NETPANEL_INTERVAL ms it formats its lines and
+ * compares them with what is on screen, and then redraws the lines that
+ * changed, one pass at a time, for at most NETPANEL_BUDGET us per pass.
+ * Incoming frames get serviced in between.
+ *
+ * The longest main loop pass is measured here too, with or without the
+ * panel, so the cost of drawing can be seen.
+ */
+
+#include "boot.h"
+#include "video.h"
+#include "memory_layout.h"
+#include "lwip/dhcp.h"
+#include "lwip/stats.h"
+#include "ebd.h"
+#include "netpanel.h"
+
+int sprintf(char * buf, const char *fmt, ...);
+
+#define NETPANEL_LINES 6
+#define NETPANEL_COLS 64
+
+/* how often the lines are brought up to date, in ms */
+#define NETPANEL_INTERVAL 500
+
+/* drawing time per main loop pass, in us; one line is always drawn */
+#define NETPANEL_BUDGET 1000
+
+#define NETPANEL_COLOUR 0xffc8c8c8
+
+extern const BYTE font8x8_basic_height;
+
+struct netpanel netpanel;
+
+static char shown[NETPANEL_LINES][NETPANEL_COLS];
+static char want[NETPANEL_LINES][NETPANEL_COLS];
+static u32_t dirty;		/* lines that differ from the screen */
+
+static int started = 0;
+static u32_t refresh_at, last_poll;
+static u32_t rate_at, rate_bytes, rate;	/* throughput over the last interval */
+static u32_t loopmax_recent;		/* longest pass in the last interval */
+
+void
+netpanel_transfer(const char *activity, struct ip_addr *from, u32_t expected)
+{
+	netpanel.activity = activity;
+	if (from != NULL)
+		ip_addr_set (&netpanel.client, from);
+	netpanel.got = 0;
+	netpanel.expected = expected;
+}
+
+void
+netpanel_progress(u32_t len)
+{
+	netpanel.got += len;
+	netpanel.rxbytes += len;
+}
+
+static const char *
+netpanel_dhcp_state(struct netif *netif)
+{
+	if (netif->dhcp == NULL)
+		return netif->ip_addr.addr ? "fallback" : "no address";
+	switch (netif->dhcp->state) {
+	case DHCP_BOUND:
+		return "DHCP";
+	case DHCP_RENEWING:
+	case DHCP_REBINDING:
+		return "DHCP, renewing";
+	default:
+		return "waiting for DHCP";
+	}
+}
+
+#define NETPANEL_IP(ipaddr) ip4_addr1(ipaddr), ip4_addr2(ipaddr), \
+			    ip4_addr3(ipaddr), ip4_addr4(ipaddr)
+
+static void
+netpanel_format(struct netif *netif)
+{
+	int i;
+
+	sprintf (want[0], "IP %d.%d.%d.%d (%s)", NETPANEL_IP(&netif->ip_addr),
+		 netpanel_dhcp_state (netif));
+	if (netpanel.activity != NULL)
+		sprintf (want[1], "%s from %d.%d.%d.%d", netpanel.activity,
+			 NETPANEL_IP(&netpanel.client));
+	else
+		sprintf (want[1], "Waiting for an upload");
+	sprintf (want[2], "Received %d KB, %d KB/s", (int)(netpanel.rxbytes >> 10), (int)rate);
+	if (netpanel.expected != 0)
+		sprintf (want[3], "Transfer %d of %d KB (%d%%)", (int)(netpanel.got >> 10),
+			 (int)(netpanel.expected >> 10),
+			 (int)((netpanel.got >> 8) * 100 / ((netpanel.expected >> 8) + 1)));
+	else
+		sprintf (want[3], "Transfer %d KB", (int)(netpanel.got >> 10));
+	sprintf (want[4], "Loop max %d us, %d us lately", (int)netpanel.loopmax,
+		 (int)loopmax_recent);
+	/* what makes uploads slow, see /stats.json for the details */
+	sprintf (want[5], "NIC lost %d, IP dropped %d, TCP resent %d",
+		 (int)EBD_RX_LOST(eth_stats ()), lwip_stats.ip.drop, lwip_stats.tcp.rexmit);
+
+	for (i = 0; i < NETPANEL_LINES; i++)
+		if (strcmp (want[i], shown[i]) != 0)
+			dirty |= 1 << i;
+}
+
+/* puts back the backdrop under line i and writes the new text on it */
+static void
+netpanel_draw(int i)
+{
+	int height = font8x8_basic_height + 2;
+	int y = currentvideomodedetails.m_dwHeightInLines -
+		currentvideomodedetails.m_dwMarginYInLinesRecommended -
+		(NETPANEL_LINES - i) * height;
+	DWORD x = VIDEO_CURSOR_POSX, cy = VIDEO_CURSOR_POSY;
+
+	/* BootVideoClearScreen moves the cursor of printk */
+	BootVideoClearScreen (&jpegBackdrop, y, y + height);
+	VIDEO_CURSOR_POSX = x;
+	VIDEO_CURSOR_POSY = cy;
+
+	BootVideoOverlayString ((DWORD *)(FRAMEBUFFER_START +
+					  y * currentvideomodedetails.m_dwWidthInPixels * 4 +
+					  currentvideomodedetails.m_dwMarginXInPixelsRecommended * 4),
+				currentvideomodedetails.m_dwWidthInPixels * 4,
+				NETPANEL_COLOUR, want[i]);
+	strcpy (shown[i], want[i]);
+	dirty &= ~(1 << i);
+}
+
+void
+netpanel_poll(struct netif *netif, u32_t now)
+{
+	u32_t us;
+	int i;
+
+	if (started) {
+		us = (now - last_poll) * 100 / (EBD_TICKS_PER_MS / 10);
+		if (us > netpanel.loopmax)
+			netpanel.loopmax = us;
+		if (us > loopmax_recent)
+			loopmax_recent = us;
+	} else {
+		refresh_at = rate_at = now;
+		started = 1;
+	}
+
+	if (EBD_DUE(now, refresh_at)) {
+		refresh_at = now + NETPANEL_INTERVAL * EBD_TICKS_PER_MS;
+		if (now != rate_at)
+			rate = (netpanel.rxbytes - rate_bytes) / ((now - rate_at) / EBD_TICKS_PER_MS + 1);
+		rate_at = now;
+		rate_bytes = netpanel.rxbytes;
+#ifdef NET_STATUS_PANEL
+		netpanel_format (netif);
+#endif
+		loopmax_recent = 0;
+	}
+
+	/* the lines that changed, while there is time */
+	for (i = 0; i < NETPANEL_LINES && dirty; i++) {
+		if (!(dirty & (1 << i)))
+			continue;
+		netpanel_draw (i);
+		if (ebd_clock () - now >= NETPANEL_BUDGET * EBD_TICKS_PER_MS / 1000)
+			break;
+	}
+
+	/* the drawing counts towards this pass */
+	last_poll = now;
+}
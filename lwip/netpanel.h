@@ -0,0 +1,25 @@
+#ifndef __NETPANEL_H__
+#define __NETPANEL_H__
+
+#include "lwip/netif.h"
+
+/* what the status panel shows, filled in by whoever receives data */
+struct netpanel {
+	const char *activity;	/* what is being received, NULL for nothing */
+	struct ip_addr client;	/* who from */
+	u32_t rxbytes;		/* payload taken in since boot */
+	u32_t got;		/* of the current transfer */
+	u32_t expected;		/* its size, 0 if not known */
+	u32_t loopmax;		/* longest main loop pass so far, in us */
+};
+
+extern struct netpanel netpanel;
+
+/* a transfer starts, expected may be 0 and be filled in later */
+void netpanel_transfer(const char *activity, struct ip_addr *from, u32_t expected);
+/* len more bytes of it have arrived */
+void netpanel_progress(u32_t len);
+/* called once per pass of the main loop, with ebd_clock() */
+void netpanel_poll(struct netif *netif, u32_t now);
+
+#endif /* __NETPANEL_H__ */
@@ -37,6 +37,7 @@
 
 #include "lwip/stats.h"
 #include "lwip/mem.h"
+#include "boot.h"
 
 
 #if LWIP_STATS
@@ -588,6 +588,7 @@ tcp_rexmit(struct tcp_pcb *pcb)
   pcb->snd_nxt = ntohl(pcb->unsent->tcphdr->seqno);
 
   ++pcb->nrtx;
+  TCP_STATS_INC(tcp.rexmit);
 
   /* Don't take any rtt measurements after retransmitting. */
   pcb->rttest = 0;
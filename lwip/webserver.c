@@ -36,25 +36,134 @@
 /*#include "httpd.h"*/
 
 #include "lwip/tcp.h"
+#include "lwip/inet.h"
 
+#include "boot.h"
+#include "BootFlash.h"
+#include "memory_layout.h"
+#include "md5.h"
+#include "sha1.h"
+#include "netcfg.h"
+#include "netpanel.h"
+#include "ebd.h"
+#include "lwip/stats.h"
+
+int sprintf(char * buf, const char *fmt, ...);
+char * xstrstr(const char * s1, const char * s2);
+
+
+/* longest "\r\n--boundary" delimiter we accept, RFC 2046 allows a
+   boundary of up to 70 characters */
+#define MP_DELIM_MAX 80
+
+/* BiosIdentifier that lib/imagebld puts in the last bytes of the images it
+   builds, laid out as imagebld writes it (not packed, 64 bytes).  The MD5
+   covers the first BiosSize - 0x1000 bytes */
+struct bios_identifier {
+	u8_t magic[4];		/* "AUTO" */
+	u8_t header_version;
+	u8_t xbox_version;
+	u8_t video_encoder;
+	u8_t header_patch;
+	u8_t option1;
+	u8_t option2;
+	u8_t option3;
+	u8_t pad;
+	u32_t bios_size;
+	char name[32];
+	u8_t md5[16];
+};
+
+/* the BiosSize values an image may claim, the MD5 is run for each of them
+   while the upload arrives since we only learn which one from the header
+   at the very end */
+#define BIOS_SIZES 3
+#define BIOS_SIZE(i) ((256*1024) << (i))
+#define BIOS_MD5_SKIP 0x1000
+
+/* resumable uploads keep track of what arrived in blocks of this size */
+#define UPLOAD_BLOCK 1024
+#define UPLOAD_BLOCKS (FLASH_STAGING_SIZE / UPLOAD_BLOCK)
+
+/* what /flash.bin serves when the flash type is unknown */
+#define READBACK_FLASH_SIZE (1024*1024)
+
+/* multipart/form-data parser states */
+enum {
+	MP_FIRST,	/* reading the opening boundary line */
+	MP_HEADERS,	/* reading the headers of a part */
+	MP_BODY,	/* in the body of a part, looking for the delimiter */
+	MP_AFTER,	/* after a delimiter, either "--" or a new part */
+	MP_DONE,	/* final delimiter seen, ignoring the epilogue */
+	MP_ERROR
+};
 
 struct http_state {
 	unsigned char retries;
+	int keepalive;		/* connection stays open after the response */
+	int responding;		/* response queued, further requests wait */
+	struct pbuf *pending;	/* received data not yet parsed */
+	int pendingoff;
+	char *hdrpos;		/* header of a generated response, sent first */
+	int hdrleft;
 	char *file;
 	int left;
+	int filecopy;		/* file lives in here, tcp_write has to copy it */
 	
 	int ispost;
-	char *postdata;
+	int inbody;
 	int postlen;
 	int postpos;
 
 	char lineBuf[256];
-	char lineBufpos;
+	int lineBufpos;
 	char gotfirst;
 
+	/* the POST body is parsed as it arrives */
+	int mpstate;
+	char delim[MP_DELIM_MAX];
+	int delimlen;
+	unsigned char skip[256];	/* Horspool shift for each byte value */
+	char tail[MP_DELIM_MAX];	/* bytes that might start a delimiter */
+	int taillen;
+	char partname[32];
+	int partisimage;
+	char field[64];		/* value of the current non-file part */
+	int fieldlen;
+
+	/* the uploaded image */
+	char *image;
+	int imagelen;
+	int imagemax;
+	int gotimage;
+
+	/* digests of the image, updated as it arrives */
+	SHA1Context sha1;
+	MD5_CTX md5[BIOS_SIZES];
+	u8_t md5digest[BIOS_SIZES][16];
+	int md5end[BIOS_SIZES];	/* image offset the digest was taken at */
+	char sha1hex[2 * SHA1HashSize + 1];	/* optional "sha1" form field */
+
+	/* PUT /upload, from the query of the request line */
+	int isput;
+	int putcmd;		/* UPLOAD_CHUNK, UPLOAD_COMMIT or UPLOAD_ABORT */
+	u32_t putsize;
+	u32_t putoff;
+	u32_t putcrc;		/* what the chunk's CRC32 has to be */
+	u32_t crc;		/* CRC32 of the chunk so far */
+	int puterr;		/* refused before the body, the reply is in page */
+
 	void *bios_start;
 	int bios_len;
 
+	/* generated responses, copied out by tcp_write since this is
+	   freed before the last segments are acknowledged */
+	char hdr[128];
+	char page[1280];
+	int timed;		/* print the throughput once sent */
+	u32_t sendstart;	/* ebd_clock() when the response was queued */
+	int sendlen;
+
 };
 
 static char http_file0[] = 
@@ -85,6 +194,260 @@ static struct http_file http_files[6]={
 	{sizeof (http_file500) - 1, http_file500},   /* 5 */
 };
 
+/* the upload, or HTTP boot download, that currently owns the staging
+   area */
+static void *staging_owner = NULL;
+
+char *
+httpd_staging_claim(void *owner)
+{
+	if (staging_owner != NULL && staging_owner != owner)
+		return NULL;
+	staging_owner = owner;
+	return (char *)FLASH_STAGING_START;
+}
+
+void
+httpd_staging_release(void *owner)
+{
+	if (staging_owner == owner)
+		staging_owner = NULL;
+}
+
+extern const KNOWN_FLASH_TYPE aknownflashtypesDefault[];
+
+/* the flash as found by the first readback request, it cannot change
+   under us since a reflash always ends in a reset */
+static OBJECT_FLASH readback_of;
+static int readback_probed = 0;
+static char readback_sha1[2 * SHA1HashSize + 1];
+
+static void
+readback_probe(void)
+{
+	SHA1Context sha1;
+	u8_t digest[SHA1HashSize];
+	int i;
+
+	if (readback_probed)
+		return;
+
+	memset (&readback_of, 0, sizeof (readback_of));
+	readback_of.m_pbMemoryMappedStartAddress = (BYTE *)LPCFlashadress;
+	if (!BootFlashGetDescriptor (&readback_of, (KNOWN_FLASH_TYPE *)&aknownflashtypesDefault[0]))
+		readback_of.m_dwLengthInBytes = READBACK_FLASH_SIZE;
+
+	SHA1Reset (&sha1);
+	SHA1Input (&sha1, (const u8_t *)LPCFlashadress, readback_of.m_dwLengthInBytes);
+	SHA1Result (&sha1, digest);
+	for (i = 0; i < SHA1HashSize; i++)
+		sprintf (&readback_sha1[2*i], "%02x", digest[i]);
+
+	readback_probed = 1;
+}
+
+/* queues a generated response, a body outside of hs is sent by reference */
+static void
+respond_status(struct http_state *hs, const char *status, const char *type, char *body, int len)
+{
+	hs->hdrleft = sprintf (hs->hdr, "HTTP/1.1 %s\nContent-Type: %s\nContent-Length: %d\n\n",
+			       status, type, len);
+	hs->hdrpos = hs->hdr;
+	hs->file = body;
+	hs->left = len;
+	hs->filecopy = (body == hs->page);
+}
+
+static void
+readback_respond(struct http_state *hs, const char *type, char *body, int len)
+{
+	respond_status (hs, "200 OK", type, body, len);
+}
+
+/* GET /flash.bin, the flash straight from where it is mapped */
+static void
+readback_flash(struct http_state *hs)
+{
+	readback_probe ();
+	readback_respond (hs, "application/octet-stream",
+			  (char *)LPCFlashadress, readback_of.m_dwLengthInBytes);
+	hs->timed = 1;
+	hs->sendstart = ebd_clock ();
+	hs->sendlen = readback_of.m_dwLengthInBytes;
+}
+
+/* GET /eeprom.bin */
+static void
+readback_eeprom(struct http_state *hs)
+{
+	BootEepromReadEntireEEPROM ();
+	readback_respond (hs, "application/octet-stream", (char *)&eeprom, EEPROM_SIZE);
+}
+
+/* GET /info.json, what is flashed and what it was flashed with */
+static void
+readback_info(struct http_state *hs)
+{
+	struct bios_identifier *id;
+	char name[sizeof (id->name) + 1];
+	int len, i;
+
+	readback_probe ();
+
+	/* the BiosIdentifier sits at the end of the image, and so at the
+	   end of the flash however often the image is mirrored */
+	id = (struct bios_identifier *)(LPCFlashadress + readback_of.m_dwLengthInBytes
+					- sizeof (struct bios_identifier));
+	name[0] = 0;
+	if (memcmp (id->magic, "AUTO", 4) == 0) {
+		for (i = 0; i < sizeof (id->name) && id->name[i]; i++)
+			name[i] = (id->name[i] < ' ' || id->name[i] > '~' ||
+				   id->name[i] == '"' || id->name[i] == '\\') ? '?' : id->name[i];
+		name[i] = 0;
+	}
+
+	len = sprintf (hs->page,
+		       "{\n"
+		       "\"flashbios\": \"%s\",\n"
+		       "\"flash\": {\"manufacturer\": %d, \"device\": %d, "
+		       "\"description\": \"%s\", \"size\": %d, \"writable\": %s},\n"
+		       "\"sha1\": \"%s\",\n"
+		       "\"bios\": \"%s\",\n"
+		       "\"loop_max_us\": %d\n"
+		       "}\n",
+		       VERSION,
+		       readback_of.m_bManufacturerId, readback_of.m_bDeviceId,
+		       readback_of.m_szFlashDescription, (int)readback_of.m_dwLengthInBytes,
+		       readback_of.m_fIsBelievedCapableOfWriteAndErase ? "true" : "false",
+		       readback_sha1, name, (int)netpanel.loopmax);
+	readback_respond (hs, "application/json", hs->page, len);
+}
+
+/* a dotted quad as a JSON string */
+#define NET_IP_FMT "\"%d.%d.%d.%d\""
+#define NET_IP_ARGS(ipaddr) ip4_addr1(ipaddr), ip4_addr2(ipaddr), \
+			    ip4_addr3(ipaddr), ip4_addr4(ipaddr)
+
+/* copies the value of name= in a query string into val, returns 0 if
+   the query does not have it */
+static int
+query_value(const char *query, const char *name, char *val, int max)
+{
+	int n = strlen (name);
+	int i;
+
+	while (*query && *query != ' ') {
+		if (strncmp (query, name, n) == 0 && query[n] == '=') {
+			query += n + 1;
+			for (i = 0; i < max - 1 && query[i] && query[i] != '&' && query[i] != ' '; i++)
+				val[i] = query[i];
+			val[i] = 0;
+			return 1;
+		}
+		while (*query && *query != ' ' && *query != '&')
+			query++;
+		if (*query == '&')
+			query++;
+	}
+	return 0;
+}
+
+/* sets ipaddr from name= in the query, if it is there and valid */
+static void
+query_ip(const char *query, const char *name, struct ip_addr *ipaddr)
+{
+	struct in_addr a;
+	char val[16];
+
+	if (query_value (query, name, val, sizeof (val)) && inet_aton (val, &a))
+		ipaddr->addr = a.s_addr;
+}
+
+/* GET /net.json, the network settings kept in CMOS. PUT /net.json with
+   fallback=, mask=, gw= and wait= (seconds) in the query changes what is
+   used when DHCP does not answer, from the next boot on */
+static void
+net_settings(struct http_state *hs, const char *query)
+{
+	struct netcfg cfg;
+	char val[8];
+	int len;
+
+	netcfg_load (&cfg);
+	if (query != NULL) {
+		query_ip (query, "fallback", &cfg.fallback_ip);
+		query_ip (query, "mask", &cfg.fallback_mask);
+		query_ip (query, "gw", &cfg.fallback_gw);
+		if (query_value (query, "wait", val, sizeof (val))) {
+			len = simple_strtoul (val, NULL, 10);
+			cfg.dhcp_wait = len < 1 ? 1 : len > 255 ? 255 : len;
+		}
+		netcfg_save (&cfg);
+	}
+
+	len = sprintf (hs->page,
+		       "{\n"
+		       "\"lease\": {\"ip\": " NET_IP_FMT ", \"mask\": " NET_IP_FMT
+		       ", \"gw\": " NET_IP_FMT ", \"server\": " NET_IP_FMT "},\n"
+		       "\"fallback\": {\"ip\": " NET_IP_FMT ", \"mask\": " NET_IP_FMT
+		       ", \"gw\": " NET_IP_FMT "},\n"
+		       "\"wait\": %d\n"
+		       "}\n",
+		       NET_IP_ARGS(&cfg.ipaddr), NET_IP_ARGS(&cfg.netmask),
+		       NET_IP_ARGS(&cfg.gw), NET_IP_ARGS(&cfg.server),
+		       NET_IP_ARGS(&cfg.fallback_ip), NET_IP_ARGS(&cfg.fallback_mask),
+		       NET_IP_ARGS(&cfg.fallback_gw), cfg.dhcp_wait);
+	readback_respond (hs, "application/json", hs->page, len);
+}
+
+/* one protocol's counters from lwip_stats */
+static int
+stats_proto(char *buf, const char *name, struct stats_proto *s)
+{
+	return sprintf (buf, "\"%s\": {\"xmit\": %d, \"rexmit\": %d, \"recv\": %d, "
+			"\"drop\": %d, \"chkerr\": %d, \"lenerr\": %d, \"memerr\": %d, "
+			"\"proterr\": %d, \"err\": %d},\n",
+			name, s->xmit, s->rexmit, s->recv, s->drop, s->chkerr, s->lenerr,
+			s->memerr, s->proterr, s->err);
+}
+
+/* GET /stats.json, what the NIC driver and lwIP counted since boot. The
+   lwIP counters are 16 bits and wrap. */
+static void
+net_stats(struct http_state *hs)
+{
+	struct nic_stats *nic = eth_stats ();
+	char *p = hs->page;
+
+	p += sprintf (p, "{\n\"nic\": {\"rx_frames\": %lu, \"rx_errors\": %lu, "
+		      "\"rx_missed\": %lu, \"rx_overruns\": %lu, \"rx_nobuf\": %lu, "
+		      "\"rx_dropped\": %lu, \"tx_frames\": %lu, \"tx_errors\": %lu, "
+		      "\"tx_dropped\": %lu},\n",
+		      nic->rx_frames, nic->rx_errors, nic->rx_missed, nic->rx_overruns,
+		      nic->rx_nobuf, nic->rx_dropped, nic->tx_frames, nic->tx_errors,
+		      nic->tx_dropped);
+	p += stats_proto (p, "link", &lwip_stats.link);
+	p += stats_proto (p, "ip", &lwip_stats.ip);
+	p += stats_proto (p, "icmp", &lwip_stats.icmp);
+	p += stats_proto (p, "udp", &lwip_stats.udp);
+	p += stats_proto (p, "tcp", &lwip_stats.tcp);
+	p += sprintf (p, "\"pbuf\": {\"avail\": %d, \"used\": %d, \"max\": %d, \"err\": %d},\n"
+		      "\"mem\": {\"avail\": %d, \"used\": %d, \"max\": %d, \"err\": %d}\n"
+		      "}\n",
+		      lwip_stats.pbuf.avail, lwip_stats.pbuf.used, lwip_stats.pbuf.max,
+		      lwip_stats.pbuf.err, (int)lwip_stats.mem.avail, (int)lwip_stats.mem.used,
+		      (int)lwip_stats.mem.max, (int)lwip_stats.mem.err);
+	readback_respond (hs, "application/json", hs->page, p - hs->page);
+}
+
+/* a request path matches up to the blank before the HTTP version */
+static int
+path_is(const char *path, const char *name)
+{
+	int n = strlen (name);
+
+	return strncmp (path, name, n) == 0 && (path[n] == ' ' || path[n] == '\0');
+}
 /*-----------------------------------------------------------------------------------*/
 static void
 conn_err(void *arg, err_t err)
@@ -92,6 +455,10 @@ conn_err(void *arg, err_t err)
   struct http_state *hs;
 
   hs = arg;
+  httpd_staging_release(hs);
+  if (hs->pending != NULL) {
+    pbuf_free(hs->pending);
+  }
   mem_free(hs);
 }
 /*-----------------------------------------------------------------------------------*/
@@ -101,53 +468,122 @@ close_conn(struct tcp_pcb *pcb, struct http_state *hs)
   tcp_arg(pcb, NULL);
   tcp_sent(pcb, NULL);
   tcp_recv(pcb, NULL);
+  tcp_poll(pcb, NULL, 0);
 
   if (hs->bios_start) {
 		extern void ClearScreen (void);
 		ClearScreen ();
 		printk ("\nGot BIOS-image over http, %d bytes\n", hs->bios_len);
-		memcpy ((void*)0x100000, hs->bios_start, hs->bios_len);
-		BootReflashAndReset((void*)0x100000,0,hs->bios_len);
+		/* the image was received straight into the staging area */
+		BootReflashAndReset(hs->bios_start,0,hs->bios_len);
 		printk ("FLASHING FAILED? - halting");
 		while (1)
 			;
   }
 
-  if (hs->postdata)
-	  free (hs->postdata);
+  httpd_staging_release(hs);
+  if (hs->pending != NULL) {
+    pbuf_free(hs->pending);
+  }
 
   mem_free(hs);
   tcp_close(pcb);
 }
 /*-----------------------------------------------------------------------------------*/
-static void
-send_data(struct tcp_pcb *pcb, struct http_state *hs)
+/* queues what fits in the send buffer, returns how much that was */
+static int
+send_part(struct tcp_pcb *pcb, char *data, int left, int copy)
 {
   err_t err;
   u16_t len;
 
+  if (left == 0) {
+    return 0;
+  }
+
   /* We cannot send more data than space available in the send
      buffer. */     
-  if (tcp_sndbuf(pcb) < hs->left) {
+  if (tcp_sndbuf(pcb) < left) {
     len = tcp_sndbuf(pcb);
   } else {
-    len = hs->left;
+    len = left;
   }
 
+  /* unless copied the data is referenced, it has to stay put until
+     it has been acknowledged */
   do {
-    err = tcp_write(pcb, hs->file, len, 0);
+    err = tcp_write(pcb, data, len, copy);
     if (err == ERR_MEM) {
       len /= 2;
     }
   } while (err == ERR_MEM && len > 1);  
   
-  if (err == ERR_OK) {
-    hs->file += len;
-    hs->left -= len;
-    /*  } else {
-	printf("send_data: error %s len %d %d\n", lwip_strerr(err), len, tcp_sndbuf(pcb));*/
+  if (err != ERR_OK) {
+    /*	printf("send_data: error %s len %d %d\n", lwip_strerr(err), len, tcp_sndbuf(pcb));*/
+    return 0;
+  }
+  return len;
+}
+/*-----------------------------------------------------------------------------------*/
+static void
+send_data(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  int len;
+
+  if (hs->hdrleft > 0) {
+    len = send_part(pcb, hs->hdrpos, hs->hdrleft, 1);
+    hs->hdrpos += len;
+    hs->hdrleft -= len;
+    if (hs->hdrleft > 0) {
+      return;
+    }
   }
+  len = send_part(pcb, hs->file, hs->left, hs->filecopy);
+  hs->file += len;
+  hs->left -= len;
+}
+/*-----------------------------------------------------------------------------------*/
+static void
+respond(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  hs->responding = 1;
+  send_data(pcb, hs);
+}
+/*-----------------------------------------------------------------------------------*/
+/* readies a keep-alive connection for its next request */
+static void
+request_reset(struct http_state *hs)
+{
+  hs->responding = 0;
+  hs->hdrpos = NULL;
+  hs->hdrleft = 0;
+  hs->file = NULL;
+  hs->left = 0;
+  hs->filecopy = 0;
+  hs->lineBufpos = 0;
+  hs->gotfirst = 0;
+  hs->ispost = 0;
+  hs->isput = 0;
+  hs->inbody = 0;
+  hs->postpos = 0;
+  hs->postlen = 0;
+  hs->mpstate = MP_FIRST;
+  hs->image = NULL;
+  hs->imagelen = 0;
+  hs->imagemax = 0;
+  hs->gotimage = 0;
+  hs->timed = 0;
+
+  /* a failed upload leaves the staging area to the next one */
+  httpd_staging_release(hs);
 }
+
+static int http_input(struct tcp_pcb *pcb, struct http_state *hs);
+static void upload_query(struct http_state *hs, const char *query);
+static void upload_begin(struct tcp_pcb *pcb, struct http_state *hs);
+static void upload_input(struct http_state *hs, const char *data, int len);
+static void upload_end(struct http_state *hs);
+static void upload_status(struct http_state *hs);
 /*-----------------------------------------------------------------------------------*/
 static err_t
 http_poll(void *arg, struct tcp_pcb *pcb)
@@ -162,13 +598,16 @@ http_poll(void *arg, struct tcp_pcb *pcb)
 	  /*tcp_abort(pcb);*/
     return ERR_OK;
   } else {
-	  printk("P");
+    /* also times out idle keep-alive connections */
     ++hs->retries;
     if (hs->retries == 4) {
       tcp_abort(pcb);
       return ERR_ABRT;
     }
-    send_data(pcb, hs);
+    if (hs->responding) {
+	    printk("P");
+      send_data(pcb, hs);
+    }
   }
 
   return ERR_OK;
@@ -182,11 +621,33 @@ http_sent(void *arg, struct tcp_pcb *pcb, u16_t len)
   hs = arg;
 
   hs->retries = 0;
+
+  if (!hs->responding) {
+    return ERR_OK;
+  }
   
-  if (hs->left > 0) {    
+  if (hs->hdrleft > 0 || hs->left > 0) {    
     send_data(pcb, hs);
-  } else {
+    return ERR_OK;
+  }
+
+  if (hs->timed) {
+		int ms = (ebd_clock () - hs->sendstart) / EBD_TICKS_PER_MS;
+
+		if (ms == 0)
+			ms = 1;
+		printk ("Sent %d bytes in %dms (%dkB/s)\n", hs->sendlen, ms,
+			(hs->sendlen / ms) * 1000 / 1024);
+  }
+
+  if (hs->bios_start || !hs->keepalive) {
     close_conn(pcb, hs);
+  } else {
+    /* on to the next request, it may already be waiting */
+    request_reset(hs);
+    if (!http_input(pcb, hs)) {
+      close_conn(pcb, hs);
+    }
   }
 
   return ERR_OK;
@@ -198,12 +659,45 @@ handle_line(struct tcp_pcb *pcb, struct http_state *hs)
 {
 	if (!hs->gotfirst) {
 		if (strncmp (hs->lineBuf, "GET /", 4) == 0) {
-			unsigned long fno = simple_strtoul (&hs->lineBuf[5], NULL, NULL);
-			if (fno > 2) {
-				fno = 4; /* 404 */
+			char *path = &hs->lineBuf[4];
+
+			hs->hdrleft = 0;
+			hs->filecopy = 0;
+			if (path_is (path, "/flash.bin")) {
+				readback_flash (hs);
+			} else if (path_is (path, "/eeprom.bin")) {
+				readback_eeprom (hs);
+			} else if (path_is (path, "/info.json")) {
+				readback_info (hs);
+			} else if (path_is (path, "/net.json")) {
+				net_settings (hs, NULL);
+			} else if (strncmp (path, "/net.json?", 10) == 0) {
+				/* a link or a prefetch must not change CMOS */
+				respond_status (hs, "405 Method Not Allowed", "application/json",
+						hs->page, sprintf (hs->page,
+						"{\"error\": \"use PUT to change the settings\"}\n"));
+			} else if (path_is (path, "/upload.json")) {
+				upload_status (hs);
+			} else if (path_is (path, "/stats.json")) {
+				net_stats (hs);
+			} else {
+				unsigned long fno = 4; /* 404 */
+
+				/* the pages are numbered, "/" is page 0 */
+				if (path[1] == ' ' || path[1] == '\0')
+					fno = 0;
+				else if (path[1] >= '0' && path[1] <= '9')
+					fno = simple_strtoul (&path[1], NULL, NULL);
+				if (fno > 2) {
+					fno = 4; /* 404 */
+				}
+				hs->file = http_files[fno].data;
+				hs->left = http_files[fno].len;
 			}
-			hs->file = http_files[fno].data;
-			hs->left = http_files[fno].len;
+		} else if (strncmp (hs->lineBuf, "PUT /net.json?", 14) == 0) {
+			net_settings (hs, &hs->lineBuf[14]);
+		} else if (strncmp (hs->lineBuf, "PUT /upload?", 12) == 0) {
+			upload_query (hs, &hs->lineBuf[12]);
 		} else if (strncmp (hs->lineBuf, "POST /", 5) == 0) {
 			hs->ispost = 1;
 			hs->file = http_files[5].data;
@@ -211,22 +705,51 @@ handle_line(struct tcp_pcb *pcb, struct http_state *hs)
 		} else {
 			return 0;
 		}
+		/* HTTP/1.1 keeps the connection unless asked not to */
+		hs->keepalive = xstrstr (hs->lineBuf, "HTTP/1.1") != NULL;
 		hs->gotfirst = 1;
 	} else {
 
 		/* end of header empty line? */
 		if (hs->lineBuf[0] == '\0') {
-			if (hs->ispost && hs->postlen) {
-				hs->postdata = (char *)malloc (hs->postlen);
+			if (hs->isput) {
+				upload_begin (pcb, hs);
+				if (hs->postlen) {
+					hs->postpos = 0;
+					hs->inbody = 1;
+				} else {
+					upload_end (hs);
+					respond(pcb, hs);
+				}
+			} else if (hs->ispost && hs->postlen) {
+				/* the payload is parsed straight into the staging
+				   area, if another upload has it this one fails */
+				hs->image = httpd_staging_claim (hs);
+				hs->imagemax = hs->image ? FLASH_STAGING_SIZE : 0;
+				if (!hs->image)
+					printk ("Another upload is in progress\n");
+				hs->imagelen = 0;
+				hs->gotimage = 0;
+				SHA1Reset (&hs->sha1);
+				memset (hs->md5end, 0, sizeof (hs->md5end));
+				hs->sha1hex[0] = 0;
 				hs->postpos = 0;
+				hs->inbody = 1;
+				hs->mpstate = MP_FIRST;
+				hs->lineBufpos = 0;
+				netpanel_transfer ("Upload", &pcb->remote_ip, hs->postlen);
 			} else {
-				send_data(pcb, hs);
-				tcp_poll(pcb, http_poll, 4);
-				tcp_sent(pcb, http_sent);
-				hs->gotfirst = 0;
+				respond(pcb, hs);
 			}
 		}
 
+		if (strncmp (hs->lineBuf, "Connection:", 11) == 0) {
+			if (xstrstr (hs->lineBuf, "close") || xstrstr (hs->lineBuf, "Close"))
+				hs->keepalive = 0;
+			else if (xstrstr (hs->lineBuf, "eep-"))	/* keep-alive, Keep-Alive */
+				hs->keepalive = 1;
+		}
+
 		if (strncmp (hs->lineBuf, "Content-Length:", 15) == 0) {
 			unsigned long len = simple_strtoul (&hs->lineBuf[16], NULL, NULL);
 
@@ -244,75 +767,159 @@ char * xstrstr(const char * s1, const char * s2)
 	if (!l2)
 		return (char *) s1;
 	l1 = strlen(s1);
-
+	while (l1 >= l2) {
+		l1--;
+		if (!memcmp(s1, s2, l2))
+			return (char *) s1;
+		s1++;
+	}
 	return NULL;
 }
 
-static int
-handle_post(struct http_state *hs)
+/* runs the digests over the next len bytes of the image, which will be
+   stored at offset hs->imagelen */
+static void
+image_hash(struct http_state *hs, const char *data, int len)
 {
-	int i, ncnt = 0, blen, len;
-	char *start, *end;
-	char *boundary = NULL;
+	int i;
 
-	hs->file = http_files[5].data;
-	hs->left = http_files[5].len;
+	SHA1Input (&hs->sha1, (const uint8_t *)data, len);
 
-	for (i = 0; i < hs->postlen; i++) {
-		if (hs->postdata[i] == '\n' || hs->postdata[i] == '\r') {
-			hs->postdata[i] = 0;
-			boundary = hs->postdata;
-			blen = i;
-			break;
-		}
-	}
-	if (!boundary)
-		return 0;
+	for (i = 0; i < BIOS_SIZES; i++) {
+		int off = hs->imagelen, left = len;
+		const char *p = data;
 
-	for (; i < hs->postlen; i++) {
-		if (hs->postdata[i] == '\r')
-			continue;
+		while (left > 0) {
+			int pos = off % BIOS_SIZE(i);
+			int n = BIOS_SIZE(i) - BIOS_MD5_SKIP - pos;
 
-		if (hs->postdata[i] == '\n') {
-			ncnt++;
-			if (ncnt == 2) {
-				start = &hs->postdata[i+1];
-				break;
+			if (n <= 0) {
+				/* the unhashed tail of this copy */
+				n = BIOS_SIZE(i) - pos;
+				if (n > left)
+					n = left;
+			} else {
+				if (n > left)
+					n = left;
+				if (pos == 0)
+					MD5Init (&hs->md5[i]);
+				MD5Update (&hs->md5[i], (unsigned char *)p, n);
+				if (pos + n == BIOS_SIZE(i) - BIOS_MD5_SKIP) {
+					MD5Final (hs->md5digest[i], &hs->md5[i]);
+					hs->md5end[i] = off + n;
+				}
 			}
-		} else {
-			ncnt = 0;
+			p += n;
+			off += n;
+			left -= n;
 		}
 	}
-	if (!start) {
-		printk ("Could not find start...\n");
+}
+
+static int
+hexval(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+/* checks the complete image in the staging area before anything gets
+   erased, returns 0 and says why if it must not be flashed */
+static int
+validate_image(struct http_state *hs)
+{
+	int len = hs->imagelen, i;
+	struct bios_identifier *id;
+
+	if (len != 256*1024 && len != 512*1024 && len != 1024*1024) {
+		printk ("Illegal size, NOT flashing\n");
 		return 0;
 	}
 
-	for (; i < hs->postlen; i++) {
-		if ( memcmp(boundary,&hs->postdata[i],blen) == 0) {
-			end = &hs->postdata[i];
-			break;
+	id = (struct bios_identifier *)(hs->image + len - sizeof (struct bios_identifier));
+	if (memcmp (id->magic, "AUTO", 4) == 0) {
+		for (i = 0; i < BIOS_SIZES; i++)
+			if (id->bios_size == BIOS_SIZE(i))
+				break;
+		if (i == BIOS_SIZES || len % id->bios_size) {
+			printk ("BiosIdentifier size %d does not fit a %d byte image, NOT flashing\n",
+				(int)id->bios_size, len);
+			return 0;
 		}
+		if (hs->md5end[i] != len - BIOS_MD5_SKIP ||
+		    memcmp (hs->md5digest[i], id->md5, 16) != 0) {
+			printk ("BiosIdentifier MD5 mismatch, NOT flashing\n");
+			return 0;
+		}
+		printk ("BiosIdentifier OK: %s\n", id->name);
+	} else {
+		printk ("Image has no BiosIdentifier, MD5 not checked\n");
 	}
 
-	if (!end) {
-		printk ("Could not find end...\n");
-		return 0;
+	if (hs->sha1hex[0]) {
+		u8_t digest[SHA1HashSize];
+
+		SHA1Result (&hs->sha1, digest);
+		for (i = 0; i < SHA1HashSize; i++) {
+			if (hexval (hs->sha1hex[2*i]) != (digest[i] >> 4) ||
+			    hexval (hs->sha1hex[2*i+1]) != (digest[i] & 15)) {
+				printk ("SHA-1 mismatch, NOT flashing\n");
+				return 0;
+			}
+		}
+		printk ("SHA-1 OK\n");
 	}
 
-	end -= 2;
+	return 1;
+}
+
+/* flashes an image that is already in memory, after the same checks
+   as an upload; returns only if it must not be flashed */
+void
+httpd_flash_image(char *image, int len)
+{
+	extern void ClearScreen (void);
+	static struct http_state hs;
 
-	len = end - start;
+	memset (&hs, 0, sizeof (hs));
+	hs.image = image;
+	SHA1Reset (&hs.sha1);
+	image_hash (&hs, image, len);
+	hs.imagelen = len;
+	if (!validate_image (&hs))
+		return;
 
+	ClearScreen ();
+	printk ("\nFlashing BIOS image, %d bytes\n", len);
+	BootReflashAndReset ((BYTE *)image, 0, len);
+	printk ("FLASHING FAILED? - halting");
+	while (1)
+		;
+}
 
-	if (len != 256*1024 && len != 512*1024 && len != 1024*1024) {
+/* called once the final boundary has been seen, picks the page to answer with */
+static int
+handle_post(struct http_state *hs)
+{
+	int len = hs->imagelen;
+
+	if (!hs->gotimage) {
+		printk ("No BIOS image in upload\n");
+		return 0;
+	}
+
+	if (!validate_image (hs)) {
 		hs->file = http_files[3].data;
 		hs->left = http_files[3].len;
-		printk ("Illegal size, NOT flashing\n");
 		return 0;
 	}
 
-	hs->bios_start = start;
+	hs->bios_start = hs->image;
 	hs->bios_len = len;
 
 	hs->file = http_files[2].data;
@@ -321,55 +928,575 @@ handle_post(struct http_state *hs)
 */
 	return 1;
 }
+
+/*
+ * Resumable uploads. Instead of one multipart POST the image can be
+ * sent in pieces, each of them checked on its own:
+ *
+ *	PUT /upload?size=S&offset=O&crc=C	one chunk, O a multiple of
+ *						UPLOAD_BLOCK, C its CRC32 in hex
+ *	GET /upload.json			what is still missing
+ *	PUT /upload?commit=1&sha1=H		checks the whole image, flashes
+ *	PUT /upload?abort=1			gives the staging area back
+ *
+ * The upload belongs to no connection, a dropped one only loses the
+ * chunk it was sending. A chunk is written straight to its place in
+ * the staging area; the blocks it covers count as received only once
+ * its CRC32 matched.
+ */
+enum {
+	UPLOAD_CHUNK,
+	UPLOAD_COMMIT,
+	UPLOAD_ABORT
+};
+
+static struct {
+	u32_t size;		/* 0 while there is no upload */
+	u32_t blocks;
+	u32_t received;		/* blocks */
+	u8_t have[UPLOAD_BLOCKS / 8];
+} upload;
+
+static u32_t crc_table[256];
+
+static u32_t
+crc32_update(u32_t crc, const u8_t *data, int len)
+{
+	int i, j;
+
+	if (crc_table[1] == 0) {
+		for (i = 0; i < 256; i++) {
+			u32_t c = i;
+
+			for (j = 0; j < 8; j++)
+				c = c & 1 ? 0xedb88320UL ^ (c >> 1) : c >> 1;
+			crc_table[i] = c;
+		}
+	}
+	crc = ~crc;
+	while (len-- > 0)
+		crc = crc_table[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+	return ~crc;
+}
+
+static int
+upload_has(u32_t b)
+{
+	return upload.have[b >> 3] & (1 << (b & 7));
+}
+
+static void
+upload_mark(u32_t b, int have)
+{
+	if (!have == !upload_has (b))
+		return;
+	upload.have[b >> 3] ^= 1 << (b & 7);
+	upload.received += have ? 1 : -1;
+}
+
+static void
+upload_end_session(void)
+{
+	httpd_staging_release (&upload);
+	upload.size = 0;
+	upload.blocks = 0;
+}
+
+/* a JSON reply in hs->page */
+static void
+upload_reply(struct http_state *hs, const char *status, int len)
+{
+	respond_status (hs, status, "application/json", hs->page, len);
+}
+
+static void
+upload_error(struct http_state *hs, const char *status, const char *why)
+{
+	upload_reply (hs, status, sprintf (hs->page, "{\"error\": \"%s\"}\n", why));
+	hs->puterr = 1;
+}
+
+/* the query of PUT /upload, taken while the request line is at hand */
+static void
+upload_query(struct http_state *hs, const char *query)
+{
+	char val[2 * SHA1HashSize + 1];
+
+	hs->isput = 1;
+	hs->puterr = 0;
+	hs->putcmd = UPLOAD_CHUNK;
+	hs->putsize = hs->putoff = 0;
+	hs->sha1hex[0] = 0;
+	if (query_value (query, "commit", val, sizeof (val)))
+		hs->putcmd = UPLOAD_COMMIT;
+	if (query_value (query, "abort", val, sizeof (val)))
+		hs->putcmd = UPLOAD_ABORT;
+	if (query_value (query, "sha1", val, sizeof (val)))
+		strcpy (hs->sha1hex, val);
+	if (query_value (query, "size", val, sizeof (val)))
+		hs->putsize = simple_strtoul (val, NULL, 10);
+	if (query_value (query, "offset", val, sizeof (val)))
+		hs->putoff = simple_strtoul (val, NULL, 10);
+	if (query_value (query, "crc", val, sizeof (val)))
+		hs->putcrc = simple_strtoul (val, NULL, 16);
+	else if (hs->putcmd == UPLOAD_CHUNK)
+		upload_error (hs, "400 Bad Request", "crc missing");
+}
+
+/* once the headers are in: where the chunk goes, or why it does not */
+static void
+upload_begin(struct tcp_pcb *pcb, struct http_state *hs)
+{
+	u32_t b, len = hs->postlen;
+
+	hs->image = NULL;
+	hs->crc = 0;
+	if (hs->puterr || hs->putcmd != UPLOAD_CHUNK)
+		return;
+
+	if (hs->putsize == 0 || hs->putsize > FLASH_STAGING_SIZE ||
+	    hs->putoff % UPLOAD_BLOCK || len == 0 || hs->putoff + len > hs->putsize) {
+		upload_error (hs, "400 Bad Request", "bad size, offset or length");
+		return;
+	}
+
+	/* a new size starts a new upload */
+	if (hs->putsize != upload.size) {
+		if (httpd_staging_claim (&upload) == NULL) {
+			upload_error (hs, "409 Conflict", "another upload is in progress");
+			return;
+		}
+		if (upload.size != 0)
+			printk ("Resumable upload restarted\n");
+		upload.size = hs->putsize;
+		upload.blocks = (upload.size + UPLOAD_BLOCK - 1) / UPLOAD_BLOCK;
+		upload.received = 0;
+		memset (upload.have, 0, sizeof (upload.have));
+	}
+
+	/* what is about to be overwritten is not there any more */
+	for (b = hs->putoff / UPLOAD_BLOCK; b <= (hs->putoff + len - 1) / UPLOAD_BLOCK; b++)
+		upload_mark (b, 0);
+	hs->image = (char *)FLASH_STAGING_START + hs->putoff;
+
+	/* the panel shows the whole image, not this chunk */
+	netpanel_transfer ("Chunked upload", &pcb->remote_ip, upload.size);
+	netpanel.got = upload.received * UPLOAD_BLOCK;
+}
+
+static void
+upload_input(struct http_state *hs, const char *data, int len)
+{
+	if (hs->image == NULL)
+		return;
+	memcpy (hs->image + hs->postpos, data, len);
+	hs->crc = crc32_update (hs->crc, (const u8_t *)data, len);
+}
+
+/* checks and flashes the complete image, the flashing itself is left
+   to close_conn once the reply is out */
+static void
+upload_commit(struct http_state *hs)
+{
+	if (upload.size == 0 || upload.received != upload.blocks) {
+		upload_error (hs, "409 Conflict", "upload incomplete");
+		return;
+	}
+	if (strlen (hs->sha1hex) != 2 * SHA1HashSize) {
+		upload_error (hs, "400 Bad Request", "sha1 missing");
+		return;
+	}
+
+	hs->image = (char *)FLASH_STAGING_START;
+	hs->imagelen = 0;
+	SHA1Reset (&hs->sha1);
+	memset (hs->md5end, 0, sizeof (hs->md5end));
+	image_hash (hs, hs->image, upload.size);
+	hs->imagelen = upload.size;
+	if (!validate_image (hs)) {
+		upload_end_session ();
+		upload_error (hs, "422 Unprocessable Entity", "image rejected, see the screen");
+		return;
+	}
+
+	hs->bios_start = hs->image;
+	hs->bios_len = hs->imagelen;
+	upload_reply (hs, "200 OK", sprintf (hs->page, "{\"flashing\": %d}\n", hs->bios_len));
+}
+
+/* once the body is in, or right after the headers if there is none */
+static void
+upload_end(struct http_state *hs)
+{
+	u32_t b, end;
+
+	if (hs->puterr)
+		return;
+
+	switch (hs->putcmd) {
+	case UPLOAD_ABORT:
+		upload_end_session ();
+		upload_reply (hs, "200 OK", sprintf (hs->page, "{\"size\": 0}\n"));
+		return;
+	case UPLOAD_COMMIT:
+		upload_commit (hs);
+		return;
+	}
+
+	if (hs->crc != hs->putcrc) {
+		printk ("Upload chunk at %d: CRC32 mismatch\n", (int)hs->putoff);
+		upload_error (hs, "422 Unprocessable Entity", "crc mismatch");
+		return;
+	}
+	/* whole blocks, and the short one at the end of the image */
+	end = hs->putoff + hs->postlen;
+	for (b = hs->putoff / UPLOAD_BLOCK; b < upload.blocks; b++) {
+		if ((b + 1) * UPLOAD_BLOCK > end && end != upload.size)
+			break;
+		if (b * UPLOAD_BLOCK >= end)
+			break;
+		upload_mark (b, 1);
+	}
+	upload_reply (hs, "200 OK", sprintf (hs->page, "{\"size\": %d, \"received\": %d}\n",
+					   (int)upload.size,
+					   (int)(upload.received == upload.blocks ? upload.size :
+						 upload.received * UPLOAD_BLOCK)));
+}
+
+/* GET /upload.json, the byte ranges still missing, as many as fit */
+static void
+upload_status(struct http_state *hs)
+{
+	u32_t b = 0, first;
+	int len, ranges = 0;
+
+	len = sprintf (hs->page, "{\"size\": %d, \"block\": %d, \"missing\": [",
+		       (int)upload.size, UPLOAD_BLOCK);
+	while (b < upload.blocks && len < sizeof (hs->page) - 48) {
+		if (upload_has (b)) {
+			b++;
+			continue;
+		}
+		first = b;
+		while (b < upload.blocks && !upload_has (b))
+			b++;
+		len += sprintf (hs->page + len, "%s[%d, %d]", ranges++ ? ", " : "",
+				(int)(first * UPLOAD_BLOCK),
+				(int)((b == upload.blocks ? upload.size : b * UPLOAD_BLOCK) -
+				      first * UPLOAD_BLOCK));
+	}
+	len += sprintf (hs->page + len, "], \"more\": %s}\n",
+			b < upload.blocks ? "true" : "false");
+	readback_respond (hs, "application/json", hs->page, len);
+}
+
+/* picks up the part name from a Content-Disposition header line */
+static void
+mp_part_header(struct http_state *hs)
+{
+	char *name;
+	int i;
+
+	if (strncmp (hs->lineBuf, "Content-Disposition:", 20) != 0)
+		return;
+
+	for (name = hs->lineBuf; *name; name++) {
+		if (strncmp (name, "filename=", 9) == 0) {
+			hs->partisimage = 1;
+			name += 8;
+		} else if (strncmp (name, "name=\"", 6) == 0) {
+			name += 6;
+			for (i = 0; name[i] && name[i] != '"' && i < sizeof (hs->partname) - 1; i++)
+				hs->partname[i] = name[i];
+			hs->partname[i] = 0;
+			name += i - 1;
+		}
+	}
+	if (strcmp (hs->partname, "bios") == 0)
+		hs->partisimage = 1;
+}
+
+/* body bytes of the current part, images go straight to their buffer */
+static void
+mp_emit(struct http_state *hs, const char *data, int len)
+{
+	if (len <= 0)
+		return;
+
+	if (hs->partisimage) {
+		if (hs->imagelen + len > hs->imagemax) {
+			printk ("Upload does not fit the staging area\n");
+			hs->mpstate = MP_ERROR;
+			return;
+		}
+		memcpy (hs->image + hs->imagelen, data, len);
+		image_hash (hs, hs->image + hs->imagelen, len);
+		hs->imagelen += len;
+	} else {
+		if (len > sizeof (hs->field) - 1 - hs->fieldlen)
+			len = sizeof (hs->field) - 1 - hs->fieldlen;
+		memcpy (hs->field + hs->fieldlen, data, len);
+		hs->fieldlen += len;
+	}
+}
+
+static void
+mp_part_end(struct http_state *hs)
+{
+	if (hs->partisimage) {
+		hs->gotimage = 1;
+	} else {
+		hs->field[hs->fieldlen] = 0;
+		if (strcmp (hs->partname, "sha1") == 0 && hs->fieldlen >= 2 * SHA1HashSize) {
+			memcpy (hs->sha1hex, hs->field, 2 * SHA1HashSize);
+			hs->sha1hex[2 * SHA1HashSize] = 0;
+		}
+	}
+}
+
+/* searches tail + data for the delimiter with Boyer-Moore-Horspool, so most
+   bytes of the payload are skipped over rather than compared.  Everything in
+   front of the delimiter (or of a possible partial delimiter at the end) is
+   handed to mp_emit in at most two copies.  Returns the number of bytes of
+   data used up, sets MP_AFTER if the delimiter was found */
+#define MP_AT(i) ((i) < h ? hs->tail[i] : data[(i) - h])
+
+static int
+mp_body(struct http_state *hs, const char *data, int len)
+{
+	int h = hs->taillen, m = hs->delimlen;
+	int total = h + len, pos = 0, j;
+
+	while (pos + m <= total) {
+		j = m - 1;
+		while (j >= 0 && MP_AT(pos + j) == hs->delim[j])
+			j--;
+		if (j < 0)
+			break;
+		pos += hs->skip[(unsigned char)MP_AT(pos + m - 1)];
+	}
+
+	/* nothing in front of pos can start a delimiter */
+	mp_emit (hs, hs->tail, pos < h ? pos : h);
+	if (pos > h)
+		mp_emit (hs, data, pos - h);
+
+	if (pos + m <= total) {
+		hs->taillen = 0;
+		mp_part_end (hs);
+		if (hs->mpstate == MP_BODY)
+			hs->mpstate = MP_AFTER;
+		return pos + m - h;
+	}
+
+	/* keep what is left over, it may be the start of a delimiter */
+	if (pos < h) {
+		for (j = 0; j < h - pos; j++)
+			hs->tail[j] = hs->tail[pos + j];
+		memcpy (hs->tail + h - pos, data, len);
+	} else {
+		memcpy (hs->tail, data + pos - h, total - pos);
+	}
+	hs->taillen = total - pos;
+	return len;
+}
+
+#undef MP_AT
+
+/* feeds the next len bytes of the POST body through the parser */
+static void
+mp_input(struct http_state *hs, const char *data, int len)
+{
+	int i;
+
+	while (len > 0) {
+		char c;
+
+		switch (hs->mpstate) {
+		case MP_BODY:
+			i = mp_body (hs, data, len);
+			data += i;
+			len -= i;
+			continue;
+		case MP_DONE:
+		case MP_ERROR:
+			return;
+		}
+
+		/* the remaining states go a byte at a time, they only see
+		   the few short lines around each delimiter */
+		c = *data++;
+		len--;
+
+		switch (hs->mpstate) {
+		case MP_FIRST:
+			if (c == '\r')
+				break;
+			if (c != '\n') {
+				if (hs->lineBufpos < MP_DELIM_MAX - 2)
+					hs->delim[2 + hs->lineBufpos++] = c;
+				else
+					hs->mpstate = MP_ERROR;
+				break;
+			}
+			if (hs->lineBufpos < 3) {
+				hs->mpstate = MP_ERROR;
+				break;
+			}
+			hs->delim[0] = '\r';
+			hs->delim[1] = '\n';
+			hs->delimlen = hs->lineBufpos + 2;
+			for (i = 0; i < 256; i++)
+				hs->skip[i] = hs->delimlen;
+			for (i = 0; i < hs->delimlen - 1; i++)
+				hs->skip[(unsigned char)hs->delim[i]] = hs->delimlen - 1 - i;
+			hs->lineBufpos = 0;
+			hs->mpstate = MP_HEADERS;
+			hs->partisimage = 0;
+			hs->partname[0] = 0;
+			break;
+
+		case MP_HEADERS:
+			if (c == '\r')
+				break;
+			if (c != '\n') {
+				if (hs->lineBufpos < sizeof (hs->lineBuf) - 2)
+					hs->lineBuf[hs->lineBufpos++] = c;
+				break;
+			}
+			hs->lineBuf[hs->lineBufpos] = 0;
+			if (hs->lineBufpos == 0) {
+				hs->mpstate = MP_BODY;
+				hs->taillen = 0;
+				hs->fieldlen = 0;
+			} else {
+				mp_part_header (hs);
+			}
+			hs->lineBufpos = 0;
+			break;
+
+		case MP_AFTER:
+			if (c == '-') {
+				/* "--" after the delimiter closes the upload */
+				hs->mpstate = MP_DONE;
+				handle_post (hs);
+			} else if (c == '\n') {
+				hs->mpstate = MP_HEADERS;
+				hs->partisimage = 0;
+				hs->partname[0] = 0;
+			}
+			break;
+		}
+	}
+}
 /*-----------------------------------------------------------------------------------*/
-static err_t
-http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+/* feeds received data to the request parser, returns how much of it was
+   used.  Parsing stops once a response is under way, -1 closes */
+static int
+http_parse(struct tcp_pcb *pcb, struct http_state *hs, char *data, int len)
 {
+  int used = 0;
   int i;
-  char *data;
-  struct http_state *hs;
 
-  hs = arg;
+	  while (used < len && !hs->responding) {
+		  if (hs->inbody) {
+			  /* the body goes through the multipart parser in bulk */
+			  i = hs->postlen - hs->postpos;
+			  if (i > len - used)
+				  i = len - used;
+			  if (hs->isput)
+				  upload_input (hs, data + used, i);
+			  else
+				  mp_input (hs, data + used, i);
+			  used += i;
+			  hs->postpos += i;
+			  netpanel_progress (i);
+			  if (hs->postpos == hs->postlen) {
+				  if (hs->isput) {
+					  upload_end (hs);
+				  } else if (hs->mpstate != MP_DONE) {
+					  printk ("Incomplete upload\n");
+					  hs->file = http_files[5].data;
+					  hs->left = http_files[5].len;
+					  hs->bios_start = NULL;
+				  }
+				  hs->inbody = 0;
+				  respond(pcb, hs);
+			  }
+			  continue;
+		  }
 
-  if (err == ERR_OK && p != NULL) {
-	  struct pbuf *q;
-    /* Inform TCP that we have taken the data. */
-    tcp_recved(pcb, p->tot_len);
-
-	  for (q = p; q; q = q->next) {
-		  for (i = 0; i < q->len; i++) {
-			  char c = ((char *)q->payload)[i];
-
-			  if (!hs->postdata) {
-				  if (c == '\r') /* ignore \r */
-					  continue;
-				  
-				  if (c == '\n') {
-					  hs->lineBuf[hs->lineBufpos] = 0;
-					  if (!handle_line (pcb, hs)) {
-						  pbuf_free(p);
-						  close_conn(pcb, hs);
-						  return ERR_OK;
-					  }
-					  hs->lineBufpos = 0;
-				  } else {
-					  if (hs->lineBufpos < sizeof (hs->lineBuf) - 2)
-						  hs->lineBuf[hs->lineBufpos++] = c;
+		  {
+			  char c = data[used++];
+
+			  if (c == '\r') /* ignore \r */
+				  continue;
+			  
+			  if (c == '\n') {
+				  hs->lineBuf[hs->lineBufpos] = 0;
+				  if (!handle_line (pcb, hs)) {
+					  return -1;
 				  }
+				  hs->lineBufpos = 0;
 			  } else {
-				  hs->postdata[hs->postpos++] = c;
-				  if (hs->postpos == hs->postlen) {
-					  handle_post (hs);
-					  send_data(pcb, hs);
-					  tcp_poll(pcb, http_poll, 4);
-					  tcp_sent(pcb, http_sent);
-					  hs->gotfirst = 0;
-				  }
+				  if (hs->lineBufpos < sizeof (hs->lineBuf) - 2)
+					  hs->lineBuf[hs->lineBufpos++] = c;
 			  }
 		  }
 	  }
+  return used;
+}
+/*-----------------------------------------------------------------------------------*/
+/* parses what has been received until it runs out or a response is
+   started.  The rest waits, and is only acknowledged to TCP once parsed so
+   a pipelining client is held back by the window */
+static int
+http_input(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  struct pbuf *q;
+  int used;
+  u16_t len;
 
-	pbuf_free(p);
+  while ((q = hs->pending) != NULL && !hs->responding) {
+    used = http_parse(pcb, hs, (char *)q->payload + hs->pendingoff,
+		      q->len - hs->pendingoff);
+    if (used < 0) {
+      return 0;
+    }
+    hs->pendingoff += used;
+    if (hs->pendingoff == q->len) {
+      len = q->len;
+      hs->pending = q->next;
+      hs->pendingoff = 0;
+      if (q->next != NULL) {
+        pbuf_ref(q->next);
+      }
+      pbuf_free(q);
+      tcp_recved(pcb, len);
+    }
+  }
+  return 1;
+}
+/*-----------------------------------------------------------------------------------*/
+static err_t
+http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  struct http_state *hs;
+
+  hs = arg;
+
+  if (err == ERR_OK && p != NULL) {
+    hs->retries = 0;
+    if (hs->pending != NULL) {
+      pbuf_cat(hs->pending, p);
+    } else {
+      hs->pending = p;
+      hs->pendingoff = 0;
+    }
+    if (!http_input(pcb, hs)) {
+      close_conn(pcb, hs);
+      return ERR_OK;
+    }
   }
   if (err == ERR_OK && p == NULL) {
     close_conn(pcb, hs);
@@ -394,15 +1521,11 @@ http_accept(void *arg, struct tcp_pcb *pcb, err_t err)
   }
 
   /* Initialize the structure. */
-  hs->file = NULL;
-  hs->left = 0;
   hs->retries = 0;
-  hs->lineBufpos = 0;
-  hs->gotfirst = 0;
-  hs->ispost = 0;
-  hs->postdata = NULL;
-  hs->postpos = 0;
-  hs->postlen = 0;
+  hs->keepalive = 0;
+  hs->pending = NULL;
+  hs->pendingoff = 0;
+  request_reset(hs);
 
   hs->bios_start = NULL;
   hs->bios_len = 0;
@@ -416,6 +1539,9 @@ http_accept(void *arg, struct tcp_pcb *pcb, err_t err)
   tcp_recv(pcb, http_recv);
 
   tcp_err(pcb, conn_err);
+
+  tcp_poll(pcb, http_poll, 4);
+  tcp_sent(pcb, http_sent);
   
   return ERR_OK;
 }
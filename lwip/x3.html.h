@@ -1 +1 @@
-"HTTP/1.1 200 OK\r\nConnection: close\r\nServer: FlashBIOS/2.6\r\nContent-Type: text/html\r\nContent-Length: 1819\r\n\r\n\x3c\x21\x44\x4f\x43\x54\x59\x50\x45\x20\x48\x54\x4d\x4c\x20\x50\x55\x42\x4c\x49\x43\x20\x22\x2d\x2f\x2f\x57\x33\x43\x2f\x2f\x44\x54\x44\x20\x48\x54\x4d\x4c\x20\x34\x2e\x30\x31\x20\x54\x72\x61\x6e\x73\x69\x74\x69\x6f\x6e\x61\x6c\x2f\x2f\x45\x4e\x22\x20\x22\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x77\x33\x2e\x6f\x72\x67\x2f\x54\x52\x2f\x68\x74\x6d\x6c\x34\x2f\x6c\x6f\x6f\x73\x65\x2e\x64\x74\x64\x22\x3e\xa\x3c\x48\x54\x4d\x4c\x3e\xa\x3c\x48\x45\x41\x44\x3e\xa\x3c\x54\x49\x54\x4c\x45\x3e\x58\x33\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x3c\x2f\x54\x49\x54\x4c\x45\x3e\xa\x3c\x4d\x45\x54\x41\x20\x68\x74\x74\x70\x2d\x65\x71\x75\x69\x76\x3d\x22\x43\x6f\x6e\x74\x65\x6e\x74\x2d\x54\x79\x70\x65\x22\x20\x63\x6f\x6e\x74\x65\x6e\x74\x3d\x22\x74\x65\x78\x74\x2f\x68\x74\x6d\x6c\x3b\x20\x63\x68\x61\x72\x73\x65\x74\x3d\x69\x73\x6f\x2d\x38\x38\x35\x39\x2d\x31\x22\x3e\xa\x3c\x53\x54\x59\x4c\x45\x20\x54\x59\x50\x45\x3d\x22\x74\x65\x78\x74\x2f\x63\x73\x73\x22\x20\x4d\x45\x44\x49\x41\x3d\x73\x63\x72\x65\x65\x6e\x3e\xa\x3c\x21\x2d\x2d\xa\x20\x20\x62\x6f\x64\x79\x20\x7b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x66\x66\x66\x66\x66\x66\x3b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x62\x6c\x61\x63\x6b\x3b\x20\x74\x65\x78\x74\x2d\x61\x6c\x69\x67\x6e\x3a\x20\x63\x65\x6e\x74\x65\x72\x3b\x20\x6d\x61\x72\x67\x69\x6e\x2d\x72\x69\x67\x68\x74\x3a\x20\x31\x31\x30\x70\x78\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x69\x6d\x61\x67\x65\x3a\x20\x75\x72\x6c\x28\x22\x2f\x31\x22\x29\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x72\x65\x70\x65\x61\x74\x3a\x20\x6e\x6f\x2d\x72\x65\x70\x65\x61\x74\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x70\x6f\x73\x69\x74\x69\x6f\x6e\x3a\x20\x63\x65\x6e\x74\x65\x72\x20\x63\x65\x6e\x74\x65\x72\x3b\x20\x7d\xa\x20\x20\x64\x69\x76\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x66\x6f\x6e\x74\x2d\x73\x69\x7a\x65\x3a\x20\x31\x34\x70\x78\x3b\x20\x66\x6f\x6e\x74\x2d\x66\x61\x6d\x69\x6c\x79\x3a\x20\x22\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x20\x4e\x65\x75\x65\x22\x2c\x20\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x2c\x20\x41\x72\x69\x61\x6c\x2c\x20\x53\x61\x6e\x73\x2d\x73\x65\x72\x69\x66\x3b\x20\x70\x61\x64\x64\x69\x6e\x67\x3a\x20\x31\x30\x70\x78\x7d\xa\x20\x20\x68\x31\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x66\x6f\x6e\x74\x2d\x73\x69\x7a\x65\x3a\x20\x32\x34\x70\x78\x3b\x20\x66\x6f\x6e\x74\x2d\x66\x61\x6d\x69\x6c\x79\x3a\x20\x22\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x20\x4e\x65\x75\x65\x22\x2c\x20\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x2c\x20\x41\x72\x69\x61\x6c\x2c\x20\x53\x61\x6e\x73\x2d\x73\x65\x72\x69\x66\x3b\x20\x7d\xa\x20\x20\x61\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x38\x38\x3b\x20\x74\x65\x78\x74\x2d\x64\x65\x63\x6f\x72\x61\x74\x69\x6f\x6e\x3a\x20\x6e\x6f\x6e\x65\x3b\x20\x7d\xa\x20\x20\x69\x6e\x70\x75\x74\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x7d\xa\x20\x20\x61\x3a\x68\x6f\x76\x65\x72\x2c\x20\x61\x3a\x61\x63\x74\x69\x76\x65\x20\x7b\x74\x65\x78\x74\x2d\x64\x65\x63\x6f\x72\x61\x74\x69\x6f\x6e\x3a\x20\x75\x6e\x64\x65\x72\x6c\x69\x6e\x65\x3b\x20\x7d\xa\x2d\x2d\x3e\xa\x3c\x2f\x53\x54\x59\x4c\x45\x3e\xa\x3c\x2f\x48\x45\x41\x44\x3e\xa\x3c\x42\x4f\x44\x59\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x20\x3c\x48\x31\x3e\x58\x65\x63\x75\x74\x65\x72\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x20\x76\x33\x2e\x30\x2e\x30\x3c\x2f\x48\x31\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x55\x73\x65\x20\x74\x68\x65\x20\x66\x6f\x72\x6d\x20\x62\x65\x6c\x6f\x77\x20\x74\x6f\x20\x75\x70\x64\x61\x74\x65\x20\x74\x68\x65\x20\x42\x49\x4f\x53\x20\x6f\x66\x20\x79\x6f\x75\x72\x20\x6d\x6f\x64\x63\x68\x69\x70\x20\x76\x69\x61\xa\x77\x65\x62\x73\x65\x72\x76\x65\x72\x2e\x20\x3c\x42\x3e\x57\x41\x52\x4e\x49\x4e\x47\x21\x3c\x2f\x42\x3e\x20\x49\x74\x20\x77\x69\x6c\x6c\x20\x75\x73\x65\x20\x74\x68\x65\x20\x66\x69\x6c\x65\x20\x79\x6f\x75\x20\x75\x70\x6c\x6f\x61\x64\x20\x74\x6f\x20\x72\x65\x70\x6c\x61\x63\x65\xa\x74\x68\x65\x20\x63\x6f\x6e\x74\x65\x6e\x74\x73\x20\x6f\x66\x20\x74\x68\x65\x20\x63\x75\x72\x72\x65\x6e\x74\x6c\x79\x20\x73\x65\x6c\x65\x63\x74\x65\x64\x20\x31\x4d\x42\x20\x62\x61\x6e\x6b\x20\x28\x46\x6f\x72\x20\x58\x32\x20\x6d\x6f\x64\x73\x20\x69\x74\x20\x77\x69\x6c\x6c\xa\x73\x69\x6d\x70\x6c\x79\x20\x73\x74\x61\x72\x74\x20\x66\x6c\x61\x73\x68\x69\x6e\x67\x20\x66\x72\x6f\x6d\x20\x74\x68\x65\x20\x62\x65\x67\x69\x6e\x6e\x69\x6e\x67\x20\x6f\x66\x20\x62\x61\x6e\x6b\x20\x31\x20\x2d\x20\x79\x6f\x75\x72\x20\x62\x69\x6f\x73\x20\x6e\x65\x65\x64\x73\xa\x74\x6f\x20\x69\x64\x65\x61\x6c\x6c\x79\x20\x62\x65\x20\x35\x31\x32\x6b\x20\x28\x32\x20\x78\x20\x32\x35\x36\x6b\x29\x20\x2d\x20\x74\x68\x61\x74\x20\x77\x61\x79\x20\x69\x66\x20\x79\x6f\x75\x20\x6d\x65\x73\x73\x20\x75\x70\x20\x79\x6f\x75\x20\x63\x61\x6e\x20\x73\x77\x69\x74\x63\x68\xa\x74\x6f\x20\x62\x61\x6e\x6b\x20\x32\x20\x61\x6e\x64\x20\x67\x65\x74\x20\x62\x61\x63\x6b\x20\x74\x6f\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x20\x76\x33\x2e\x30\x2e\x30\x29\x2e\x20\x4d\x61\x6b\x65\x20\x73\x75\x72\x65\x20\x79\x6f\x75\x20\x68\x61\x76\x65\x20\x72\x65\x61\x64\xa\x61\x6c\x6c\x20\x74\x68\x65\x20\x3c\x41\x20\x54\x41\x52\x47\x45\x54\x3d\x22\x5f\x62\x6c\x61\x6e\x6b\x22\xa\x48\x52\x45\x46\x3d\x22\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x74\x65\x61\x6d\x78\x65\x63\x75\x74\x65\x72\x2e\x63\x6f\x6d\x2f\x66\x6c\x61\x73\x68\x62\x69\x6f\x73\x2f\x22\x3e\x64\x6f\x63\x75\x6d\x65\x6e\x74\x61\x74\x69\x6f\x6e\x3c\x2f\x41\x3e\x20\x62\x65\x66\x6f\x72\x65\xa\x66\x6c\x61\x73\x68\x69\x6e\x67\x2e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x3c\x46\x4f\x52\x4d\x20\x4d\x45\x54\x48\x4f\x44\x3d\x22\x50\x4f\x53\x54\x22\x20\x45\x4e\x43\x54\x59\x50\x45\x3d\x22\x6d\x75\x6c\x74\x69\x70\x61\x72\x74\x2f\x66\x6f\x72\x6d\x2d\x64\x61\x74\x61\x22\x20\x41\x43\x54\x49\x4f\x4e\x3d\x22\x2f\x30\x22\x3e\xa\x53\x65\x6c\x65\x63\x74\x20\x42\x49\x4f\x53\x20\x46\x69\x6c\x65\x3a\x20\x3c\x49\x4e\x50\x55\x54\x20\x54\x59\x50\x45\x3d\x22\x66\x69\x6c\x65\x22\x20\x4e\x41\x4d\x45\x3d\x22\x62\x69\x6f\x73\x22\x3e\xa\x3c\x49\x4e\x50\x55\x54\x20\x54\x59\x50\x45\x3d\x22\x73\x75\x62\x6d\x69\x74\x22\x20\x56\x41\x4c\x55\x45\x3d\x22\x55\x70\x6c\x6f\x61\x64\x20\x61\x6e\x64\x20\x46\x6c\x61\x73\x68\x22\x3e\xa\x3c\x2f\x46\x4f\x52\x4d\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x3c\x42\x3e\x58\x65\x63\x75\x74\x65\x72\x20\x33\x20\x42\x69\x6f\x73\x20\x42\x61\x6e\x6b\x20\x53\x77\x69\x74\x63\x68\x65\x73\x3c\x2f\x42\x3e\x3c\x42\x52\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x44\x49\x56\x3e\xa\x31\x4d\x42\x20\x42\x69\x6f\x73\x20\x42\x61\x6e\x6b\x73\x3c\x42\x52\x3e\xa\x42\x61\x6e\x6b\x20\x31\x32\x33\x34\x3a\x20\x6f\x6e\x20\x6f\x6e\x20\x6f\x66\x66\x20\x6f\x66\x66\x3c\x42\x52\x3e\xa\x42\x61\x6e\x6b\x20\x35\x36\x37\x38\x3a\x20\x6f\x66\x66\x20\x6f\x6e\x20\x6f\x66\x66\x20\x6f\x66\x66\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x44\x49\x56\x3e\xa\x57\x68\x65\x6e\x20\x73\x77\x69\x74\x63\x68\x20\x69\x73\x20\x64\x69\x73\x63\x6f\x6e\x6e\x65\x63\x74\x65\x64\x20\x74\x68\x65\x20\x58\x33\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74\x6f\x20\x31\x4d\x42\x20\x42\x69\x6f\x73\x20\x28\x42\x61\x6e\x6b\x73\x20\x31\x32\x33\x34\x29\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x2f\x42\x4f\x44\x59\x3e\xa\x3c\x2f\x48\x54\x4d\x4c\x3e\xa"
+"HTTP/1.1 200 OK\r\nServer: FlashBIOS/2.6\r\nContent-Type: text/html\r\nContent-Length: 1819\r\n\r\n\x3c\x21\x44\x4f\x43\x54\x59\x50\x45\x20\x48\x54\x4d\x4c\x20\x50\x55\x42\x4c\x49\x43\x20\x22\x2d\x2f\x2f\x57\x33\x43\x2f\x2f\x44\x54\x44\x20\x48\x54\x4d\x4c\x20\x34\x2e\x30\x31\x20\x54\x72\x61\x6e\x73\x69\x74\x69\x6f\x6e\x61\x6c\x2f\x2f\x45\x4e\x22\x20\x22\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x77\x33\x2e\x6f\x72\x67\x2f\x54\x52\x2f\x68\x74\x6d\x6c\x34\x2f\x6c\x6f\x6f\x73\x65\x2e\x64\x74\x64\x22\x3e\xa\x3c\x48\x54\x4d\x4c\x3e\xa\x3c\x48\x45\x41\x44\x3e\xa\x3c\x54\x49\x54\x4c\x45\x3e\x58\x33\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x3c\x2f\x54\x49\x54\x4c\x45\x3e\xa\x3c\x4d\x45\x54\x41\x20\x68\x74\x74\x70\x2d\x65\x71\x75\x69\x76\x3d\x22\x43\x6f\x6e\x74\x65\x6e\x74\x2d\x54\x79\x70\x65\x22\x20\x63\x6f\x6e\x74\x65\x6e\x74\x3d\x22\x74\x65\x78\x74\x2f\x68\x74\x6d\x6c\x3b\x20\x63\x68\x61\x72\x73\x65\x74\x3d\x69\x73\x6f\x2d\x38\x38\x35\x39\x2d\x31\x22\x3e\xa\x3c\x53\x54\x59\x4c\x45\x20\x54\x59\x50\x45\x3d\x22\x74\x65\x78\x74\x2f\x63\x73\x73\x22\x20\x4d\x45\x44\x49\x41\x3d\x73\x63\x72\x65\x65\x6e\x3e\xa\x3c\x21\x2d\x2d\xa\x20\x20\x62\x6f\x64\x79\x20\x7b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x66\x66\x66\x66\x66\x66\x3b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x62\x6c\x61\x63\x6b\x3b\x20\x74\x65\x78\x74\x2d\x61\x6c\x69\x67\x6e\x3a\x20\x63\x65\x6e\x74\x65\x72\x3b\x20\x6d\x61\x72\x67\x69\x6e\x2d\x72\x69\x67\x68\x74\x3a\x20\x31\x31\x30\x70\x78\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x69\x6d\x61\x67\x65\x3a\x20\x75\x72\x6c\x28\x22\x2f\x31\x22\x29\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x72\x65\x70\x65\x61\x74\x3a\x20\x6e\x6f\x2d\x72\x65\x70\x65\x61\x74\x3b\x20\x62\x61\x63\x6b\x67\x72\x6f\x75\x6e\x64\x2d\x70\x6f\x73\x69\x74\x69\x6f\x6e\x3a\x20\x63\x65\x6e\x74\x65\x72\x20\x63\x65\x6e\x74\x65\x72\x3b\x20\x7d\xa\x20\x20\x64\x69\x76\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x66\x6f\x6e\x74\x2d\x73\x69\x7a\x65\x3a\x20\x31\x34\x70\x78\x3b\x20\x66\x6f\x6e\x74\x2d\x66\x61\x6d\x69\x6c\x79\x3a\x20\x22\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x20\x4e\x65\x75\x65\x22\x2c\x20\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x2c\x20\x41\x72\x69\x61\x6c\x2c\x20\x53\x61\x6e\x73\x2d\x73\x65\x72\x69\x66\x3b\x20\x70\x61\x64\x64\x69\x6e\x67\x3a\x20\x31\x30\x70\x78\x7d\xa\x20\x20\x68\x31\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x66\x6f\x6e\x74\x2d\x73\x69\x7a\x65\x3a\x20\x32\x34\x70\x78\x3b\x20\x66\x6f\x6e\x74\x2d\x66\x61\x6d\x69\x6c\x79\x3a\x20\x22\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x20\x4e\x65\x75\x65\x22\x2c\x20\x48\x65\x6c\x76\x65\x74\x69\x63\x61\x2c\x20\x41\x72\x69\x61\x6c\x2c\x20\x53\x61\x6e\x73\x2d\x73\x65\x72\x69\x66\x3b\x20\x7d\xa\x20\x20\x61\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x38\x38\x3b\x20\x74\x65\x78\x74\x2d\x64\x65\x63\x6f\x72\x61\x74\x69\x6f\x6e\x3a\x20\x6e\x6f\x6e\x65\x3b\x20\x7d\xa\x20\x20\x69\x6e\x70\x75\x74\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23\x30\x30\x30\x30\x33\x33\x3b\x20\x7d\xa\x20\x20\x61\x3a\x68\x6f\x76\x65\x72\x2c\x20\x61\x3a\x61\x63\x74\x69\x76\x65\x20\x7b\x74\x65\x78\x74\x2d\x64\x65\x63\x6f\x72\x61\x74\x69\x6f\x6e\x3a\x20\x75\x6e\x64\x65\x72\x6c\x69\x6e\x65\x3b\x20\x7d\xa\x2d\x2d\x3e\xa\x3c\x2f\x53\x54\x59\x4c\x45\x3e\xa\x3c\x2f\x48\x45\x41\x44\x3e\xa\x3c\x42\x4f\x44\x59\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x20\x3c\x48\x31\x3e\x58\x65\x63\x75\x74\x65\x72\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x20\x76\x33\x2e\x30\x2e\x30\x3c\x2f\x48\x31\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x55\x73\x65\x20\x74\x68\x65\x20\x66\x6f\x72\x6d\x20\x62\x65\x6c\x6f\x77\x20\x74\x6f\x20\x75\x70\x64\x61\x74\x65\x20\x74\x68\x65\x20\x42\x49\x4f\x53\x20\x6f\x66\x20\x79\x6f\x75\x72\x20\x6d\x6f\x64\x63\x68\x69\x70\x20\x76\x69\x61\xa\x77\x65\x62\x73\x65\x72\x76\x65\x72\x2e\x20\x3c\x42\x3e\x57\x41\x52\x4e\x49\x4e\x47\x21\x3c\x2f\x42\x3e\x20\x49\x74\x20\x77\x69\x6c\x6c\x20\x75\x73\x65\x20\x74\x68\x65\x20\x66\x69\x6c\x65\x20\x79\x6f\x75\x20\x75\x70\x6c\x6f\x61\x64\x20\x74\x6f\x20\x72\x65\x70\x6c\x61\x63\x65\xa\x74\x68\x65\x20\x63\x6f\x6e\x74\x65\x6e\x74\x73\x20\x6f\x66\x20\x74\x68\x65\x20\x63\x75\x72\x72\x65\x6e\x74\x6c\x79\x20\x73\x65\x6c\x65\x63\x74\x65\x64\x20\x31\x4d\x42\x20\x62\x61\x6e\x6b\x20\x28\x46\x6f\x72\x20\x58\x32\x20\x6d\x6f\x64\x73\x20\x69\x74\x20\x77\x69\x6c\x6c\xa\x73\x69\x6d\x70\x6c\x79\x20\x73\x74\x61\x72\x74\x20\x66\x6c\x61\x73\x68\x69\x6e\x67\x20\x66\x72\x6f\x6d\x20\x74\x68\x65\x20\x62\x65\x67\x69\x6e\x6e\x69\x6e\x67\x20\x6f\x66\x20\x62\x61\x6e\x6b\x20\x31\x20\x2d\x20\x79\x6f\x75\x72\x20\x62\x69\x6f\x73\x20\x6e\x65\x65\x64\x73\xa\x74\x6f\x20\x69\x64\x65\x61\x6c\x6c\x79\x20\x62\x65\x20\x35\x31\x32\x6b\x20\x28\x32\x20\x78\x20\x32\x35\x36\x6b\x29\x20\x2d\x20\x74\x68\x61\x74\x20\x77\x61\x79\x20\x69\x66\x20\x79\x6f\x75\x20\x6d\x65\x73\x73\x20\x75\x70\x20\x79\x6f\x75\x20\x63\x61\x6e\x20\x73\x77\x69\x74\x63\x68\xa\x74\x6f\x20\x62\x61\x6e\x6b\x20\x32\x20\x61\x6e\x64\x20\x67\x65\x74\x20\x62\x61\x63\x6b\x20\x74\x6f\x20\x46\x6c\x61\x73\x68\x42\x49\x4f\x53\x20\x76\x33\x2e\x30\x2e\x30\x29\x2e\x20\x4d\x61\x6b\x65\x20\x73\x75\x72\x65\x20\x79\x6f\x75\x20\x68\x61\x76\x65\x20\x72\x65\x61\x64\xa\x61\x6c\x6c\x20\x74\x68\x65\x20\x3c\x41\x20\x54\x41\x52\x47\x45\x54\x3d\x22\x5f\x62\x6c\x61\x6e\x6b\x22\xa\x48\x52\x45\x46\x3d\x22\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x74\x65\x61\x6d\x78\x65\x63\x75\x74\x65\x72\x2e\x63\x6f\x6d\x2f\x66\x6c\x61\x73\x68\x62\x69\x6f\x73\x2f\x22\x3e\x64\x6f\x63\x75\x6d\x65\x6e\x74\x61\x74\x69\x6f\x6e\x3c\x2f\x41\x3e\x20\x62\x65\x66\x6f\x72\x65\xa\x66\x6c\x61\x73\x68\x69\x6e\x67\x2e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x3c\x46\x4f\x52\x4d\x20\x4d\x45\x54\x48\x4f\x44\x3d\x22\x50\x4f\x53\x54\x22\x20\x45\x4e\x43\x54\x59\x50\x45\x3d\x22\x6d\x75\x6c\x74\x69\x70\x61\x72\x74\x2f\x66\x6f\x72\x6d\x2d\x64\x61\x74\x61\x22\x20\x41\x43\x54\x49\x4f\x4e\x3d\x22\x2f\x30\x22\x3e\xa\x53\x65\x6c\x65\x63\x74\x20\x42\x49\x4f\x53\x20\x46\x69\x6c\x65\x3a\x20\x3c\x49\x4e\x50\x55\x54\x20\x54\x59\x50\x45\x3d\x22\x66\x69\x6c\x65\x22\x20\x4e\x41\x4d\x45\x3d\x22\x62\x69\x6f\x73\x22\x3e\xa\x3c\x49\x4e\x50\x55\x54\x20\x54\x59\x50\x45\x3d\x22\x73\x75\x62\x6d\x69\x74\x22\x20\x56\x41\x4c\x55\x45\x3d\x22\x55\x70\x6c\x6f\x61\x64\x20\x61\x6e\x64\x20\x46\x6c\x61\x73\x68\x22\x3e\xa\x3c\x2f\x46\x4f\x52\x4d\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\xa\x3c\x44\x49\x56\x3e\xa\x3c\x42\x3e\x58\x65\x63\x75\x74\x65\x72\x20\x33\x20\x42\x69\x6f\x73\x20\x42\x61\x6e\x6b\x20\x53\x77\x69\x74\x63\x68\x65\x73\x3c\x2f\x42\x3e\x3c\x42\x52\x3e\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x44\x49\x56\x3e\xa\x31\x4d\x42\x20\x42\x69\x6f\x73\x20\x42\x61\x6e\x6b\x73\x3c\x42\x52\x3e\xa\x42\x61\x6e\x6b\x20\x31\x32\x33\x34\x3a\x20\x6f\x6e\x20\x6f\x6e\x20\x6f\x66\x66\x20\x6f\x66\x66\x3c\x42\x52\x3e\xa\x42\x61\x6e\x6b\x20\x35\x36\x37\x38\x3a\x20\x6f\x66\x66\x20\x6f\x6e\x20\x6f\x66\x66\x20\x6f\x66\x66\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x44\x49\x56\x3e\xa\x57\x68\x65\x6e\x20\x73\x77\x69\x74\x63\x68\x20\x69\x73\x20\x64\x69\x73\x63\x6f\x6e\x6e\x65\x63\x74\x65\x64\x20\x74\x68\x65\x20\x58\x33\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74\x6f\x20\x31\x4d\x42\x20\x42\x69\x6f\x73\x20\x28\x42\x61\x6e\x6b\x73\x20\x31\x32\x33\x34\x29\xa\x3c\x2f\x44\x49\x56\x3e\xa\x3c\x2f\x42\x4f\x44\x59\x3e\xa\x3c\x2f\x48\x54\x4d\x4c\x3e\xa"
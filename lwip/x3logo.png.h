@@ -1 +1 @@
-"HTTP/1.1 200 OK\r\nConnection: close\r\nServer: FlashBIOS/2.6\r\nContent-Type: image/png\r\nContent-Length: 9525\r\n\r\n\x89\x50\x4e\x47\xd\xa\x1a\xa\x0\x0\x0\xd\x49\x48\x44\x52\x0\x0\x6\x16\x0\x0\x4\xb8\x4\x0\x0\x0\x0\x1b\xc3\x40\x28\x0\x0\x24\xfc\x49\x44\x41\x54\x78\xda\xed\xdd\x9\x62\xdc\xb8\x11\x5\x50\xcd\xd\xa6\xef\x7f\xc7\x20\x27\x88\x33\x8b\x3d\x23\x5b\x5b\x93\x4\xc0\x5a\xde\x3f\x40\xa2\x26\xf0\x58\xbf\x46\xb2\xf4\xdb\xb7\x97\xfd\x19\x2f\x52\x23\xbf\xfd\x5e\xe9\xc3\x7c\x3\x41\x70\xb8\xc3\xc2\xb7\xff\xba\x3d\xd5\xf2\x60\x1\x5\x29\x35\x1a\xf6\x5a\xd0\x8f\x8c\x6\x16\x50\x30\x19\x58\x40\x1\x6\x16\xac\xa\x30\xb0\x60\x2a\xc0\xc0\x82\xb1\x60\x7f\x66\xc1\x58\x30\x18\x58\x40\x41\x2a\xc\x86\x4d\x16\x34\x24\x18\x58\x30\x16\xb4\x24\x16\x8c\x5\x83\x81\x5\x14\xc\x6\x16\x34\x24\x83\x81\x5\x63\x41\x92\x63\xd8\x61\xc1\x58\xd0\x92\x58\x40\xc1\x60\x60\x41\x43\x32\x18\x58\x30\x16\x60\x60\xc1\x58\x90\xcc\x2d\x69\xb5\x5\x14\xc\x6\x16\x34\x24\x83\x81\x5\x63\x1\x6\x16\x8c\x5\xc9\xdb\x92\xd6\x5a\x30\x16\xc\x6\x16\x50\x30\x18\x58\xd0\x90\x24\x27\x86\x95\x16\x8c\x5\x2d\x89\x5\x63\xc1\x60\x60\x1\x5\xc9\x3a\x18\xd6\x59\xd0\x90\x60\x60\xc1\x58\x90\x8c\x2d\x69\x99\x5\x63\xc1\x60\x60\x1\x5\x49\x39\x18\x56\x59\xd0\x90\x24\x1b\x86\x45\x16\x8c\x5\x49\xd7\x92\x16\x59\x30\x16\x24\xdd\x60\x58\x63\x1\x5\xc9\x37\x18\x96\x58\xd0\x90\x24\x21\x86\x25\x16\x8c\x5\x49\xd8\x92\x56\x58\x30\x16\x24\xe3\x60\x58\x61\xc1\x58\x90\x8c\x83\x61\x81\x5\x14\x24\x25\x86\xf9\x16\x34\x24\xc9\xd9\x92\xe6\x5b\x30\x16\x24\xe7\x60\x98\x6e\xc1\x58\x90\xa4\x83\x61\xb6\x5\x14\x24\x2b\x86\xd9\x16\x34\x24\xc9\xda\x92\x26\x5b\x30\x16\x24\xed\x60\x98\x6c\xc1\x58\x90\xb4\x83\x61\xae\x5\x14\x24\x2f\x86\xa9\x16\x34\x24\x49\xdc\x92\xa6\x5a\x30\x16\x24\xf1\x60\x98\x69\xc1\x58\x90\xcc\x83\x61\xa2\x5\x14\x24\x35\x86\x89\x16\x34\x24\x49\xdd\x92\xe6\x59\x30\x16\x24\xf7\x60\x98\x67\xc1\x58\x90\xdc\x83\x61\x9a\x5\x14\x24\xf9\x60\x98\x65\x41\x43\x92\xec\x18\x66\x59\x30\x16\x24\x7b\x4b\x9a\x64\xc1\x58\x90\xf4\x83\x61\x92\x5\x63\x41\xd2\xf\x86\x39\x16\x50\x90\xfc\x18\xa6\x58\xd0\x90\xa4\x40\x4b\x9a\x62\xc1\x58\x90\x2\x83\x61\x86\x5\x63\x41\x2a\xc\x86\x9\x16\x50\x90\x12\x18\x26\x58\xd0\x90\xa4\x44\x4b\xba\x6e\xc1\x58\x90\x1a\x83\xe1\xba\x5\x63\x41\x6a\xc\x86\xcb\x16\x50\x90\x22\x18\xae\x5a\xd0\x90\xa4\x4a\x4b\xba\x6a\xc1\x58\x90\x2a\x83\xe1\xa2\x5\x63\x41\xca\xc\x86\x6b\x16\x16\x50\x88\xfb\x9f\x19\xb8\x2f\x7e\xc8\xd7\x2c\x8c\x46\x14\xd4\xc1\xea\x2d\xe9\x92\x85\xf9\x6f\xca\xc0\xdf\x89\x41\xa1\xfa\x2b\xef\x92\x85\x81\x82\xd4\x39\xe8\x2b\x16\xa6\x8f\x85\xc0\x14\x2c\xb\xf5\x8f\xfa\x82\x85\xf9\xd7\xc3\xde\xac\x25\xe5\xb4\x30\xfa\x50\xd0\x90\x3a\xc\x86\xf3\x16\x3a\x35\x24\x14\x3a\xc\x86\xf3\x16\x46\x1f\xa\x1a\x52\xb\xc\xa7\x2d\x34\x6a\x48\x28\xf4\x68\x49\x67\x2d\x4c\xbf\x1f\x28\x18\xc\x49\x2d\x34\x6a\x48\x96\x85\x26\x83\xe1\xa4\x85\xd9\xef\x4a\x14\x60\x48\x6a\xa1\x11\x5\xd\xa9\x4d\x4b\x3a\x67\x61\x94\x7e\x26\x28\xf4\x1c\xc\xa7\x2c\xcc\xbe\x20\xbe\xc9\x66\x30\x64\xb5\x30\xf9\x82\x58\x16\x60\xc8\x6a\xa1\xf\x5\xd\xa9\x53\x4b\x3a\x61\xa1\x4f\x43\x42\xa1\xd5\x60\x38\x61\x61\xa0\x20\x15\x7\xc3\x71\xb\x93\x6f\x88\xbd\x19\x86\xb4\x16\x46\xd5\xd7\x2\xa\xcd\x5b\xd2\x61\xb\x6d\x28\x68\x48\xdd\x6\xc3\x51\xb\x6d\x1a\x12\xa\xed\x6\xc3\x51\xb\xa3\x9\x5\xd\xa9\x1f\x86\x83\x16\xe6\xbe\x2d\x2d\xb\x12\xe8\x1e\x1c\xb3\xd0\x86\x82\x86\xd4\x70\x30\x1c\xb3\xd0\xa5\x21\xa1\xd0\x71\x30\x1c\xb2\x30\xf7\x8a\xa0\x20\xa1\xee\xc2\x21\xb\xa3\x7\x5\xcb\x42\x4f\xc\x47\x2c\x4c\xbd\x22\xf6\x66\x9\x76\x1d\xe\x58\x98\xda\x1c\xec\xcd\x12\x6d\x30\x1c\xb0\xd0\xa4\x21\xa1\xd0\x75\x30\x3c\x6f\x61\xea\x1d\xb1\x2c\x48\x38\xc\x4f\x5b\xe8\xd2\x90\x50\x68\xdb\x92\x9e\xb6\x30\x7a\x50\xd0\x90\xfa\xe\x86\x67\x2d\xcc\xbc\x23\x28\x48\xc4\xc1\xf0\xac\x85\x51\xe8\x33\xa3\x0\xc3\x5\xb\x3d\x28\x58\x16\x5a\xb7\xa4\xe7\x2c\x34\x69\x48\x28\xb4\x1e\xc\xcf\x59\x18\x2d\x28\x68\x48\xbd\x7\xc3\x53\x16\x66\x5e\x12\xcb\x82\x4\xc5\xf0\x94\x85\xd1\x81\x82\x86\xd4\xbd\x25\x3d\x63\xa1\x47\x43\x42\xa1\xfb\x60\x78\xc2\xc2\xc4\xee\x60\x59\x90\xb8\x83\xe1\x9\xb\x3\x5\xe9\x80\xe1\x6b\xb\x13\x6f\x89\xbd\x59\x2\xbf\x30\xbf\xb4\xd0\x82\x82\x65\xc1\x60\x78\xc2\x42\x8b\x86\x84\x82\xc1\xf0\xb5\x85\x79\x63\xc1\xb2\x20\xb1\x6f\xca\x57\x16\xe6\xbd\x31\x2d\xb\x12\xfb\xaa\x7c\x61\xa1\x3\x5\xd\xc9\x60\x78\xc2\xc2\xbc\x37\x26\xa\x12\xfd\xb6\x7c\x6e\x61\x24\x97\xae\x21\xc1\x30\xc9\xc2\xb4\x6b\x82\x82\xc4\xbf\x30\x9f\x59\xe8\xd0\x90\x50\x30\x18\x9e\xb1\x30\xea\x53\xb0\x2c\x18\xc\xcf\x58\xe8\xd0\x90\x50\x80\xe1\x19\xb\xa3\x3e\x5\xd\x49\x4b\x7a\xc6\xc2\xb4\x7b\x62\x59\x90\x14\xaf\xd0\xf\x2d\x34\xa0\xa0\x21\x19\xc\x4f\x59\x18\x28\x48\x2f\xc\x1f\x59\x98\x35\x16\x2c\xb\x92\xe5\xee\x7c\x64\x61\xa0\x20\xcd\x6\xc3\x7\x16\xea\x37\x24\x14\xc\x86\xa7\x2c\xcc\xba\x28\x96\x5\xc9\x83\xe1\x7d\xb\xf5\x1b\x12\xa\x5a\xd2\x53\x16\x26\x8d\x5\xcb\x82\x64\xba\x42\xef\x59\x40\x41\x3a\xe\x86\xf7\x2c\x8c\x7c\x1f\x43\x43\x82\x61\x85\x85\x49\x2f\x4d\x14\x24\x57\xbb\x78\xc7\xc2\xc8\xf6\x19\x34\x24\x83\x61\x8d\x5\x14\xa4\xe7\x60\x78\x63\xa1\x7c\x43\x42\x1\x86\x27\x2d\x8c\xe2\x14\x2c\xb\x5a\xd2\x93\x16\xe6\xbc\x35\x7d\x93\x4d\xf2\xd\x86\x5f\x2c\x94\xa7\xa0\x21\x19\xc\x4f\x5a\x18\x28\x48\xd7\xc1\xf0\xb3\x85\x39\x57\xc5\xb2\x20\x19\x31\xfc\x6c\x61\xa0\x20\x6d\x5b\xd2\x4f\x16\xa6\x8c\x5\xd\x49\x72\xe\x86\xd7\x16\x50\x90\xce\x83\xe1\xb5\x85\xe2\xd\x9\x5\x18\x9e\xb5\x30\xe5\xae\x58\x16\x24\x6b\x4b\x7a\x65\x61\xa0\x20\x9d\x7\xc3\xbf\x16\x46\xe\xbc\x1a\x92\xc1\xb0\xda\xc2\x8c\xbb\x82\x82\x24\xc6\xf0\x8f\x5\xd\x49\x9a\xb7\xa4\x1f\x16\x66\xbc\x37\x51\x90\xcc\x83\xe1\xbb\x5\xd\x49\xda\xf\x86\xef\x16\x6\xa\xd2\x1d\xc3\xdf\x16\x6a\x37\x24\x14\xb4\xa4\xe7\x2d\x8c\xca\x14\x2c\xb\x6\xc3\xf3\x16\x26\xbc\x38\x51\x90\xec\x83\xe1\x2f\xb\x23\xf6\xd7\xa8\x21\xc9\x8e\x8b\x36\xc7\x2\xa\x92\xbf\x25\xfd\x69\xe1\xfa\x75\xd1\x90\x24\xff\x60\xf8\xd3\xc2\x40\x41\xc\x86\x29\x16\x34\x24\xa9\x80\xe1\xf\xb\x57\xef\xb\xa\x52\xa2\x25\xfd\x61\x61\xa0\x20\x6\xc3\xc\xb\x96\x5\xa9\x31\x18\x7e\xfb\x76\xf1\xe5\x89\x82\x14\xc1\x70\xd5\x82\x86\x24\x55\x5a\xd2\x45\xb\x28\x48\x99\xc1\xf0\xdb\xb7\x11\xf\xa8\x86\x24\x37\xdc\xbb\x6b\x16\x2\x53\x30\x16\x60\x38\x6a\xe1\x7f\x17\xee\x4c\xe0\x86\x64\x2c\x68\x49\x3b\x2d\x44\xa6\x60\x2c\x18\xc\x1b\x2d\x44\xa6\x60\x2c\x18\xc\x3b\x2d\x4\x5e\x16\x8c\x5\x18\x76\x5a\x88\x4c\xc1\x58\xd0\x92\x36\x5a\x8\xdd\x90\x8c\x5\x83\xe1\xc4\xff\xe0\x7f\xa\x52\x60\xc1\x60\xd8\x68\x21\x74\x43\x52\x91\x60\xd8\x67\x21\x36\x5\x16\xb4\xa4\x6d\x16\x82\x53\x50\x91\xc\x86\x5d\x16\x62\x2f\xb\xc6\x82\xc1\xb0\xcf\x42\xf0\xb1\xc0\x2\xc\xe6\x82\x8a\xa4\x25\xed\xde\x17\xfc\x17\x55\xa9\x37\x18\x4e\xfe\x77\x24\xdf\x69\x93\x72\x83\xa1\xe2\xf7\x17\x58\x30\x18\x76\x5a\xf0\x2f\xda\xa4\x1a\x86\x8a\x3f\x8f\xc4\x82\x96\xb4\xd5\x42\x60\xc\x2c\x18\xc\x7b\x2d\x84\x6d\x49\xd6\x5\x83\x61\xb7\x85\xa8\x18\x58\x80\xe1\x9c\x85\x2b\xbf\x7\xe3\xc1\x82\xd4\x69\x49\x97\x2c\xc4\x5c\x19\x58\x30\x18\xf6\x5b\x88\x89\x81\x5\x83\xe1\x6\xb\x21\x5b\x12\xb\x30\x9c\xb4\x70\xed\xea\x3c\x58\x90\x22\x2d\xa9\xe0\xef\xd9\x66\xc1\x60\x38\x69\xe1\xe2\xb7\xa6\xe2\x61\x60\xc1\x60\xb8\xc7\x42\x40\xc\xbe\xef\xc\xc3\x49\xb\x57\xdf\xa3\xf\x16\xa4\x42\x4b\x9a\x60\x21\x1c\x6\x16\xc\x86\x93\x16\xca\xfd\x7d\x67\x16\xc\x86\xb3\x16\x2e\xf\x86\x60\x18\x2c\xcf\x30\xdc\x66\x21\x58\x4b\x62\x41\x4b\x3a\x6b\x61\x42\xa9\x78\xb0\x20\xd9\x7\xc3\x5f\x16\x26\x5c\x9e\x50\x18\x2c\xc\x6\xc3\x8d\x16\x42\xad\xc\x2c\xc0\x70\xd6\xc2\x8c\xcb\x13\x9\x83\x92\xa4\x25\x9d\xb6\x30\xe3\xf2\x3c\x58\x90\xd4\x83\xe1\x6f\xb\xd5\x30\x28\x49\x6\xc3\x69\xb\xc5\x5a\x12\xb\x30\x9c\xb7\x30\x63\x30\xc4\xc1\xa0\x24\x69\x49\xe7\x2d\x4c\x79\x95\xc6\xc1\x60\x30\x18\xc\xe7\x2d\x4c\xb9\x3e\xf\x16\x24\xed\x60\xf8\xd7\xc2\x94\x5e\x11\x5\x83\x92\x4\xc3\x5\xb\xb5\x5a\x92\xc1\xa0\x25\x5d\xb0\x30\xe5\x5d\x1a\x5\x83\xc1\x60\x30\x5c\xb0\x50\xab\x25\x19\xc\x6\xc3\x5\xb\x73\xee\x4f\x10\xc\x6\x3\xc\x57\x2c\xcc\xb9\x3f\x30\x48\xca\x96\xf4\x93\x85\x39\x83\x21\xca\xca\xa0\x25\x19\xc\x17\x2c\x94\xc2\x60\x30\x18\xc\x57\x2c\x68\x49\xd2\x16\xc3\x2f\x16\x26\x15\x8b\x20\x18\xb4\x24\x2d\xe9\x82\x85\x39\xef\x52\x2d\x49\xf2\xd\x86\x5f\x2d\x4c\x7a\x97\xda\x9f\x25\xdd\x60\x78\x63\xa1\x56\x4b\x32\x19\x60\xb8\x60\x61\xd2\xf5\x81\x41\x92\xb5\xa4\xb7\x16\x66\xf5\xa\xfb\xb3\xe4\x1a\xc\xef\x58\x98\xf4\x2a\xb5\x32\x48\xae\xc1\xf0\x8e\x85\x62\x18\xb4\x24\x83\xe1\xbc\x85\x62\x2d\x9\x6\x18\xce\x5b\x98\x75\x7b\x60\x90\x44\x2d\xe9\x5d\xb\xb3\x6\x83\x95\x41\x12\xd\x86\xf7\x2d\xc0\x20\xfd\x6\xc3\x7\x16\x66\xd5\xa\xfb\xb3\xa4\xc1\xf0\x81\x85\x69\x6f\x52\x2b\x83\x64\x69\x49\x1f\x59\x98\x76\x79\x7c\xcb\x4d\x92\xc\x86\x8f\x2c\x54\x6b\x49\x30\x18\xc\xa7\x2d\x4c\xbb\x3c\x30\x48\xe\xc\x1f\x5b\xa8\xd6\x92\xac\xc\x5a\xd2\x59\xb\xf3\x5e\xa4\x30\x48\x86\xc1\xf0\x89\x85\x72\x18\xb4\x24\x83\xe1\xac\x85\x69\x2f\x52\x2b\x83\x24\xc0\xf0\x99\x85\x79\x77\x7\x6\x89\xdf\x92\x3e\xb5\x30\xaf\x61\x5b\x19\x24\xfc\x60\xf8\xd4\x2\xc\xd2\x68\x30\x7c\x6e\x41\x4b\x92\x3e\x18\xbe\xb0\x30\xef\x3d\xa\x83\x4\x6f\x49\x5f\x58\x98\x78\x75\xfc\xc8\xaa\xc4\x1e\xc\x5f\x59\x98\x88\xc1\xca\x20\xa1\x7\xc3\x97\x16\x26\x5e\x1d\x18\x24\x32\x86\x2f\x2d\xd4\x6b\x49\x56\x6\x2d\xe9\xa4\x85\x89\xaf\x51\x18\x24\xf0\x60\xf8\xda\x82\x96\x24\x3d\x6\xc3\x13\x16\x66\xbe\x46\x61\x90\xb0\x18\x9e\xb1\x30\xf3\xe6\xf8\x91\x55\x89\xda\x92\x9e\xb1\x30\xf3\xe6\x58\x19\x24\xea\x60\x78\xca\xc2\xcc\xc1\x0\x83\x4\x1d\xc\x4f\x59\xa8\xd8\x92\xac\xc\x30\x9c\xb2\x30\xf5\x2d\xa\x83\x84\x6c\x49\x4f\x5a\xd0\x92\xa4\xfc\x60\x78\xd2\xc2\xd4\x8b\x3\x83\x44\x1c\xc\xcf\x5a\xa8\x88\x41\x4b\x82\xe1\x94\x85\xa9\x17\xc7\xca\x20\xf1\x5a\xd2\xd3\x16\xe6\x36\xa\x18\x24\xdc\x60\x78\xde\xc2\xd4\x7b\x63\x65\x90\x70\x83\xe1\x79\xb\x30\x48\x6d\xc\x7\x2c\x68\x49\x52\xba\x25\x1d\xb1\x30\xf7\xde\xc0\x20\xb1\x6\xc3\x11\xb\x93\xb\x5\xc\x12\x6a\x30\x1c\xb2\x30\x17\x83\x95\x41\x42\x61\x38\x66\x61\xee\x3b\x14\x6\x89\xd4\x92\x8e\x59\xd0\x92\xa4\xee\x60\x38\x68\x61\xf2\xb5\x81\x41\xe2\xc\x86\x83\x16\xb4\x24\x29\x3b\x18\x8e\x5a\x98\x7c\x6d\x60\x90\x30\x18\xe\x5b\x98\xdc\x27\x60\x90\x28\x2d\xe9\xb0\x85\xd9\xb7\xc6\xca\x20\x41\x6\xc3\x71\xb\x30\x48\xcd\xc1\x70\xc2\x82\x96\x24\x25\x31\x9c\xb0\x30\xfb\xd6\xc0\x20\x21\x5a\xd2\x19\xb\xb3\xeb\x84\x96\x24\x11\x6\xc3\x19\xb\x30\x48\xc5\xc1\x70\xca\xc2\xf4\x3a\x1\x83\xdc\x3f\x19\xce\x59\x98\x7d\x69\xac\xc\x72\xff\x64\x38\x67\x61\xfa\xa5\x81\x41\x6e\xc7\x70\xd2\x82\x96\x24\xe5\x30\x9c\xb5\x30\xfd\xd2\xc0\x20\x37\xaf\xc\x67\x2d\x68\x49\xe5\xea\x72\xd7\x67\xfb\xcf\x33\x38\x6d\x61\xfa\xb\x14\x86\x3b\xdf\x89\x9d\x9f\xed\xe3\xaa\x85\xf9\x9f\x2b\x48\x4b\xea\x84\xe1\xe1\xd9\xbe\x7a\xb\x9f\xb7\x50\x16\x43\x9f\x95\x61\xff\x28\x8e\xf9\x6c\x1f\x97\x2d\xcc\xff\x5c\x30\x14\xa7\x10\xf4\xd9\x7e\x7f\x10\x17\x2c\xcc\x1f\xc\x56\x86\xea\x14\x82\x3e\xdb\xc7\x65\xb\xf3\x8d\xc3\x50\x79\x59\x88\xfb\x6c\xff\xbe\x77\x57\x2c\xd4\x6d\x49\x1d\x30\x3c\x3c\xdb\x99\x16\x16\x7c\x2c\x2b\x43\xe9\x86\x14\xf5\xd9\x3e\xae\x5b\xa8\xdb\x92\xaa\x63\xb8\xf3\x39\x7\x7c\xb6\x13\x2c\x2c\x18\xc\x56\x86\xda\xd\x29\x26\x86\xbf\x6e\xdd\x45\xb\x30\xa0\x50\xe2\xd9\x3e\x26\x58\x58\x40\xdc\xca\x50\x9d\x42\x40\xc\x33\x2c\xac\xf8\x54\x30\x14\x5e\x16\x82\x62\xf8\xf3\x91\x5c\xb6\xb0\xe0\xc6\xd8\x9f\xcb\x53\xa8\x69\xa1\x32\x86\xa2\x2b\x43\x80\xb9\x1b\xef\x35\xf3\x98\x61\xa1\x70\x4b\xaa\x89\x1\x85\x75\x16\x56\x7c\x30\x2b\x83\x86\x94\xd1\xc2\x92\x4f\x6\x3\xa\xbb\x9f\xcb\xc\xb\x2b\x3e\x9b\x95\x1\x85\x94\x16\x56\xbc\x3d\x61\xb0\x2c\x64\xb4\x50\xb9\x25\xd5\xc2\x80\xc2\x27\x8f\x66\x8e\x85\x25\x9f\xcf\xca\xa0\x21\x25\xb4\x50\xba\x25\xd5\xc1\x80\xc2\xe\xb\x4b\x3e\xa2\x95\xa1\xde\xf3\x8c\xfb\x62\x99\x67\x61\xc9\x67\x84\xc1\xb2\x90\xd0\xc2\x9a\xfb\x62\x65\x40\x21\xa1\x5\x18\x34\xa4\xd4\x3\x76\xa6\x85\xd2\x2d\x29\x3f\x6\x14\x36\x5a\x58\xf3\x49\xad\xc\x1a\x52\x42\xb\x6b\x3e\xaa\x6f\xb9\xa1\x90\xcf\x42\x6d\xc\xb9\x5b\x52\x84\x87\x38\x5e\x1a\x59\x58\xf4\x69\x61\xb0\x2c\xe4\xb3\xb0\xe6\xba\xd8\x9f\x51\xc8\x67\x61\xd1\x7\xb6\x3f\x5b\x16\xf2\x59\x58\xf4\x89\xed\xcf\x28\xa4\xb3\x50\x1c\x43\xce\x96\x64\x6f\xbe\xc7\x42\xf1\x96\x94\x11\x83\x65\xe1\x2e\xb\x8b\x6e\x8b\x95\x1\x85\xe5\xcf\x69\xb6\x85\x55\x9f\x1b\x6\xcb\x42\x3a\xb\xab\x6e\x8b\xfd\x19\x85\x74\x16\x56\x7d\x74\xfb\xb3\x86\xb4\xf6\xa5\x31\xdf\x42\xf5\x96\x94\x9\x3\xa\x37\x5b\x58\x75\x59\xac\xc\x19\x9f\x58\x96\x57\xc7\x1a\xb\xd5\x5b\x52\x1e\xc\x96\x85\x43\xaf\x8d\x15\x16\x96\x5d\x16\x2b\x3\xa\xd9\x2c\x2c\x7b\x2\x30\x58\x16\xd6\xdd\xac\x25\x16\x96\x3d\x2\xfb\x33\xa\xd9\x2c\x94\xc7\x30\x72\x9c\xae\x57\xc6\x91\x7b\xb5\xc8\x42\xf5\x96\x94\xe1\xc7\xf1\x51\x38\xf8\xb4\x16\x59\x58\x77\x57\xac\xc\x69\x1e\x53\xa2\x6f\xd1\x2f\xb5\xb0\xec\xae\x58\x19\x2c\xb\x8b\x1e\xd7\x2a\xb\xf5\x31\xc\x14\xaa\x50\xf8\x3e\x45\x97\x59\x58\xf7\x2c\x60\xb0\x2c\x2c\xb9\x51\xeb\x2c\xac\x7b\x18\xf6\x67\x14\x72\x59\x58\x78\x55\xec\xcf\xf6\xe6\x5\xf\x6c\xa1\x85\xfa\x2d\x29\xec\x5f\x1e\x43\xe1\xcc\x3\x5b\x69\x61\xdd\x55\xb1\x32\xc4\x7e\x36\xb9\xfe\x91\xc7\x8f\x39\xba\xd2\x42\xfd\x96\x14\xf4\x8f\x76\xa3\x70\xea\xe5\xb1\xd4\xc2\xc2\x67\x2\x3\xa\xb3\xe7\xe8\x52\xb\xd\x30\x44\x3b\x77\xcb\xc2\xf9\x8b\xb4\xd6\xc2\xc2\xc7\x62\x7f\x46\x61\xf2\x13\x5b\x6c\x61\xe1\x4d\xb1\x3f\xdb\x9b\xe7\xf6\x8b\xc5\x16\x56\xde\x14\x2b\x83\x65\x61\xea\x13\x5b\x6d\xa1\x1\x86\x38\xa7\x8f\xc2\xa5\x41\xba\xdc\x42\x83\x96\x14\xe5\xfc\x2d\xb\xd7\xde\x1e\xcb\x2d\xac\x7c\x3a\x30\xa0\x30\xf1\x91\xad\xb7\xb0\xf2\xa2\x58\x19\x34\xa4\x79\x6f\x8f\xf5\x16\x96\x5e\x14\x18\x50\x98\xf6\xc8\x36\x58\xe8\x80\xe1\xfe\x5b\xe0\x87\x53\x2f\x97\xca\x1d\x16\x56\x5e\x14\x2b\x83\x65\x61\xd6\xeb\x63\x87\x85\xa5\xf\xc9\xb7\xdc\x50\x98\x34\x49\xb7\x58\x58\xfa\xd2\xb4\x32\x58\x16\xe6\xbc\x3e\xb6\x58\x80\x1\x85\xf8\x63\x61\x93\x85\x16\x2d\xe9\xbe\xdb\x60\x6f\x9e\x72\x6b\x36\x59\x58\x7a\x4f\xba\x63\xb0\x2c\xcc\x79\x66\x9b\x2c\xac\x7d\x56\xbd\xf7\x67\x3f\x9c\x3a\x69\x94\xee\xb2\xb0\xf6\x9e\xb4\x5e\x19\x2c\xb\x93\xde\x1f\xdb\x2c\xac\x7d\x5c\x8d\xbf\xe5\x86\xc2\xac\x87\xb6\xcd\x42\x8f\x96\xb4\xff\x56\x58\x16\xa6\xbd\x3f\xf6\x59\x58\x7b\x4d\xba\x62\x40\x61\xde\x43\xdb\x67\xa1\x47\x4b\xda\x7c\x31\xec\xcd\x13\xef\xca\x46\xb\x8b\xaf\x49\x4b\xc\x96\x85\x89\x2f\x90\x9d\x16\x16\x3f\xb5\x86\xfb\x33\xa\x33\x67\xe9\x4e\xb\x8b\x5f\x99\xfd\x56\x6\xcb\xc2\xd4\x17\xc8\x56\xb\x30\xa0\x10\x77\x2c\x6c\xb6\xd0\xa3\x25\x6d\xba\x20\xf6\xe6\xc9\x97\x64\xaf\x85\xd5\xb7\xa4\x15\x6\xcb\xc2\xe4\xa7\xb6\xd9\xc2\xe2\x87\xd7\xa9\x25\xf9\xe1\xd4\xd9\x37\x64\xb3\x5\x18\x2c\xb\x51\xc7\xc2\x76\xb\xab\x9f\x5f\x97\x1f\x59\x45\x61\xfe\x63\xdb\x6e\x61\xf5\x1b\xb3\xc9\xca\x60\x59\x98\xff\x6\xd9\x6e\x61\xf9\xdb\xa4\x5\x6\x14\x16\x3c\xb6\xfd\x16\xba\xb4\xa4\xea\xbf\x2f\xb0\x5a\x43\xba\xc5\xc2\xea\x17\x4a\x7d\xc\x96\x85\x25\xaf\x90\x1b\x2c\x68\x49\x5\x28\xd4\x6b\x48\xf7\x58\x58\xfe\x1c\x8b\x63\xb0\x2c\xac\x79\x85\xdc\x61\xa1\xd\x86\x35\x9f\x13\x85\x45\xcf\xed\x16\xb\x2d\xfe\xeb\xfb\xaa\x3b\x63\x59\x58\xf5\xdc\xee\xb1\xb0\xfc\xbd\x52\x17\x3\xa\xcb\x9e\xdb\x3d\x16\xd6\x3f\xcd\xaa\x2b\x83\xbd\x79\xdd\x85\xb8\xc9\xc2\xfa\xc7\x59\x14\x83\x65\x61\xdd\x3b\xe4\x26\xb\x5a\x12\xa\xd1\xc6\xc2\x6d\x16\xd6\xb7\xa4\x8a\x18\x2c\xb\x2b\xdf\x21\xb7\x59\xe8\xf1\x53\xcd\x73\x3f\x29\xa\x4b\x1f\xdc\x6d\x16\x36\x3c\xd4\x6a\x2b\x83\xbd\x79\xed\x4d\xb8\xcf\x2\xc\x96\x85\x50\x63\xe1\x4e\xb\x5a\x52\x3e\xd9\x85\x1b\xd2\xad\x16\x36\x3c\xd8\x4a\x18\x2c\xb\xab\x5f\x22\x77\x5a\xd8\x30\x70\xeb\xb4\x24\x14\x96\x3f\xb9\x3b\x2d\xc0\x60\x59\x8\x34\x16\xee\xb5\xb0\xe3\x45\x53\x4\x3\xa\xeb\x9f\xdc\xbd\x16\x36\x3c\xde\x1a\x2b\x83\xbd\x79\xc3\xf9\xdf\x6b\x61\xc7\xf3\xad\x80\xc1\xb2\xb0\xe3\x2d\x72\xb3\x5\x2d\x29\xb\x85\xa4\xd\xe9\xc8\xa3\xbb\xdb\x42\x97\xdf\xb6\x78\x9\x83\x65\x61\xcb\x5b\xe4\x6e\xb\x5a\x12\xa\x51\x5e\x83\xb7\x5b\xd8\xf1\x94\x73\x63\xb0\x37\x6f\x3a\xf8\xdb\x2d\xc0\x60\x6f\xe\xd2\x8e\xef\xb7\xb0\xe5\x41\xe7\x5d\x19\xec\xcd\xdb\x4e\x3d\x80\x85\x2d\x4f\x3a\x2d\x6\xcb\xc2\xb6\x36\x10\xc0\xc2\x96\xc1\x90\xb5\x25\xa1\xb0\xef\xfd\x17\xc1\x2\xc\x96\x85\x8\x27\x1e\xc2\x82\x96\x84\x42\x80\x97\x5f\x8\xb\x6d\xfe\xd6\xdf\xc1\xf\x6b\x6f\xde\x7a\xdc\x31\x2c\x6c\x79\xe0\x51\x5a\xd2\xf3\x18\x2c\xb\x5b\x4f\x3b\x86\x85\x5e\x18\x9e\xfd\xb0\xbe\xc9\xb6\xb7\x5\x4\xb1\xb0\xe7\x99\xe7\xc2\x60\x59\xd8\x5c\x88\xa3\x58\xd8\x33\x8b\x33\xad\xc\x28\xec\x7e\xeb\x45\xb1\xb0\xe9\xb1\x27\xc2\x60\x59\xd8\x7d\xce\x61\x2c\xf4\x6a\x49\x5f\x7f\x5a\x14\xb6\x1f\x73\x1c\xb\x7b\x9e\x7c\x96\x95\xc1\xde\xbc\xff\x90\xe3\x58\x68\xd6\x92\x3e\xc7\x80\xc2\xd\x67\x1c\xc8\xc2\xa6\x91\x9c\x1\xc3\xa3\xcf\x71\x4\x9a\xfd\x81\x2c\xec\x7a\x11\xc5\xc7\x80\xc2\x2d\x7\x1c\xc9\xc2\x26\xc\x61\xf6\xe7\xf\xae\x5b\x88\xaf\x2f\x31\x85\xd3\xcf\x2f\x94\x85\x4d\x7\x10\x6\xc3\xbb\xfa\x1f\x51\xbf\xb0\xea\x14\x62\x59\xe8\xd6\x92\xde\x7e\xe6\x28\x4c\xf3\x52\xb8\x70\xb8\xb1\x2c\xec\x9a\xcc\xa1\x30\xfc\xf8\xd4\x8f\x7e\xe7\x10\x6b\xe8\xc7\xb2\xd0\xb0\x25\x45\x4c\x62\xa\x57\xde\x28\xc1\x2c\xec\x1a\xce\x30\xa0\x10\xde\xc2\xae\x73\x80\xa1\xe4\xb2\x70\xe9\x58\xa3\x59\xd8\x76\x10\xf\x77\xbe\x1e\x85\x6b\xa7\x1a\xce\x2\xc\x1a\xd2\x4d\xd3\x3e\x9e\x5\x2d\x9\x85\x7b\x8e\x34\x9e\x85\x6d\x83\x1\x6\xd\x29\xba\x85\x6d\x6f\x26\x2d\xa9\x16\x85\xab\x2f\xb7\x80\x16\x60\x40\xe1\x96\xe3\x8c\x68\x61\xdf\x89\xc0\x50\x67\x59\xb8\x7e\x98\x21\x2d\x6c\x3b\x12\x2b\x43\x1d\xa\xd7\xcf\x32\xa4\x85\x7d\x83\x1\x6\xd\x29\xb8\x5\x2d\x9\x85\xfd\x6f\xb5\xa0\x16\xf6\x4d\x6b\x18\x34\xa4\xd8\x16\xb4\x24\x14\xb6\xbf\xd2\xa2\x5a\xd8\x77\x32\x30\x14\xa0\x30\xe5\x10\xa3\x5a\x80\xc1\xb2\xb0\xbb\xe9\x86\xb5\xb0\xf1\x70\xac\xc\x28\xc4\xb6\xb0\x71\x68\xc3\xa0\x21\x85\xb6\xb0\xf1\x55\xd5\xbe\x25\xe5\xa6\x30\xeb\x5d\x16\xd8\x2\xc\x28\x6c\x3d\xbd\xc8\x16\xb4\x24\xcb\xc2\xce\x17\x59\x64\xb\x3b\xcf\xe8\x81\x42\xf3\x86\x14\xdc\xc2\xce\xd9\xdd\x17\x83\x86\x94\xc1\xc2\xce\x63\x6a\xbb\x32\x24\xa7\x30\xf1\x25\x16\xdb\xc2\xce\xf1\xdd\x15\x83\x86\x94\xc4\x82\x96\x84\xc2\xb6\x37\x58\x70\xb\x5b\x8f\xea\x81\x42\xe7\xb1\x10\xde\xc2\xce\xc1\xd0\xb0\x25\x65\x5f\x16\xa6\x1e\x59\x74\xb\x30\xa0\xb0\xeb\xc0\xc2\x5b\xd8\x3a\xc5\xbb\x61\xd0\x90\x72\x59\xd8\xfa\xee\x7a\xa0\xd0\x76\x2c\x24\xb0\xb0\xf7\xc4\x3a\x61\xc8\xde\x90\x66\x1f\x56\x2\xb\x5a\x12\xa\x5b\xde\x5b\x19\x2c\x6c\x3d\xb4\x36\x18\xd2\x53\x98\x7e\x52\x19\x2c\x68\x49\x96\x85\x1d\x7\x95\xc2\xc2\xde\x57\xd8\x3\x85\x96\x63\x21\x87\x5\x18\x34\xa4\xd\x5d\x36\x87\x85\xbd\x6f\xb1\x6\x2b\x43\x7a\xa\x2b\x5e\x58\x49\x2c\xec\x3d\xbb\xf2\x18\xf2\x53\x68\x3c\x17\x36\xd7\xdb\xea\x2d\x69\x14\xf8\xc\x8f\xb6\x16\x60\x40\xc1\xee\xac\x25\x69\x48\x7b\xde\x57\x69\x2c\x6c\x7e\x99\x15\xc6\x50\x84\x42\xcf\xef\x3b\xdf\x72\x84\x75\x31\x8c\x2a\x1f\x64\xf6\x11\xe5\xb1\xb0\x1b\xc3\x3\x85\x66\x83\x21\x91\x85\xdd\xa7\xf8\x40\xa1\xd7\x60\xc8\x64\x41\x4b\xb2\x2c\xac\x3c\xa2\x4c\x16\x76\xbf\xd3\xa\x62\xa8\x45\x61\xf2\xec\x4e\x65\x41\x4b\xd2\x90\x16\xbe\xae\x72\x59\xd8\xfd\x5a\x7b\xa0\xd0\x68\x30\xe4\xb2\xa0\x25\x69\x48\xeb\x30\x24\xb3\xb0\xfb\x34\x4b\x61\xa8\x48\x61\xe6\x9\x25\xb3\x0\x3\xa\xcb\x6\x43\x36\xb\xdb\x2b\x6f\x9d\x95\x61\x94\xa4\xd0\xe6\x77\xce\x47\x78\xbb\x3d\x50\x68\x82\x21\x9d\x85\xed\x67\x5a\xa4\x25\x15\x6d\x48\x33\xdf\x56\xf9\x2c\xc0\x60\x2c\xac\x39\xa0\x84\x16\xb4\x24\x63\x61\xc9\x1\x25\xb4\x60\x30\x18\xb\x4b\x30\x64\xb4\xb0\xfd\x1d\x97\x1f\x43\xe9\xb1\x30\xeb\x80\x32\x5a\xd8\xff\x92\x4b\xdf\x92\x6a\x8f\x85\x49\x7\x94\xd2\x82\x96\x64\x2c\x2c\x38\xa0\x9c\x16\xb4\x24\x63\x61\xfe\x1\xe5\xb4\x60\x30\x18\xb\xf3\x5b\x52\x52\xb\xfe\xbb\xaa\xb1\x30\xfd\x6d\x95\xd4\x82\x9f\xd1\x63\x61\xfa\xdb\x2a\xab\x5\x3f\xa3\xa7\x22\xcd\x3e\xa1\xb4\x16\xfc\x13\x37\x16\x26\x8f\xee\xb4\x16\xfc\x13\x37\x15\x69\xf2\xeb\x2a\xaf\x5\xbf\x8\x80\x85\xb9\xaf\xab\xc4\x16\xfc\xba\x24\x15\x69\xea\x11\x25\xb6\xe0\xb7\xd\xb3\x30\x75\x76\x67\xb6\xe0\x17\xac\xaa\x48\x33\xdf\x57\x99\x2d\xf8\x93\x86\x2c\xcc\x3c\xa3\xd4\x16\xfc\xe1\x67\x16\x26\x1e\x52\x6e\xb\x5b\x7\x43\xd6\x85\xa1\x95\x85\x2b\x87\x94\xdb\xc2\xd6\x73\x66\xa1\xf8\x60\x48\x6e\x61\xeb\x41\xe7\x2c\x49\x8d\xfe\x33\xd2\xc5\x37\x56\x76\xb\x3b\x4f\x9a\x85\xda\x18\xb2\x5b\xd8\x39\x18\x58\xa8\xdd\x92\xd2\x5b\xd8\x78\xd4\x2c\xd4\x1e\xc\xe9\x2d\x6c\x3c\x6b\x16\x6a\xf\x86\xfc\x16\xf6\xb5\xa4\x9c\xff\x21\xa9\x9f\x85\xb3\x18\xa\x58\xd8\x76\xd8\x2c\xd4\x6e\x49\x5\x2c\x6c\x1b\xc\x2c\xd4\x1e\xc\x15\x2c\xec\x3a\x6d\x16\x6a\xf\x6\x16\xaa\x5b\x68\xf6\x7d\xe7\xb\x47\x65\x5f\x60\x41\x4b\x2a\x63\xc1\x7f\x47\x62\x61\xca\x59\xf9\xfe\x42\x79\xb\x1d\x17\x86\x53\x83\x21\xbf\x85\x11\xf9\xf1\xb2\x90\x68\x30\xf8\x79\x24\x16\x60\xa8\x61\xc1\xcf\xa9\xb2\x30\xeb\xb8\xfc\xfb\x85\xf2\x16\x7a\x2e\xcf\x27\x6\x43\x72\xb\x5b\xdf\x79\x2c\xd4\x1e\xc\xfe\xbd\xf3\xca\x6d\x4c\x49\xca\x84\xc1\xef\xc1\x60\x41\x4b\x2a\x60\xc1\xef\x47\x52\x92\x26\x1e\x59\x6a\xb\xe3\x85\x5\x83\x61\xda\x60\xf0\xfb\x54\xcb\x57\xa4\xc6\x16\x8e\x1d\x9a\xdf\xb3\xdd\xc0\x42\xdf\x92\x74\x68\x98\xfb\xfb\xb\x1d\x2c\x18\xc\xb5\x2d\xf8\x23\x55\x6\xc3\xdc\x63\xf3\xf7\xda\x1a\x8c\x85\xce\x83\xe1\x0\x6\x7f\xc7\xb3\xc3\x58\xe8\x6c\xe1\xf9\x97\x98\xbf\xef\xdc\x61\x2c\x74\x2e\x49\xcf\xbf\xc5\xb2\x5a\xd8\x7d\xb6\xd9\x2d\x18\xc\x65\x2d\x6c\x7f\xcd\x3d\xb2\xdf\x88\xc6\x83\xe1\x59\xc\x39\x2d\x6c\x7f\xcb\x65\x1f\xb\x5a\x52\x59\xb\xc6\x82\x96\x34\xff\x4d\x96\xd2\x82\xb1\x0\xc3\x82\x57\x59\x46\xb\xfb\xf\xf5\x51\xe2\x46\x68\x49\xf5\x2c\x68\x48\x30\xac\x18\xec\x9\x2d\x68\x48\x5a\xd2\x92\xd7\x59\x42\xb\xc6\x2\xc\x4b\xde\x67\xf9\x2c\xa0\x0\xc3\x1a\xc\xe9\x2c\x68\x48\x56\x86\x45\xaf\xb4\x74\x16\xfc\xf0\x5\xc\x8b\xe\x32\x9b\x85\xed\x63\xe1\x51\xec\x4a\xf4\x6d\x49\x8f\x62\x16\x50\x80\x61\xd9\x59\x26\xb3\xa0\x21\x69\x49\xcb\xe\x33\x97\x5\xff\x6a\x1\x86\x75\x83\x21\x97\x5\xff\xdc\x5f\x4b\x5a\x77\x9e\xa9\x2c\xf8\x77\x9d\x30\x2c\xc4\x90\xc9\x82\xdf\x7c\x1\xc3\xca\x23\xcd\x64\x41\x43\xb2\x32\xac\x3c\xd3\x44\x16\xfc\x9e\x3c\x18\x96\xe\x86\x3c\x16\x34\x24\x2d\x69\xed\xb1\xe6\xb1\x30\x50\x80\x61\xe9\xb8\x4f\x63\x61\xf3\xd9\x3d\xca\x5f\xa\x2d\x29\xad\x5\xbf\x60\x1e\x86\xc5\x47\x9b\xc5\x2\xa\x5a\xd2\xea\xc3\x4d\x62\x41\x43\x82\x61\xf9\xe9\x26\xb1\xe0\xaf\x51\xc1\xb0\x7c\x30\xe4\xb0\xb0\xf7\xd0\x5a\x34\xa4\xce\x2b\xc3\x23\xb1\x5\x14\x60\xd8\x70\xc2\x29\x2c\xf8\x33\xce\x5a\xd2\x86\x33\xce\x60\xc1\x9f\x71\x86\x61\xc7\x21\x67\xb0\x30\x50\xd0\x92\x36\xc\x86\x4\x16\x34\x24\x18\xb6\xbc\xf2\xe2\x5b\xd8\x3a\xc5\xfb\x51\xd0\x92\x12\x59\x18\x28\xc0\xb0\xe5\xa8\xc3\x5b\xd8\x7a\x52\x8f\x8e\xb7\xa2\x29\x86\x47\x3a\xb\x28\x58\x19\x76\xd\x86\xe8\x16\x34\x24\x18\x76\x1d\x77\x70\xb\x3b\xc7\x42\x5f\xa\x5a\x52\x6\xb\xe3\xc6\x47\x3\x43\xb3\xc1\x10\xdb\xc2\xce\x23\xea\x4c\xa1\x69\x4b\x7a\x24\xb2\x80\x2\xc\x1b\xf\x3d\xb4\x85\x8d\xe7\xd3\x78\x59\xd0\x92\x12\x58\xd8\x78\x3c\xed\x29\x34\xc5\xf0\xc8\x62\x61\xdc\xf4\x4c\x60\xe8\x89\x21\xb0\x5\x14\xac\xc\x5b\x8f\x3e\xae\x5\xd\x9\x86\xbd\x67\x1f\xd7\xc2\x40\x41\x4b\xda\x7a\xfa\x61\x2d\xec\x3b\x17\x14\xac\xc\xa1\x2d\x6c\x3c\x15\xcb\x82\x96\x14\xda\xc2\x40\x1\x86\xcd\x37\x20\xa8\x5\xd\x49\x4b\xda\x3e\x18\x82\x5a\x18\x28\xc0\xc0\x82\x86\x4\xc3\x3d\x25\x29\xa4\x85\x7d\xc7\x81\x82\x95\xe1\x9f\xc1\x10\xd2\xc2\x40\x1\x86\xfd\x83\x21\xa2\x85\x6d\x63\xc1\xb2\xa0\x25\xbd\xba\x8\x1\x2d\xa0\x0\xc3\x2d\x83\x21\xa0\x5\xd\x49\x4b\xba\x65\x30\xc4\xb3\xb0\xed\xa5\x84\x2\xc\xc1\x2d\xc\x14\xb4\xa4\x5b\x4a\x52\x38\xb\x63\xe7\x9b\x40\x60\x88\x6b\x61\xd7\x19\xa0\x0\xc3\xaf\xf7\x21\x9a\x5\xd\xc9\xca\xc0\xc2\xd6\xb7\x11\xa\x30\xbc\xb9\x11\xb1\x2c\x68\x48\x5a\x12\xb\x5b\x5f\x45\x28\xc0\xf0\xce\x9d\x8\x65\x61\xd3\xc3\x47\x41\x4b\xa\x6f\x61\xd3\xb3\xb7\x2c\xc0\x10\xdd\x2\xa\x5a\x12\xb\x1a\x12\xc\xf7\x2f\xcf\x81\x2c\xc\x14\x60\x60\x61\xe3\x53\xd7\x90\xac\xc\xd1\x2d\xa0\x0\x3\xb\x3b\x1f\x39\xa\x5a\x52\x78\xb\x7b\x9e\xb8\x65\x1\x86\xf8\x16\x6\xa\x5a\x12\xb\x1a\x12\xc\x2c\x6c\x1e\xc3\x28\x68\x49\xf1\x2d\x68\x48\x30\xb0\xb0\xef\x51\xa3\xa0\x25\xc5\xb7\x80\x2\xc\x2c\x6c\x7c\xce\x96\x5\x18\xe2\x5b\xd8\x32\x16\x50\xb0\x32\x24\xb0\xb0\xe3\x8d\xa3\x21\xc1\x90\xc0\x2\xa\x5a\x12\xb\xdb\x5e\x37\x28\xc0\x90\xc1\xc2\xd8\xf2\x31\x45\x4b\xa\x6f\x61\xc7\xf3\x8d\x4d\x61\xe4\x99\x5d\xa5\x31\xdc\x6e\xa1\x7b\x43\x1a\xb9\xaa\xdc\x60\x21\xf5\xc3\x8d\x7b\xc3\xde\x79\x11\x3c\x60\xe8\x6a\xa1\x75\x43\x1a\x19\xd7\xfc\xc1\x42\xde\x27\x1b\x95\xc2\x87\xaf\x81\xd8\xa3\xa1\xee\xca\x70\xb3\x85\xc6\x14\x46\xd6\x55\xbf\x2c\x86\x7b\x2d\x6c\x78\xac\x51\x2b\xc7\x48\xd9\xea\x4a\xb7\xa4\x7b\x2d\xc\x14\x60\x60\x61\xd3\x58\x8\x7a\xa9\xbe\xfc\xe4\xa1\x31\x14\x6d\x49\x77\x5a\x40\x21\xdf\x3c\xab\x8c\xe1\x4e\xb\x1a\x52\x5a\xc\x83\x85\x64\x2f\x97\xc4\x14\x60\x68\x65\x61\x74\xa5\xf0\xe4\x4b\xc0\xfe\xdc\xc6\xc2\xd8\xf0\xd9\x72\x97\x6d\xfb\x73\x13\xb\xeb\x9f\x65\x76\xa\xf6\xe7\x2e\x16\xda\x36\xa4\x91\xff\x23\x14\x6d\x49\x77\x59\x58\xfe\x56\x29\x40\xc1\xca\xd0\xc2\x82\x86\x64\x65\x60\x61\xd3\x2b\xe5\x51\xe4\xfa\xc0\x50\xdd\xc2\xf2\x87\x98\xf0\x87\x53\xad\xc\x3d\x2d\xac\x7e\x86\x25\x96\x5\x18\x3a\x58\xe8\x4a\xe1\xd4\x38\xb4\x3f\x57\xb6\xd0\xb5\x21\x9d\xfc\xdc\x56\x86\xc2\x16\x46\x4f\xa\x67\x3f\xb7\x6f\xb9\xd5\xb5\xb0\xfa\xe9\x15\xa3\x60\x65\xa8\x6b\x61\x35\x85\x42\x7b\x33\xc\xc5\x2d\x8c\x9e\x14\x2e\xbd\x2\xac\xc\x25\x2d\x34\x6d\x48\x17\x3f\x36\xc\x15\x2d\x8c\x96\x14\xae\x7e\x6c\x2d\xa9\xa0\x85\xa6\xd\x69\x54\xfd\x60\x95\x30\x6c\xb6\xb0\x78\x9c\x96\x5c\x16\x60\xa8\x69\x61\xa0\x60\x65\x60\x61\xc3\x23\x2b\xba\x2c\xc0\x50\xd0\x2\xa\x5a\x12\xb\x9d\x1b\xd2\xa8\xfe\x1\xab\x60\xd8\x69\x61\xed\x58\x28\xbd\x2c\x68\x49\xc5\x2c\x8c\xc5\x9f\xa4\xfe\x15\x81\xa1\x88\x85\x96\x14\x26\x7f\xea\xd0\x18\x6\xb\x21\x5e\x1b\x3d\x28\x58\x19\x6a\x58\x58\xfa\xa0\x1a\x2c\xb\x30\x94\xb1\xb0\x74\x2c\xb4\xa1\x60\x65\x28\x60\x41\x43\x82\x81\x85\xd\xd3\xb3\x13\x5\x2d\x29\xbb\x85\xa5\xef\x8b\x47\xaf\x7b\x1\x43\x6e\xb\x2b\x9f\x50\xa3\x65\x21\x1\x86\xc4\x2d\x69\x8f\x5\x14\xac\xc\x2c\x68\x48\xed\x30\xc\x16\x5c\x8b\x7d\x37\xc2\xca\x90\xd5\xc2\xca\xb1\xd0\xb0\x21\xc1\x90\xd7\x2\xa\xf6\x67\x16\x96\xbf\x25\xc2\xde\x88\xb6\x7f\x98\x31\x33\x86\xf5\x16\x56\x3e\x97\x47\x5b\xa\xf6\xe7\x8c\x16\x6\xa\x56\x6\x16\x9a\x36\xa4\x4d\xd\xc1\xca\x90\xcc\xc2\xc2\x67\xd2\x9c\x82\x95\x21\x9b\x5\xd\xc9\xca\xc0\xc2\xea\xb7\x3\xa\x30\x64\xb2\xd0\x90\xc2\xd6\x6e\x60\x7f\xce\x63\x61\xb4\xbb\x5\x9b\x6b\xb2\xfd\x39\x8b\x85\x75\xf\xa3\xf1\x37\xd9\xec\xcf\x29\x2d\x8c\x76\x57\x60\xdc\x70\x80\x5a\x52\x2\xb\xfd\x28\xdc\xf0\x22\xb4\x32\x64\xb0\xd0\xaf\x21\xdd\xd2\x9\xac\xc\x9\x2c\xc\x14\x60\xc8\x84\x61\x9d\x85\x7e\xff\xdc\x77\xdc\x76\x86\x5a\x52\x68\xb\xeb\x5e\x8\xf6\x66\x18\x72\x59\x18\xdd\xe\xfe\xc6\x36\x60\x7f\xe\x6d\xa1\x5d\x43\xba\xb5\x18\x5b\x19\x22\x5b\x18\xdd\x4e\xfd\xde\xb7\x1f\xc\x71\x2d\xa0\x60\x65\x48\xd7\x92\xd6\x58\x58\xf6\x26\xb0\x2c\xc0\x90\xcc\xc2\x40\x41\x4b\x4a\xd7\x92\x96\x58\x58\xf5\xd1\xed\xcd\x30\x24\xb3\xd0\x8d\x42\x90\xa\xa0\x25\x5\xb4\xd0\xad\x21\x8d\x30\x67\x9\x43\x30\xb\xab\xc6\x82\x65\x1\x86\x6c\x16\x6\xa\x56\x86\x8c\x2b\xc3\x7c\xb\xdd\xfe\x1a\x4d\xa4\xf7\x1d\xc\xa1\x2c\x2c\xfa\xc4\x28\x68\x49\xe9\x2c\x68\x48\x30\x24\xc5\x30\xdb\xc2\xa2\xbb\x81\x82\x96\x94\xcd\x42\xb3\x86\x14\xf0\x70\x61\x88\x62\x61\xf4\x3a\xdf\x88\x43\x3f\x34\x86\xd1\xc7\xc2\x1a\xf7\x28\x58\x19\xf2\x59\x18\xad\xe\x37\xea\xc4\x87\x21\x80\x5\x14\xb4\xa4\xc4\x2b\xc3\x4c\xb\x1a\x12\xc\x99\x31\xcc\xb4\x30\x50\x80\x21\xf1\x83\x9b\x68\x61\xd\x78\xd\xc9\xca\x90\xce\x2\xa\x30\xe4\x7e\x76\xf3\x2c\xc\x14\xb4\xa4\xd4\x4f\x6f\x9a\x85\x25\x9f\xcf\xb2\x60\x65\x48\x68\x61\xa0\xa0\x25\xe5\x7e\x80\xb3\x2c\x68\x48\x30\x64\xc7\x30\xc9\xc2\x92\xdb\x81\x82\xfd\x39\xa1\x85\xd1\xe9\x28\xb3\xfc\xb2\x5c\xfb\xf3\x1d\x16\x56\x7c\x30\xcb\x82\xfd\x39\xa1\x85\x56\x14\x72\xfd\xa5\x19\x18\x36\x5b\xe8\xd4\x90\x72\xfd\x9d\x56\x2b\xc3\x66\xb\x2b\x3e\x14\xa\x56\x86\x8c\x16\x46\xa3\x33\xcc\xf5\x17\x8b\xad\xc\x9b\x2d\xa0\x0\x43\x89\xc7\x79\xdd\xc2\x82\x49\x67\x6f\xb6\x3f\xa7\xb4\x30\xfa\x1c\x5f\x46\xa\xf6\xe7\x7d\x16\x16\x7c\x1a\xdf\x64\xb3\x3f\x67\xb4\xd0\xa9\x21\xe5\xa4\x60\x65\xd8\x65\x61\xf4\x39\xb9\x9c\xd\x9\x86\x5d\x16\x1a\x35\xa4\xbc\x14\xac\xc\x5b\x2c\x8c\x3e\xc7\x36\x5e\x5e\x60\x28\x8d\xe1\x9a\x5\x14\xb4\xa4\x3a\x8f\xf6\x92\x85\xf9\xa2\xed\xcd\x30\xe4\xb4\x30\xda\x9c\x58\xe6\x65\x21\x7e\x4b\xa\xf3\x87\x50\xcf\x5b\x98\x7f\x41\xec\xcd\x56\x86\x94\x16\xfa\x50\x48\xdf\x90\x60\x58\x6c\xa1\x4f\x43\x2a\x41\xc1\xca\xb0\xce\xc2\x74\xca\x96\x5\x18\x92\x5a\x18\x28\x68\x49\xa5\x9e\xf2\x69\xb\xa3\xcd\x41\x8d\x97\x17\x18\x3a\x60\x38\x6b\x61\xfa\x57\x8e\x82\x96\x94\xd4\x42\x9b\x86\x54\x89\x2\xc\x2b\x2c\xcc\x1e\xb\x96\x5\x18\x6e\xc7\x70\xce\x2\xa\x56\x86\x7a\x4f\xfb\x9c\x85\xd1\xe5\x80\xc6\xcb\xb\xc\x5d\x30\x9c\xb2\x30\xfb\x4b\x46\x41\x4b\xa\xf0\xc0\x4f\x59\x18\x4d\x4e\xa7\x5e\x43\x82\x61\xb2\x5\x14\x60\xa8\xf8\xcc\x4f\x58\xd0\x90\xac\xc\x25\x31\x9c\xb0\x30\x50\x80\xa1\xe2\x63\x3f\x6e\x61\x32\x5c\x14\xb4\xa4\x20\xf\xfe\xb0\x85\xc9\x14\x2c\xb\x30\x44\xc1\x70\xd8\xc2\x40\x41\x4b\xaa\xf9\xec\x8f\x5a\xd0\x90\x60\xa8\x8a\xe1\xa8\x85\x81\x2\xc\x45\x1f\xff\x41\xb\x1a\x92\x95\xa1\x2c\x86\x63\x16\xe6\xde\x11\x14\x60\x88\x74\x2\xc7\x2c\x8c\x1e\x67\x31\x5e\x5a\xc4\xca\x70\xc1\xc2\xdc\x2f\xd0\xb2\x0\x43\xa8\x43\x38\x62\x1\x5\x18\x2a\x1f\xc3\x11\xb\x3d\x1a\x52\x8f\x65\xc1\xfe\x7c\xc9\xc2\xd4\x4b\x82\x2\xc\xd1\x4e\xe2\x80\x85\x31\xf7\xff\xd7\xdb\x48\x4b\x8a\x85\xe1\x79\xb\x28\xc0\x50\xfb\x30\x9e\xb6\x30\x15\x69\xd8\x3\xe8\xd5\x90\xac\xc\xe7\x2c\x8c\xe\xcf\xbf\x1f\x5\x2b\xc3\x71\xb\x33\xbf\x2a\xdf\x64\x83\x21\x22\x86\x27\x2d\xf4\x68\x48\x2d\x29\x58\x19\xe\x5a\x18\x1d\x1e\x7d\xc7\x86\x4\xc3\x51\xb\x33\x6f\x9\xa\x5a\x52\x4c\xc\xcf\x59\x18\xd\x9e\x7b\x5f\xa\x56\x86\x3\x16\x3a\x50\xe8\xba\x2c\xc4\x6f\x49\xdb\x30\x3c\x63\xa1\x45\x43\x6a\x4d\xc1\xca\xf0\xac\x85\xd1\xe0\x91\x77\x6e\x48\xd1\x31\x4\xb2\x30\xf1\x9a\x58\x16\xac\xc\x99\x3b\x52\x7\xa\xdd\x1b\x52\xe4\xc3\x89\xb4\x3b\xf\x14\xb4\xa4\x16\x67\xf3\xa5\x85\x89\x2c\x2d\xb\x30\x44\x7e\x4d\x7d\x69\x61\xa0\x0\x43\x8f\xb3\xf9\xca\x42\x83\x86\x84\x42\xdc\x23\x8a\xf4\xb3\x79\xf3\xbe\x16\xcb\x2\xc\xc1\x5f\x53\x5f\x58\x68\xd0\x90\x50\x88\x7b\x4a\x91\xfe\x2d\xcf\x3c\x97\x96\x5\x18\xa2\xbf\xa6\x3e\xb5\x80\x82\x96\xd4\xe8\x6c\x3e\xb5\x30\x2a\x3e\x61\xd\x29\xc9\x51\x85\xfa\x9d\x30\xd3\xbe\x18\x14\x60\x48\x70\x36\x9f\x59\x18\xf3\xfe\x4f\x34\x24\x2b\x43\xf8\xd7\xd4\x27\x16\x50\x80\xa1\xd5\xc4\xfe\xd8\xc2\xb4\x8b\x82\x82\x96\x94\xe2\x6c\x3e\xb6\x30\xa\x3d\x59\xcb\x42\xb2\x23\x8b\xf5\xb7\x48\x66\x7d\x35\x28\x68\x49\x49\xce\xe6\x23\xb\x1a\x12\xc\xdd\x5e\x53\x1f\x59\x18\x28\xc0\xd0\xec\x6c\x3e\xb0\xa0\x21\x59\x19\xda\xbd\xa6\x3e\xb0\x30\x50\x80\xa1\xdb\xc4\x7e\xdf\x42\x79\xa\x1a\x52\xdc\x96\x34\x5e\x22\x59\x98\x75\x53\x2c\xb\x30\x24\x9a\xd8\xef\x5a\x18\x28\xc8\x4d\xe7\x77\xe3\xd9\xbc\x67\x61\xd2\x97\x63\x59\xb0\x32\xa4\x7a\x4d\xbd\x63\x1\x5\xb9\xed\x8\xef\x3c\x9b\x77\x2c\x68\x48\x72\xd7\x19\x8e\x97\x50\x16\x26\x5d\x15\x14\x60\x48\x76\x36\x6f\x2d\x8c\xda\x14\x34\xa4\xb8\x2d\xe9\xe6\xd7\xd4\x1b\xb\x23\xe1\x33\x44\xa1\x4\x86\xbb\x27\xf6\xaf\x16\xe6\x7c\x3d\xbe\xc9\x6\x43\xbe\xd7\xd4\xaf\x16\x8a\x37\x24\x14\xe2\x9e\xe5\x78\x89\x65\x61\xce\x5d\xb1\x2c\xc0\x90\xf0\x35\xf5\xb3\x85\xea\xd\x9\x85\xb0\xc7\x19\x60\x62\xff\x6c\x61\xa0\x20\xf7\x1c\x68\x80\xb3\xf9\xc9\xc2\x14\x9b\xf6\x66\x2d\x29\xe7\x6b\xea\x27\xb\x23\xc9\x83\x43\xa1\x1a\x86\xf1\x12\xcc\x42\x6d\xa\x1a\x52\xdc\x53\x8d\xf1\x9a\x7a\x65\xa1\x78\x43\x42\x21\xec\xb1\x6\x99\xd8\xaf\x2c\x8c\xd2\x14\x34\xa4\xb8\x7\x1b\xe4\x35\xf5\xaf\x85\x19\x97\x5\x5\x2d\x29\xef\xc4\xfe\xd7\xc2\x88\xfd\xc0\x34\xa4\xaa\x18\xc2\xbc\xa6\xfe\xb1\x30\xe3\x2b\x42\x1\x86\xc4\x13\xfb\x1f\xb\x13\x6e\x8b\xbd\xd9\xca\x90\xb9\xbc\xfe\xb0\x30\xe1\x4b\xb2\x2c\xc0\x90\xfa\x35\xf5\xc3\xc2\x98\xf1\x3f\x85\x82\x96\x94\x78\x62\x7f\xb7\x30\xe1\xba\x58\x16\x60\xc8\xfd\x9a\xfa\x6e\x61\xa0\x20\xfb\x5b\x52\xac\x89\xfd\xb7\x85\xeb\x5f\x93\x65\x1\x86\xec\xaf\xa9\xbf\x2d\xc\x14\x64\xff\x41\x7\x9b\xd8\x93\x2c\x68\x48\x56\x86\xf4\x47\xf3\x97\x85\xcb\xef\x4e\x14\x60\xc8\x3f\xb1\xa7\x58\xf0\x4d\x36\x2d\xa9\x40\x79\xfd\xcb\xc2\xa8\x4a\xc1\xb2\x10\x17\x43\xbc\xd7\xd4\x4\xb\x28\x68\x49\x25\x26\xf6\x9f\x16\x2e\x5e\x19\xcb\x2\xc\x25\x5e\x53\xd7\x2d\xa0\x0\x43\x8d\x89\xfd\xa7\x85\x4b\x77\x46\x43\xb2\x32\x14\x39\x9a\xab\x16\x50\x80\xa1\xca\xc4\xbe\x6a\x41\x43\xd2\x92\xaa\x1c\xcd\x45\xb\x28\xc0\x50\x66\x62\xff\x61\xe1\x7f\xff\x45\x41\xf6\x9d\x7d\xd8\xf2\x7a\xc9\x82\x65\xc1\xca\x50\xe8\x35\x75\xc5\x2\xa\x30\x54\x9a\xd8\x57\x2c\x68\x48\x5a\x52\xa5\xa3\xb9\x60\x1\x5\x18\x4a\x4d\xec\x3f\x2c\xfc\xa7\x1a\x5\xd\x29\x6c\x4b\xa\x7d\x34\xa7\x2d\x58\x16\xe4\xf8\x25\x8\x3d\xb1\xcf\x5a\x88\x4b\x41\x43\x8a\x8b\x21\xf6\xd1\x9c\xb5\x60\x59\x90\xc3\xf7\x20\xf8\xc4\x3e\x69\x1\x5\x39\x7c\x13\xa2\x97\xd7\x73\x16\x2c\xb\x72\xfc\x2a\x8c\x97\x82\x16\x50\x90\xe3\x97\x21\xfc\xc4\x3e\x63\xc1\xde\x2c\xc7\x5b\xd2\x78\xa9\x68\xc1\xb2\x20\x87\xef\x43\x82\x89\x7d\xc2\x82\x6f\xb2\xc9\xe1\x1b\x91\xe1\x68\x8e\x5b\xb0\x2c\xc8\xf1\x2b\x31\x5e\xa\x5a\xb0\x2c\xc8\xf1\x4b\x91\xe2\x68\xe\x5b\xb0\x2c\xc8\xe1\x5b\x91\x63\x62\x1f\xb5\x60\x59\x90\xc3\xf7\x22\xc9\xd1\x1c\xb4\x80\x82\x1c\xbe\x19\x59\x8e\xe6\x98\x5\x7b\xb3\x1c\xbf\x1a\xe3\xa5\xa0\x5\x7b\xb3\x1c\xbf\x1c\x69\x8e\xe6\x90\x5\x7b\xb3\x1c\xbe\x1d\x79\x26\xf6\x11\xb\x96\x5\x39\x7c\x3f\x12\x1d\xcd\x1\xb\x96\x5\x39\x7e\x41\xc6\x4b\x41\xb\x96\x5\x39\x7e\x45\x32\x1d\xcd\xf3\x16\x2c\xb\x72\x18\x43\xaa\xa3\x29\x60\x41\x43\xa\xbb\x32\xe4\x3a\x9a\xfc\x16\x50\x8\x8b\x21\xd9\xd1\xe4\xb7\xa0\x21\x85\x6d\x49\xe3\x85\x5\x14\x60\x48\x78\x34\xd9\x2d\x68\x48\x61\x5b\x52\xba\xa3\xc9\x6e\xc1\x58\x88\x8a\x21\xdf\x5b\x2a\xb9\x5\x63\x21\x2a\x86\x84\x27\x93\xdc\x82\xb1\x10\x75\x65\x18\x2f\x2c\x18\xb\xf2\x7\x86\x8c\x2f\xa9\xdc\x16\x8c\x85\xa0\xb7\x2a\xe5\x4b\x2a\xb5\x5\x63\x41\x58\x60\x41\x58\x50\x91\x84\x5\x16\x84\x5\x15\x49\x58\x60\x41\x58\x50\x91\x84\x5\x16\x84\x5\x15\x49\x58\x60\x41\x58\x60\x41\x58\xb0\x2e\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xf4\xcb\x6f\xbf\xb3\x20\xc2\x82\x8\xb\x22\x2c\x88\x7c\x78\xc1\x59\x10\x61\x41\xe4\x55\x45\x62\x41\x84\x5\x91\x9f\xee\x37\xb\x22\x2c\x88\xb0\x20\xf2\x66\x5d\x60\x41\xe4\xfb\xf5\x66\x41\xe4\xaf\xb1\xc0\x82\x8\xb\x22\x3f\xdd\x6e\x16\xc4\x58\xf8\x9d\x5\x91\x57\x97\x9b\x5\x31\x16\x58\x10\x79\x7d\xb7\x59\x10\x63\x81\x5\x91\xd7\x57\x9b\x5\x31\x16\x58\x10\x79\x45\x81\x5\xd1\x90\x58\x10\xf9\xe9\x5e\xb3\x20\x28\xb0\x20\x96\x5\x16\x44\xde\xde\x6a\x16\x4\x5\x16\x44\x43\x62\x41\xe4\xed\x9d\x66\x41\x8c\x5\x16\xc4\x58\x60\x41\xe4\xed\x8d\x66\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x44\x3e\xa0\xc0\x82\x68\x48\x2c\x88\xb1\xc0\x82\x18\xb\x2c\x88\x7c\x78\x99\x59\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\xe1\x85\x5\x91\x4f\x6f\x32\xb\x62\x2c\xb0\x20\xc6\x2\xb\x62\x2c\xb0\x20\x28\xb0\x20\xf2\xf9\x35\x66\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\xe4\x89\xb1\xc0\x82\xa0\xc0\x82\x68\x48\x2c\x88\xb1\xc0\x82\x18\xb\x2c\x8\xa\x2c\x88\x3c\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x91\x3\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x39\x3a\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x39\x79\x61\x59\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x91\xb\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x99\x70\x47\x59\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x99\x34\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x16\x8c\x85\xdf\x59\x60\x41\x56\xdc\x49\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\xc1\x9d\x30\x16\x58\x60\x1\x5\x16\x58\x90\x55\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x60\x41\x43\x62\x81\x5\x63\x81\x5\x16\x8c\x5\x16\x58\x40\xe1\x85\x5\x16\x64\xd3\xfd\x63\x41\x8c\x5\x16\xc4\x58\x38\x63\x41\xa4\x38\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\x44\xf6\x8f\x5\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\xe4\xd6\x86\xc4\x82\x18\xb\x2c\x88\xb1\xc0\x82\xa0\xf0\xee\x17\xf0\xbf\xff\x3a\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\xe9\xb3\xaf\xe1\xdb\x70\x10\x62\x2c\xb0\x20\xc6\x2\xb\x82\xc2\x1b\xb\xdf\x2c\xc\xa2\x21\xb1\x20\xc6\x2\xb\x62\x2c\xbc\xb1\xf0\x62\x61\x10\x63\x81\x5\x41\xe1\xb5\x5\x25\x49\x34\x24\x16\xc4\x58\x78\x6d\x41\x49\x12\x63\xe1\xbb\x5\x83\x41\x50\xf8\xdb\x82\xc1\x20\x1a\x12\xb\x62\x2c\xfc\x64\x41\x49\x12\x63\xe1\x6f\xb\x6\x83\xa0\xf0\xdd\x82\xc1\x20\xdd\x1b\xd2\xf\xb\x6\x83\xb4\x1f\xb\x3f\x2c\x18\xc\xd2\x7d\x2c\xfc\xb0\x0\x83\x74\xa7\xf0\x8f\x5\x2d\x49\x7a\x37\xa4\x57\x16\xc\x6\xe9\x4d\xe1\x5f\xb\x30\x48\xeb\x86\xf4\xda\x2\xc\xd2\x9a\xc2\x6b\xb\x56\x6\xe9\x4c\xe1\x27\xb\x26\x83\x74\xdd\x15\xde\x58\x80\x41\xfa\x52\xf8\xc5\x82\x9e\x24\x5d\x25\xbc\xb5\x60\x36\x74\x6f\xcd\x7d\xf3\x7f\xa\x4a\xdc\x0\xab\x4b\xde\x55\x0\x0\x0\x0\x49\x45\x4e\x44\xae\x42\x60\x82"
+"HTTP/1.1 200 OK\r\nServer: FlashBIOS/2.6\r\nContent-Type: image/png\r\nContent-Length: 9525\r\n\r\n\x89\x50\x4e\x47\xd\xa\x1a\xa\x0\x0\x0\xd\x49\x48\x44\x52\x0\x0\x6\x16\x0\x0\x4\xb8\x4\x0\x0\x0\x0\x1b\xc3\x40\x28\x0\x0\x24\xfc\x49\x44\x41\x54\x78\xda\xed\xdd\x9\x62\xdc\xb8\x11\x5\x50\xcd\xd\xa6\xef\x7f\xc7\x20\x27\x88\x33\x8b\x3d\x23\x5b\x5b\x93\x4\xc0\x5a\xde\x3f\x40\xa2\x26\xf0\x58\xbf\x46\xb2\xf4\xdb\xb7\x97\xfd\x19\x2f\x52\x23\xbf\xfd\x5e\xe9\xc3\x7c\x3\x41\x70\xb8\xc3\xc2\xb7\xff\xba\x3d\xd5\xf2\x60\x1\x5\x29\x35\x1a\xf6\x5a\xd0\x8f\x8c\x6\x16\x50\x30\x19\x58\x40\x1\x6\x16\xac\xa\x30\xb0\x60\x2a\xc0\xc0\x82\xb1\x60\x7f\x66\xc1\x58\x30\x18\x58\x40\x41\x2a\xc\x86\x4d\x16\x34\x24\x18\x58\x30\x16\xb4\x24\x16\x8c\x5\x83\x81\x5\x14\xc\x6\x16\x34\x24\x83\x81\x5\x63\x41\x92\x63\xd8\x61\xc1\x58\xd0\x92\x58\x40\xc1\x60\x60\x41\x43\x32\x18\x58\x30\x16\x60\x60\xc1\x58\x90\xcc\x2d\x69\xb5\x5\x14\xc\x6\x16\x34\x24\x83\x81\x5\x63\x1\x6\x16\x8c\x5\xc9\xdb\x92\xd6\x5a\x30\x16\xc\x6\x16\x50\x30\x18\x58\xd0\x90\x24\x27\x86\x95\x16\x8c\x5\x2d\x89\x5\x63\xc1\x60\x60\x1\x5\xc9\x3a\x18\xd6\x59\xd0\x90\x60\x60\xc1\x58\x90\x8c\x2d\x69\x99\x5\x63\xc1\x60\x60\x1\x5\x49\x39\x18\x56\x59\xd0\x90\x24\x1b\x86\x45\x16\x8c\x5\x49\xd7\x92\x16\x59\x30\x16\x24\xdd\x60\x58\x63\x1\x5\xc9\x37\x18\x96\x58\xd0\x90\x24\x21\x86\x25\x16\x8c\x5\x49\xd8\x92\x56\x58\x30\x16\x24\xe3\x60\x58\x61\xc1\x58\x90\x8c\x83\x61\x81\x5\x14\x24\x25\x86\xf9\x16\x34\x24\xc9\xd9\x92\xe6\x5b\x30\x16\x24\xe7\x60\x98\x6e\xc1\x58\x90\xa4\x83\x61\xb6\x5\x14\x24\x2b\x86\xd9\x16\x34\x24\xc9\xda\x92\x26\x5b\x30\x16\x24\xed\x60\x98\x6c\xc1\x58\x90\xb4\x83\x61\xae\x5\x14\x24\x2f\x86\xa9\x16\x34\x24\x49\xdc\x92\xa6\x5a\x30\x16\x24\xf1\x60\x98\x69\xc1\x58\x90\xcc\x83\x61\xa2\x5\x14\x24\x35\x86\x89\x16\x34\x24\x49\xdd\x92\xe6\x59\x30\x16\x24\xf7\x60\x98\x67\xc1\x58\x90\xdc\x83\x61\x9a\x5\x14\x24\xf9\x60\x98\x65\x41\x43\x92\xec\x18\x66\x59\x30\x16\x24\x7b\x4b\x9a\x64\xc1\x58\x90\xf4\x83\x61\x92\x5\x63\x41\xd2\xf\x86\x39\x16\x50\x90\xfc\x18\xa6\x58\xd0\x90\xa4\x40\x4b\x9a\x62\xc1\x58\x90\x2\x83\x61\x86\x5\x63\x41\x2a\xc\x86\x9\x16\x50\x90\x12\x18\x26\x58\xd0\x90\xa4\x44\x4b\xba\x6e\xc1\x58\x90\x1a\x83\xe1\xba\x5\x63\x41\x6a\xc\x86\xcb\x16\x50\x90\x22\x18\xae\x5a\xd0\x90\xa4\x4a\x4b\xba\x6a\xc1\x58\x90\x2a\x83\xe1\xa2\x5\x63\x41\xca\xc\x86\x6b\x16\x16\x50\x88\xfb\x9f\x19\xb8\x2f\x7e\xc8\xd7\x2c\x8c\x46\x14\xd4\xc1\xea\x2d\xe9\x92\x85\xf9\x6f\xca\xc0\xdf\x89\x41\xa1\xfa\x2b\xef\x92\x85\x81\x82\xd4\x39\xe8\x2b\x16\xa6\x8f\x85\xc0\x14\x2c\xb\xf5\x8f\xfa\x82\x85\xf9\xd7\xc3\xde\xac\x25\xe5\xb4\x30\xfa\x50\xd0\x90\x3a\xc\x86\xf3\x16\x3a\x35\x24\x14\x3a\xc\x86\xf3\x16\x46\x1f\xa\x1a\x52\xb\xc\xa7\x2d\x34\x6a\x48\x28\xf4\x68\x49\x67\x2d\x4c\xbf\x1f\x28\x18\xc\x49\x2d\x34\x6a\x48\x96\x85\x26\x83\xe1\xa4\x85\xd9\xef\x4a\x14\x60\x48\x6a\xa1\x11\x5\xd\xa9\x4d\x4b\x3a\x67\x61\x94\x7e\x26\x28\xf4\x1c\xc\xa7\x2c\xcc\xbe\x20\xbe\xc9\x66\x30\x64\xb5\x30\xf9\x82\x58\x16\x60\xc8\x6a\xa1\xf\x5\xd\xa9\x53\x4b\x3a\x61\xa1\x4f\x43\x42\xa1\xd5\x60\x38\x61\x61\xa0\x20\x15\x7\xc3\x71\xb\x93\x6f\x88\xbd\x19\x86\xb4\x16\x46\xd5\xd7\x2\xa\xcd\x5b\xd2\x61\xb\x6d\x28\x68\x48\xdd\x6\xc3\x51\xb\x6d\x1a\x12\xa\xed\x6\xc3\x51\xb\xa3\x9\x5\xd\xa9\x1f\x86\x83\x16\xe6\xbe\x2d\x2d\xb\x12\xe8\x1e\x1c\xb3\xd0\x86\x82\x86\xd4\x70\x30\x1c\xb3\xd0\xa5\x21\xa1\xd0\x71\x30\x1c\xb2\x30\xf7\x8a\xa0\x20\xa1\xee\xc2\x21\xb\xa3\x7\x5\xcb\x42\x4f\xc\x47\x2c\x4c\xbd\x22\xf6\x66\x9\x76\x1d\xe\x58\x98\xda\x1c\xec\xcd\x12\x6d\x30\x1c\xb0\xd0\xa4\x21\xa1\xd0\x75\x30\x3c\x6f\x61\xea\x1d\xb1\x2c\x48\x38\xc\x4f\x5b\xe8\xd2\x90\x50\x68\xdb\x92\x9e\xb6\x30\x7a\x50\xd0\x90\xfa\xe\x86\x67\x2d\xcc\xbc\x23\x28\x48\xc4\xc1\xf0\xac\x85\x51\xe8\x33\xa3\x0\xc3\x5\xb\x3d\x28\x58\x16\x5a\xb7\xa4\xe7\x2c\x34\x69\x48\x28\xb4\x1e\xc\xcf\x59\x18\x2d\x28\x68\x48\xbd\x7\xc3\x53\x16\x66\x5e\x12\xcb\x82\x4\xc5\xf0\x94\x85\xd1\x81\x82\x86\xd4\xbd\x25\x3d\x63\xa1\x47\x43\x42\xa1\xfb\x60\x78\xc2\xc2\xc4\xee\x60\x59\x90\xb8\x83\xe1\x9\xb\x3\x5\xe9\x80\xe1\x6b\xb\x13\x6f\x89\xbd\x59\x2\xbf\x30\xbf\xb4\xd0\x82\x82\x65\xc1\x60\x78\xc2\x42\x8b\x86\x84\x82\xc1\xf0\xb5\x85\x79\x63\xc1\xb2\x20\xb1\x6f\xca\x57\x16\xe6\xbd\x31\x2d\xb\x12\xfb\xaa\x7c\x61\xa1\x3\x5\xd\xc9\x60\x78\xc2\xc2\xbc\x37\x26\xa\x12\xfd\xb6\x7c\x6e\x61\x24\x97\xae\x21\xc1\x30\xc9\xc2\xb4\x6b\x82\x82\xc4\xbf\x30\x9f\x59\xe8\xd0\x90\x50\x30\x18\x9e\xb1\x30\xea\x53\xb0\x2c\x18\xc\xcf\x58\xe8\xd0\x90\x50\x80\xe1\x19\xb\xa3\x3e\x5\xd\x49\x4b\x7a\xc6\xc2\xb4\x7b\x62\x59\x90\x14\xaf\xd0\xf\x2d\x34\xa0\xa0\x21\x19\xc\x4f\x59\x18\x28\x48\x2f\xc\x1f\x59\x98\x35\x16\x2c\xb\x92\xe5\xee\x7c\x64\x61\xa0\x20\xcd\x6\xc3\x7\x16\xea\x37\x24\x14\xc\x86\xa7\x2c\xcc\xba\x28\x96\x5\xc9\x83\xe1\x7d\xb\xf5\x1b\x12\xa\x5a\xd2\x53\x16\x26\x8d\x5\xcb\x82\x64\xba\x42\xef\x59\x40\x41\x3a\xe\x86\xf7\x2c\x8c\x7c\x1f\x43\x43\x82\x61\x85\x85\x49\x2f\x4d\x14\x24\x57\xbb\x78\xc7\xc2\xc8\xf6\x19\x34\x24\x83\x61\x8d\x5\x14\xa4\xe7\x60\x78\x63\xa1\x7c\x43\x42\x1\x86\x27\x2d\x8c\xe2\x14\x2c\xb\x5a\xd2\x93\x16\xe6\xbc\x35\x7d\x93\x4d\xf2\xd\x86\x5f\x2c\x94\xa7\xa0\x21\x19\xc\x4f\x5a\x18\x28\x48\xd7\xc1\xf0\xb3\x85\x39\x57\xc5\xb2\x20\x19\x31\xfc\x6c\x61\xa0\x20\x6d\x5b\xd2\x4f\x16\xa6\x8c\x5\xd\x49\x72\xe\x86\xd7\x16\x50\x90\xce\x83\xe1\xb5\x85\xe2\xd\x9\x5\x18\x9e\xb5\x30\xe5\xae\x58\x16\x24\x6b\x4b\x7a\x65\x61\xa0\x20\x9d\x7\xc3\xbf\x16\x46\xe\xbc\x1a\x92\xc1\xb0\xda\xc2\x8c\xbb\x82\x82\x24\xc6\xf0\x8f\x5\xd\x49\x9a\xb7\xa4\x1f\x16\x66\xbc\x37\x51\x90\xcc\x83\xe1\xbb\x5\xd\x49\xda\xf\x86\xef\x16\x6\xa\xd2\x1d\xc3\xdf\x16\x6a\x37\x24\x14\xb4\xa4\xe7\x2d\x8c\xca\x14\x2c\xb\x6\xc3\xf3\x16\x26\xbc\x38\x51\x90\xec\x83\xe1\x2f\xb\x23\xf6\xd7\xa8\x21\xc9\x8e\x8b\x36\xc7\x2\xa\x92\xbf\x25\xfd\x69\xe1\xfa\x75\xd1\x90\x24\xff\x60\xf8\xd3\xc2\x40\x41\xc\x86\x29\x16\x34\x24\xa9\x80\xe1\xf\xb\x57\xef\xb\xa\x52\xa2\x25\xfd\x61\x61\xa0\x20\x6\xc3\xc\xb\x96\x5\xa9\x31\x18\x7e\xfb\x76\xf1\xe5\x89\x82\x14\xc1\x70\xd5\x82\x86\x24\x55\x5a\xd2\x45\xb\x28\x48\x99\xc1\xf0\xdb\xb7\x11\xf\xa8\x86\x24\x37\xdc\xbb\x6b\x16\x2\x53\x30\x16\x60\x38\x6a\xe1\x7f\x17\xee\x4c\xe0\x86\x64\x2c\x68\x49\x3b\x2d\x44\xa6\x60\x2c\x18\xc\x1b\x2d\x44\xa6\x60\x2c\x18\xc\x3b\x2d\x4\x5e\x16\x8c\x5\x18\x76\x5a\x88\x4c\xc1\x58\xd0\x92\x36\x5a\x8\xdd\x90\x8c\x5\x83\xe1\xc4\xff\xe0\x7f\xa\x52\x60\xc1\x60\xd8\x68\x21\x74\x43\x52\x91\x60\xd8\x67\x21\x36\x5\x16\xb4\xa4\x6d\x16\x82\x53\x50\x91\xc\x86\x5d\x16\x62\x2f\xb\xc6\x82\xc1\xb0\xcf\x42\xf0\xb1\xc0\x2\xc\xe6\x82\x8a\xa4\x25\xed\xde\x17\xfc\x17\x55\xa9\x37\x18\x4e\xfe\x77\x24\xdf\x69\x93\x72\x83\xa1\xe2\xf7\x17\x58\x30\x18\x76\x5a\xf0\x2f\xda\xa4\x1a\x86\x8a\x3f\x8f\xc4\x82\x96\xb4\xd5\x42\x60\xc\x2c\x18\xc\x7b\x2d\x84\x6d\x49\xd6\x5\x83\x61\xb7\x85\xa8\x18\x58\x80\xe1\x9c\x85\x2b\xbf\x7\xe3\xc1\x82\xd4\x69\x49\x97\x2c\xc4\x5c\x19\x58\x30\x18\xf6\x5b\x88\x89\x81\x5\x83\xe1\x6\xb\x21\x5b\x12\xb\x30\x9c\xb4\x70\xed\xea\x3c\x58\x90\x22\x2d\xa9\xe0\xef\xd9\x66\xc1\x60\x38\x69\xe1\xe2\xb7\xa6\xe2\x61\x60\xc1\x60\xb8\xc7\x42\x40\xc\xbe\xef\xc\xc3\x49\xb\x57\xdf\xa3\xf\x16\xa4\x42\x4b\x9a\x60\x21\x1c\x6\x16\xc\x86\x93\x16\xca\xfd\x7d\x67\x16\xc\x86\xb3\x16\x2e\xf\x86\x60\x18\x2c\xcf\x30\xdc\x66\x21\x58\x4b\x62\x41\x4b\x3a\x6b\x61\x42\xa9\x78\xb0\x20\xd9\x7\xc3\x5f\x16\x26\x5c\x9e\x50\x18\x2c\xc\x6\xc3\x8d\x16\x42\xad\xc\x2c\xc0\x70\xd6\xc2\x8c\xcb\x13\x9\x83\x92\xa4\x25\x9d\xb6\x30\xe3\xf2\x3c\x58\x90\xd4\x83\xe1\x6f\xb\xd5\x30\x28\x49\x6\xc3\x69\xb\xc5\x5a\x12\xb\x30\x9c\xb7\x30\x63\x30\xc4\xc1\xa0\x24\x69\x49\xe7\x2d\x4c\x79\x95\xc6\xc1\x60\x30\x18\xc\xe7\x2d\x4c\xb9\x3e\xf\x16\x24\xed\x60\xf8\xd7\xc2\x94\x5e\x11\x5\x83\x92\x4\xc3\x5\xb\xb5\x5a\x92\xc1\xa0\x25\x5d\xb0\x30\xe5\x5d\x1a\x5\x83\xc1\x60\x30\x5c\xb0\x50\xab\x25\x19\xc\x6\xc3\x5\xb\x73\xee\x4f\x10\xc\x6\x3\xc\x57\x2c\xcc\xb9\x3f\x30\x48\xca\x96\xf4\x93\x85\x39\x83\x21\xca\xca\xa0\x25\x19\xc\x17\x2c\x94\xc2\x60\x30\x18\xc\x57\x2c\x68\x49\xd2\x16\xc3\x2f\x16\x26\x15\x8b\x20\x18\xb4\x24\x2d\xe9\x82\x85\x39\xef\x52\x2d\x49\xf2\xd\x86\x5f\x2d\x4c\x7a\x97\xda\x9f\x25\xdd\x60\x78\x63\xa1\x56\x4b\x32\x19\x60\xb8\x60\x61\xd2\xf5\x81\x41\x92\xb5\xa4\xb7\x16\x66\xf5\xa\xfb\xb3\xe4\x1a\xc\xef\x58\x98\xf4\x2a\xb5\x32\x48\xae\xc1\xf0\x8e\x85\x62\x18\xb4\x24\x83\xe1\xbc\x85\x62\x2d\x9\x6\x18\xce\x5b\x98\x75\x7b\x60\x90\x44\x2d\xe9\x5d\xb\xb3\x6\x83\x95\x41\x12\xd\x86\xf7\x2d\xc0\x20\xfd\x6\xc3\x7\x16\x66\xd5\xa\xfb\xb3\xa4\xc1\xf0\x81\x85\x69\x6f\x52\x2b\x83\x64\x69\x49\x1f\x59\x98\x76\x79\x7c\xcb\x4d\x92\xc\x86\x8f\x2c\x54\x6b\x49\x30\x18\xc\xa7\x2d\x4c\xbb\x3c\x30\x48\xe\xc\x1f\x5b\xa8\xd6\x92\xac\xc\x5a\xd2\x59\xb\xf3\x5e\xa4\x30\x48\x86\xc1\xf0\x89\x85\x72\x18\xb4\x24\x83\xe1\xac\x85\x69\x2f\x52\x2b\x83\x24\xc0\xf0\x99\x85\x79\x77\x7\x6\x89\xdf\x92\x3e\xb5\x30\xaf\x61\x5b\x19\x24\xfc\x60\xf8\xd4\x2\xc\xd2\x68\x30\x7c\x6e\x41\x4b\x92\x3e\x18\xbe\xb0\x30\xef\x3d\xa\x83\x4\x6f\x49\x5f\x58\x98\x78\x75\xfc\xc8\xaa\xc4\x1e\xc\x5f\x59\x98\x88\xc1\xca\x20\xa1\x7\xc3\x97\x16\x26\x5e\x1d\x18\x24\x32\x86\x2f\x2d\xd4\x6b\x49\x56\x6\x2d\xe9\xa4\x85\x89\xaf\x51\x18\x24\xf0\x60\xf8\xda\x82\x96\x24\x3d\x6\xc3\x13\x16\x66\xbe\x46\x61\x90\xb0\x18\x9e\xb1\x30\xf3\xe6\xf8\x91\x55\x89\xda\x92\x9e\xb1\x30\xf3\xe6\x58\x19\x24\xea\x60\x78\xca\xc2\xcc\xc1\x0\x83\x4\x1d\xc\x4f\x59\xa8\xd8\x92\xac\xc\x30\x9c\xb2\x30\xf5\x2d\xa\x83\x84\x6c\x49\x4f\x5a\xd0\x92\xa4\xfc\x60\x78\xd2\xc2\xd4\x8b\x3\x83\x44\x1c\xc\xcf\x5a\xa8\x88\x41\x4b\x82\xe1\x94\x85\xa9\x17\xc7\xca\x20\xf1\x5a\xd2\xd3\x16\xe6\x36\xa\x18\x24\xdc\x60\x78\xde\xc2\xd4\x7b\x63\x65\x90\x70\x83\xe1\x79\xb\x30\x48\x6d\xc\x7\x2c\x68\x49\x52\xba\x25\x1d\xb1\x30\xf7\xde\xc0\x20\xb1\x6\xc3\x11\xb\x93\xb\x5\xc\x12\x6a\x30\x1c\xb2\x30\x17\x83\x95\x41\x42\x61\x38\x66\x61\xee\x3b\x14\x6\x89\xd4\x92\x8e\x59\xd0\x92\xa4\xee\x60\x38\x68\x61\xf2\xb5\x81\x41\xe2\xc\x86\x83\x16\xb4\x24\x29\x3b\x18\x8e\x5a\x98\x7c\x6d\x60\x90\x30\x18\xe\x5b\x98\xdc\x27\x60\x90\x28\x2d\xe9\xb0\x85\xd9\xb7\xc6\xca\x20\x41\x6\xc3\x71\xb\x30\x48\xcd\xc1\x70\xc2\x82\x96\x24\x25\x31\x9c\xb0\x30\xfb\xd6\xc0\x20\x21\x5a\xd2\x19\xb\xb3\xeb\x84\x96\x24\x11\x6\xc3\x19\xb\x30\x48\xc5\xc1\x70\xca\xc2\xf4\x3a\x1\x83\xdc\x3f\x19\xce\x59\x98\x7d\x69\xac\xc\x72\xff\x64\x38\x67\x61\xfa\xa5\x81\x41\x6e\xc7\x70\xd2\x82\x96\x24\xe5\x30\x9c\xb5\x30\xfd\xd2\xc0\x20\x37\xaf\xc\x67\x2d\x68\x49\xe5\xea\x72\xd7\x67\xfb\xcf\x33\x38\x6d\x61\xfa\xb\x14\x86\x3b\xdf\x89\x9d\x9f\xed\xe3\xaa\x85\xf9\x9f\x2b\x48\x4b\xea\x84\xe1\xe1\xd9\xbe\x7a\xb\x9f\xb7\x50\x16\x43\x9f\x95\x61\xff\x28\x8e\xf9\x6c\x1f\x97\x2d\xcc\xff\x5c\x30\x14\xa7\x10\xf4\xd9\x7e\x7f\x10\x17\x2c\xcc\x1f\xc\x56\x86\xea\x14\x82\x3e\xdb\xc7\x65\xb\xf3\x8d\xc3\x50\x79\x59\x88\xfb\x6c\xff\xbe\x77\x57\x2c\xd4\x6d\x49\x1d\x30\x3c\x3c\xdb\x99\x16\x16\x7c\x2c\x2b\x43\xe9\x86\x14\xf5\xd9\x3e\xae\x5b\xa8\xdb\x92\xaa\x63\xb8\xf3\x39\x7\x7c\xb6\x13\x2c\x2c\x18\xc\x56\x86\xda\xd\x29\x26\x86\xbf\x6e\xdd\x45\xb\x30\xa0\x50\xe2\xd9\x3e\x26\x58\x58\x40\xdc\xca\x50\x9d\x42\x40\xc\x33\x2c\xac\xf8\x54\x30\x14\x5e\x16\x82\x62\xf8\xf3\x91\x5c\xb6\xb0\xe0\xc6\xd8\x9f\xcb\x53\xa8\x69\xa1\x32\x86\xa2\x2b\x43\x80\xb9\x1b\xef\x35\xf3\x98\x61\xa1\x70\x4b\xaa\x89\x1\x85\x75\x16\x56\x7c\x30\x2b\x83\x86\x94\xd1\xc2\x92\x4f\x6\x3\xa\xbb\x9f\xcb\xc\xb\x2b\x3e\x9b\x95\x1\x85\x94\x16\x56\xbc\x3d\x61\xb0\x2c\x64\xb4\x50\xb9\x25\xd5\xc2\x80\xc2\x27\x8f\x66\x8e\x85\x25\x9f\xcf\xca\xa0\x21\x25\xb4\x50\xba\x25\xd5\xc1\x80\xc2\xe\xb\x4b\x3e\xa2\x95\xa1\xde\xf3\x8c\xfb\x62\x99\x67\x61\xc9\x67\x84\xc1\xb2\x90\xd0\xc2\x9a\xfb\x62\x65\x40\x21\xa1\x5\x18\x34\xa4\xd4\x3\x76\xa6\x85\xd2\x2d\x29\x3f\x6\x14\x36\x5a\x58\xf3\x49\xad\xc\x1a\x52\x42\xb\x6b\x3e\xaa\x6f\xb9\xa1\x90\xcf\x42\x6d\xc\xb9\x5b\x52\x84\x87\x38\x5e\x1a\x59\x58\xf4\x69\x61\xb0\x2c\xe4\xb3\xb0\xe6\xba\xd8\x9f\x51\xc8\x67\x61\xd1\x7\xb6\x3f\x5b\x16\xf2\x59\x58\xf4\x89\xed\xcf\x28\xa4\xb3\x50\x1c\x43\xce\x96\x64\x6f\xbe\xc7\x42\xf1\x96\x94\x11\x83\x65\xe1\x2e\xb\x8b\x6e\x8b\x95\x1\x85\xe5\xcf\x69\xb6\x85\x55\x9f\x1b\x6\xcb\x42\x3a\xb\xab\x6e\x8b\xfd\x19\x85\x74\x16\x56\x7d\x74\xfb\xb3\x86\xb4\xf6\xa5\x31\xdf\x42\xf5\x96\x94\x9\x3\xa\x37\x5b\x58\x75\x59\xac\xc\x19\x9f\x58\x96\x57\xc7\x1a\xb\xd5\x5b\x52\x1e\xc\x96\x85\x43\xaf\x8d\x15\x16\x96\x5d\x16\x2b\x3\xa\xd9\x2c\x2c\x7b\x2\x30\x58\x16\xd6\xdd\xac\x25\x16\x96\x3d\x2\xfb\x33\xa\xd9\x2c\x94\xc7\x30\x72\x9c\xae\x57\xc6\x91\x7b\xb5\xc8\x42\xf5\x96\x94\xe1\xc7\xf1\x51\x38\xf8\xb4\x16\x59\x58\x77\x57\xac\xc\x69\x1e\x53\xa2\x6f\xd1\x2f\xb5\xb0\xec\xae\x58\x19\x2c\xb\x8b\x1e\xd7\x2a\xb\xf5\x31\xc\x14\xaa\x50\xf8\x3e\x45\x97\x59\x58\xf7\x2c\x60\xb0\x2c\x2c\xb9\x51\xeb\x2c\xac\x7b\x18\xf6\x67\x14\x72\x59\x58\x78\x55\xec\xcf\xf6\xe6\x5\xf\x6c\xa1\x85\xfa\x2d\x29\xec\x5f\x1e\x43\xe1\xcc\x3\x5b\x69\x61\xdd\x55\xb1\x32\xc4\x7e\x36\xb9\xfe\x91\xc7\x8f\x39\xba\xd2\x42\xfd\x96\x14\xf4\x8f\x76\xa3\x70\xea\xe5\xb1\xd4\xc2\xc2\x67\x2\x3\xa\xb3\xe7\xe8\x52\xb\xd\x30\x44\x3b\x77\xcb\xc2\xf9\x8b\xb4\xd6\xc2\xc2\xc7\x62\x7f\x46\x61\xf2\x13\x5b\x6c\x61\xe1\x4d\xb1\x3f\xdb\x9b\xe7\xf6\x8b\xc5\x16\x56\xde\x14\x2b\x83\x65\x61\xea\x13\x5b\x6d\xa1\x1\x86\x38\xa7\x8f\xc2\xa5\x41\xba\xdc\x42\x83\x96\x14\xe5\xfc\x2d\xb\xd7\xde\x1e\xcb\x2d\xac\x7c\x3a\x30\xa0\x30\xf1\x91\xad\xb7\xb0\xf2\xa2\x58\x19\x34\xa4\x79\x6f\x8f\xf5\x16\x96\x5e\x14\x18\x50\x98\xf6\xc8\x36\x58\xe8\x80\xe1\xfe\x5b\xe0\x87\x53\x2f\x97\xca\x1d\x16\x56\x5e\x14\x2b\x83\x65\x61\xd6\xeb\x63\x87\x85\xa5\xf\xc9\xb7\xdc\x50\x98\x34\x49\xb7\x58\x58\xfa\xd2\xb4\x32\x58\x16\xe6\xbc\x3e\xb6\x58\x80\x1\x85\xf8\x63\x61\x93\x85\x16\x2d\xe9\xbe\xdb\x60\x6f\x9e\x72\x6b\x36\x59\x58\x7a\x4f\xba\x63\xb0\x2c\xcc\x79\x66\x9b\x2c\xac\x7d\x56\xbd\xf7\x67\x3f\x9c\x3a\x69\x94\xee\xb2\xb0\xf6\x9e\xb4\x5e\x19\x2c\xb\x93\xde\x1f\xdb\x2c\xac\x7d\x5c\x8d\xbf\xe5\x86\xc2\xac\x87\xb6\xcd\x42\x8f\x96\xb4\xff\x56\x58\x16\xa6\xbd\x3f\xf6\x59\x58\x7b\x4d\xba\x62\x40\x61\xde\x43\xdb\x67\xa1\x47\x4b\xda\x7c\x31\xec\xcd\x13\xef\xca\x46\xb\x8b\xaf\x49\x4b\xc\x96\x85\x89\x2f\x90\x9d\x16\x16\x3f\xb5\x86\xfb\x33\xa\x33\x67\xe9\x4e\xb\x8b\x5f\x99\xfd\x56\x6\xcb\xc2\xd4\x17\xc8\x56\xb\x30\xa0\x10\x77\x2c\x6c\xb6\xd0\xa3\x25\x6d\xba\x20\xf6\xe6\xc9\x97\x64\xaf\x85\xd5\xb7\xa4\x15\x6\xcb\xc2\xe4\xa7\xb6\xd9\xc2\xe2\x87\xd7\xa9\x25\xf9\xe1\xd4\xd9\x37\x64\xb3\x5\x18\x2c\xb\x51\xc7\xc2\x76\xb\xab\x9f\x5f\x97\x1f\x59\x45\x61\xfe\x63\xdb\x6e\x61\xf5\x1b\xb3\xc9\xca\x60\x59\x98\xff\x6\xd9\x6e\x61\xf9\xdb\xa4\x5\x6\x14\x16\x3c\xb6\xfd\x16\xba\xb4\xa4\xea\xbf\x2f\xb0\x5a\x43\xba\xc5\xc2\xea\x17\x4a\x7d\xc\x96\x85\x25\xaf\x90\x1b\x2c\x68\x49\x5\x28\xd4\x6b\x48\xf7\x58\x58\xfe\x1c\x8b\x63\xb0\x2c\xac\x79\x85\xdc\x61\xa1\xd\x86\x35\x9f\x13\x85\x45\xcf\xed\x16\xb\x2d\xfe\xeb\xfb\xaa\x3b\x63\x59\x58\xf5\xdc\xee\xb1\xb0\xfc\xbd\x52\x17\x3\xa\xcb\x9e\xdb\x3d\x16\xd6\x3f\xcd\xaa\x2b\x83\xbd\x79\xdd\x85\xb8\xc9\xc2\xfa\xc7\x59\x14\x83\x65\x61\xdd\x3b\xe4\x26\xb\x5a\x12\xa\xd1\xc6\xc2\x6d\x16\xd6\xb7\xa4\x8a\x18\x2c\xb\x2b\xdf\x21\xb7\x59\xe8\xf1\x53\xcd\x73\x3f\x29\xa\x4b\x1f\xdc\x6d\x16\x36\x3c\xd4\x6a\x2b\x83\xbd\x79\xed\x4d\xb8\xcf\x2\xc\x96\x85\x50\x63\xe1\x4e\xb\x5a\x52\x3e\xd9\x85\x1b\xd2\xad\x16\x36\x3c\xd8\x4a\x18\x2c\xb\xab\x5f\x22\x77\x5a\xd8\x30\x70\xeb\xb4\x24\x14\x96\x3f\xb9\x3b\x2d\xc0\x60\x59\x8\x34\x16\xee\xb5\xb0\xe3\x45\x53\x4\x3\xa\xeb\x9f\xdc\xbd\x16\x36\x3c\xde\x1a\x2b\x83\xbd\x79\xc3\xf9\xdf\x6b\x61\xc7\xf3\xad\x80\xc1\xb2\xb0\xe3\x2d\x72\xb3\x5\x2d\x29\xb\x85\xa4\xd\xe9\xc8\xa3\xbb\xdb\x42\x97\xdf\xb6\x78\x9\x83\x65\x61\xcb\x5b\xe4\x6e\xb\x5a\x12\xa\x51\x5e\x83\xb7\x5b\xd8\xf1\x94\x73\x63\xb0\x37\x6f\x3a\xf8\xdb\x2d\xc0\x60\x6f\xe\xd2\x8e\xef\xb7\xb0\xe5\x41\xe7\x5d\x19\xec\xcd\xdb\x4e\x3d\x80\x85\x2d\x4f\x3a\x2d\x6\xcb\xc2\xb6\x36\x10\xc0\xc2\x96\xc1\x90\xb5\x25\xa1\xb0\xef\xfd\x17\xc1\x2\xc\x96\x85\x8\x27\x1e\xc2\x82\x96\x84\x42\x80\x97\x5f\x8\xb\x6d\xfe\xd6\xdf\xc1\xf\x6b\x6f\xde\x7a\xdc\x31\x2c\x6c\x79\xe0\x51\x5a\xd2\xf3\x18\x2c\xb\x5b\x4f\x3b\x86\x85\x5e\x18\x9e\xfd\xb0\xbe\xc9\xb6\xb7\x5\x4\xb1\xb0\xe7\x99\xe7\xc2\x60\x59\xd8\x5c\x88\xa3\x58\xd8\x33\x8b\x33\xad\xc\x28\xec\x7e\xeb\x45\xb1\xb0\xe9\xb1\x27\xc2\x60\x59\xd8\x7d\xce\x61\x2c\xf4\x6a\x49\x5f\x7f\x5a\x14\xb6\x1f\x73\x1c\xb\x7b\x9e\x7c\x96\x95\xc1\xde\xbc\xff\x90\xe3\x58\x68\xd6\x92\x3e\xc7\x80\xc2\xd\x67\x1c\xc8\xc2\xa6\x91\x9c\x1\xc3\xa3\xcf\x71\x4\x9a\xfd\x81\x2c\xec\x7a\x11\xc5\xc7\x80\xc2\x2d\x7\x1c\xc9\xc2\x26\xc\x61\xf6\xe7\xf\xae\x5b\x88\xaf\x2f\x31\x85\xd3\xcf\x2f\x94\x85\x4d\x7\x10\x6\xc3\xbb\xfa\x1f\x51\xbf\xb0\xea\x14\x62\x59\xe8\xd6\x92\xde\x7e\xe6\x28\x4c\xf3\x52\xb8\x70\xb8\xb1\x2c\xec\x9a\xcc\xa1\x30\xfc\xf8\xd4\x8f\x7e\xe7\x10\x6b\xe8\xc7\xb2\xd0\xb0\x25\x45\x4c\x62\xa\x57\xde\x28\xc1\x2c\xec\x1a\xce\x30\xa0\x10\xde\xc2\xae\x73\x80\xa1\xe4\xb2\x70\xe9\x58\xa3\x59\xd8\x76\x10\xf\x77\xbe\x1e\x85\x6b\xa7\x1a\xce\x2\xc\x1a\xd2\x4d\xd3\x3e\x9e\x5\x2d\x9\x85\x7b\x8e\x34\x9e\x85\x6d\x83\x1\x6\xd\x29\xba\x85\x6d\x6f\x26\x2d\xa9\x16\x85\xab\x2f\xb7\x80\x16\x60\x40\xe1\x96\xe3\x8c\x68\x61\xdf\x89\xc0\x50\x67\x59\xb8\x7e\x98\x21\x2d\x6c\x3b\x12\x2b\x43\x1d\xa\xd7\xcf\x32\xa4\x85\x7d\x83\x1\x6\xd\x29\xb8\x5\x2d\x9\x85\xfd\x6f\xb5\xa0\x16\xf6\x4d\x6b\x18\x34\xa4\xd8\x16\xb4\x24\x14\xb6\xbf\xd2\xa2\x5a\xd8\x77\x32\x30\x14\xa0\x30\xe5\x10\xa3\x5a\x80\xc1\xb2\xb0\xbb\xe9\x86\xb5\xb0\xf1\x70\xac\xc\x28\xc4\xb6\xb0\x71\x68\xc3\xa0\x21\x85\xb6\xb0\xf1\x55\xd5\xbe\x25\xe5\xa6\x30\xeb\x5d\x16\xd8\x2\xc\x28\x6c\x3d\xbd\xc8\x16\xb4\x24\xcb\xc2\xce\x17\x59\x64\xb\x3b\xcf\xe8\x81\x42\xf3\x86\x14\xdc\xc2\xce\xd9\xdd\x17\x83\x86\x94\xc1\xc2\xce\x63\x6a\xbb\x32\x24\xa7\x30\xf1\x25\x16\xdb\xc2\xce\xf1\xdd\x15\x83\x86\x94\xc4\x82\x96\x84\xc2\xb6\x37\x58\x70\xb\x5b\x8f\xea\x81\x42\xe7\xb1\x10\xde\xc2\xce\xc1\xd0\xb0\x25\x65\x5f\x16\xa6\x1e\x59\x74\xb\x30\xa0\xb0\xeb\xc0\xc2\x5b\xd8\x3a\xc5\xbb\x61\xd0\x90\x72\x59\xd8\xfa\xee\x7a\xa0\xd0\x76\x2c\x24\xb0\xb0\xf7\xc4\x3a\x61\xc8\xde\x90\x66\x1f\x56\x2\xb\x5a\x12\xa\x5b\xde\x5b\x19\x2c\x6c\x3d\xb4\x36\x18\xd2\x53\x98\x7e\x52\x19\x2c\x68\x49\x96\x85\x1d\x7\x95\xc2\xc2\xde\x57\xd8\x3\x85\x96\x63\x21\x87\x5\x18\x34\xa4\xd\x5d\x36\x87\x85\xbd\x6f\xb1\x6\x2b\x43\x7a\xa\x2b\x5e\x58\x49\x2c\xec\x3d\xbb\xf2\x18\xf2\x53\x68\x3c\x17\x36\xd7\xdb\xea\x2d\x69\x14\xf8\xc\x8f\xb6\x16\x60\x40\xc1\xee\xac\x25\x69\x48\x7b\xde\x57\x69\x2c\x6c\x7e\x99\x15\xc6\x50\x84\x42\xcf\xef\x3b\xdf\x72\x84\x75\x31\x8c\x2a\x1f\x64\xf6\x11\xe5\xb1\xb0\x1b\xc3\x3\x85\x66\x83\x21\x91\x85\xdd\xa7\xf8\x40\xa1\xd7\x60\xc8\x64\x41\x4b\xb2\x2c\xac\x3c\xa2\x4c\x16\x76\xbf\xd3\xa\x62\xa8\x45\x61\xf2\xec\x4e\x65\x41\x4b\xd2\x90\x16\xbe\xae\x72\x59\xd8\xfd\x5a\x7b\xa0\xd0\x68\x30\xe4\xb2\xa0\x25\x69\x48\xeb\x30\x24\xb3\xb0\xfb\x34\x4b\x61\xa8\x48\x61\xe6\x9\x25\xb3\x0\x3\xa\xcb\x6\x43\x36\xb\xdb\x2b\x6f\x9d\x95\x61\x94\xa4\xd0\xe6\x77\xce\x47\x78\xbb\x3d\x50\x68\x82\x21\x9d\x85\xed\x67\x5a\xa4\x25\x15\x6d\x48\x33\xdf\x56\xf9\x2c\xc0\x60\x2c\xac\x39\xa0\x84\x16\xb4\x24\x63\x61\xc9\x1\x25\xb4\x60\x30\x18\xb\x4b\x30\x64\xb4\xb0\xfd\x1d\x97\x1f\x43\xe9\xb1\x30\xeb\x80\x32\x5a\xd8\xff\x92\x4b\xdf\x92\x6a\x8f\x85\x49\x7\x94\xd2\x82\x96\x64\x2c\x2c\x38\xa0\x9c\x16\xb4\x24\x63\x61\xfe\x1\xe5\xb4\x60\x30\x18\xb\xf3\x5b\x52\x52\xb\xfe\xbb\xaa\xb1\x30\xfd\x6d\x95\xd4\x82\x9f\xd1\x63\x61\xfa\xdb\x2a\xab\x5\x3f\xa3\xa7\x22\xcd\x3e\xa1\xb4\x16\xfc\x13\x37\x16\x26\x8f\xee\xb4\x16\xfc\x13\x37\x15\x69\xf2\xeb\x2a\xaf\x5\xbf\x8\x80\x85\xb9\xaf\xab\xc4\x16\xfc\xba\x24\x15\x69\xea\x11\x25\xb6\xe0\xb7\xd\xb3\x30\x75\x76\x67\xb6\xe0\x17\xac\xaa\x48\x33\xdf\x57\x99\x2d\xf8\x93\x86\x2c\xcc\x3c\xa3\xd4\x16\xfc\xe1\x67\x16\x26\x1e\x52\x6e\xb\x5b\x7\x43\xd6\x85\xa1\x95\x85\x2b\x87\x94\xdb\xc2\xd6\x73\x66\xa1\xf8\x60\x48\x6e\x61\xeb\x41\xe7\x2c\x49\x8d\xfe\x33\xd2\xc5\x37\x56\x76\xb\x3b\x4f\x9a\x85\xda\x18\xb2\x5b\xd8\x39\x18\x58\xa8\xdd\x92\xd2\x5b\xd8\x78\xd4\x2c\xd4\x1e\xc\xe9\x2d\x6c\x3c\x6b\x16\x6a\xf\x86\xfc\x16\xf6\xb5\xa4\x9c\xff\x21\xa9\x9f\x85\xb3\x18\xa\x58\xd8\x76\xd8\x2c\xd4\x6e\x49\x5\x2c\x6c\x1b\xc\x2c\xd4\x1e\xc\x15\x2c\xec\x3a\x6d\x16\x6a\xf\x6\x16\xaa\x5b\x68\xf6\x7d\xe7\xb\x47\x65\x5f\x60\x41\x4b\x2a\x63\xc1\x7f\x47\x62\x61\xca\x59\xf9\xfe\x42\x79\xb\x1d\x17\x86\x53\x83\x21\xbf\x85\x11\xf9\xf1\xb2\x90\x68\x30\xf8\x79\x24\x16\x60\xa8\x61\xc1\xcf\xa9\xb2\x30\xeb\xb8\xfc\xfb\x85\xf2\x16\x7a\x2e\xcf\x27\x6\x43\x72\xb\x5b\xdf\x79\x2c\xd4\x1e\xc\xfe\xbd\xf3\xca\x6d\x4c\x49\xca\x84\xc1\xef\xc1\x60\x41\x4b\x2a\x60\xc1\xef\x47\x52\x92\x26\x1e\x59\x6a\xb\xe3\x85\x5\x83\x61\xda\x60\xf0\xfb\x54\xcb\x57\xa4\xc6\x16\x8e\x1d\x9a\xdf\xb3\xdd\xc0\x42\xdf\x92\x74\x68\x98\xfb\xfb\xb\x1d\x2c\x18\xc\xb5\x2d\xf8\x23\x55\x6\xc3\xdc\x63\xf3\xf7\xda\x1a\x8c\x85\xce\x83\xe1\x0\x6\x7f\xc7\xb3\xc3\x58\xe8\x6c\xe1\xf9\x97\x98\xbf\xef\xdc\x61\x2c\x74\x2e\x49\xcf\xbf\xc5\xb2\x5a\xd8\x7d\xb6\xd9\x2d\x18\xc\x65\x2d\x6c\x7f\xcd\x3d\xb2\xdf\x88\xc6\x83\xe1\x59\xc\x39\x2d\x6c\x7f\xcb\x65\x1f\xb\x5a\x52\x59\xb\xc6\x82\x96\x34\xff\x4d\x96\xd2\x82\xb1\x0\xc3\x82\x57\x59\x46\xb\xfb\xf\xf5\x51\xe2\x46\x68\x49\xf5\x2c\x68\x48\x30\xac\x18\xec\x9\x2d\x68\x48\x5a\xd2\x92\xd7\x59\x42\xb\xc6\x2\xc\x4b\xde\x67\xf9\x2c\xa0\x0\xc3\x1a\xc\xe9\x2c\x68\x48\x56\x86\x45\xaf\xb4\x74\x16\xfc\xf0\x5\xc\x8b\xe\x32\x9b\x85\xed\x63\xe1\x51\xec\x4a\xf4\x6d\x49\x8f\x62\x16\x50\x80\x61\xd9\x59\x26\xb3\xa0\x21\x69\x49\xcb\xe\x33\x97\x5\xff\x6a\x1\x86\x75\x83\x21\x97\x5\xff\xdc\x5f\x4b\x5a\x77\x9e\xa9\x2c\xf8\x77\x9d\x30\x2c\xc4\x90\xc9\x82\xdf\x7c\x1\xc3\xca\x23\xcd\x64\x41\x43\xb2\x32\xac\x3c\xd3\x44\x16\xfc\x9e\x3c\x18\x96\xe\x86\x3c\x16\x34\x24\x2d\x69\xed\xb1\xe6\xb1\x30\x50\x80\x61\xe9\xb8\x4f\x63\x61\xf3\xd9\x3d\xca\x5f\xa\x2d\x29\xad\x5\xbf\x60\x1e\x86\xc5\x47\x9b\xc5\x2\xa\x5a\xd2\xea\xc3\x4d\x62\x41\x43\x82\x61\xf9\xe9\x26\xb1\xe0\xaf\x51\xc1\xb0\x7c\x30\xe4\xb0\xb0\xf7\xd0\x5a\x34\xa4\xce\x2b\xc3\x23\xb1\x5\x14\x60\xd8\x70\xc2\x29\x2c\xf8\x33\xce\x5a\xd2\x86\x33\xce\x60\xc1\x9f\x71\x86\x61\xc7\x21\x67\xb0\x30\x50\xd0\x92\x36\xc\x86\x4\x16\x34\x24\x18\xb6\xbc\xf2\xe2\x5b\xd8\x3a\xc5\xfb\x51\xd0\x92\x12\x59\x18\x28\xc0\xb0\xe5\xa8\xc3\x5b\xd8\x7a\x52\x8f\x8e\xb7\xa2\x29\x86\x47\x3a\xb\x28\x58\x19\x76\xd\x86\xe8\x16\x34\x24\x18\x76\x1d\x77\x70\xb\x3b\xc7\x42\x5f\xa\x5a\x52\x6\xb\xe3\xc6\x47\x3\x43\xb3\xc1\x10\xdb\xc2\xce\x23\xea\x4c\xa1\x69\x4b\x7a\x24\xb2\x80\x2\xc\x1b\xf\x3d\xb4\x85\x8d\xe7\xd3\x78\x59\xd0\x92\x12\x58\xd8\x78\x3c\xed\x29\x34\xc5\xf0\xc8\x62\x61\xdc\xf4\x4c\x60\xe8\x89\x21\xb0\x5\x14\xac\xc\x5b\x8f\x3e\xae\x5\xd\x9\x86\xbd\x67\x1f\xd7\xc2\x40\x41\x4b\xda\x7a\xfa\x61\x2d\xec\x3b\x17\x14\xac\xc\xa1\x2d\x6c\x3c\x15\xcb\x82\x96\x14\xda\xc2\x40\x1\x86\xcd\x37\x20\xa8\x5\xd\x49\x4b\xda\x3e\x18\x82\x5a\x18\x28\xc0\xc0\x82\x86\x4\xc3\x3d\x25\x29\xa4\x85\x7d\xc7\x81\x82\x95\xe1\x9f\xc1\x10\xd2\xc2\x40\x1\x86\xfd\x83\x21\xa2\x85\x6d\x63\xc1\xb2\xa0\x25\xbd\xba\x8\x1\x2d\xa0\x0\xc3\x2d\x83\x21\xa0\x5\xd\x49\x4b\xba\x65\x30\xc4\xb3\xb0\xed\xa5\x84\x2\xc\xc1\x2d\xc\x14\xb4\xa4\x5b\x4a\x52\x38\xb\x63\xe7\x9b\x40\x60\x88\x6b\x61\xd7\x19\xa0\x0\xc3\xaf\xf7\x21\x9a\x5\xd\xc9\xca\xc0\xc2\xd6\xb7\x11\xa\x30\xbc\xb9\x11\xb1\x2c\x68\x48\x5a\x12\xb\x5b\x5f\x45\x28\xc0\xf0\xce\x9d\x8\x65\x61\xd3\xc3\x47\x41\x4b\xa\x6f\x61\xd3\xb3\xb7\x2c\xc0\x10\xdd\x2\xa\x5a\x12\xb\x1a\x12\xc\xf7\x2f\xcf\x81\x2c\xc\x14\x60\x60\x61\xe3\x53\xd7\x90\xac\xc\xd1\x2d\xa0\x0\x3\xb\x3b\x1f\x39\xa\x5a\x52\x78\xb\x7b\x9e\xb8\x65\x1\x86\xf8\x16\x6\xa\x5a\x12\xb\x1a\x12\xc\x2c\x6c\x1e\xc3\x28\x68\x49\xf1\x2d\x68\x48\x30\xb0\xb0\xef\x51\xa3\xa0\x25\xc5\xb7\x80\x2\xc\x2c\x6c\x7c\xce\x96\x5\x18\xe2\x5b\xd8\x32\x16\x50\xb0\x32\x24\xb0\xb0\xe3\x8d\xa3\x21\xc1\x90\xc0\x2\xa\x5a\x12\xb\xdb\x5e\x37\x28\xc0\x90\xc1\xc2\xd8\xf2\x31\x45\x4b\xa\x6f\x61\xc7\xf3\x8d\x4d\x61\xe4\x99\x5d\xa5\x31\xdc\x6e\xa1\x7b\x43\x1a\xb9\xaa\xdc\x60\x21\xf5\xc3\x8d\x7b\xc3\xde\x79\x11\x3c\x60\xe8\x6a\xa1\x75\x43\x1a\x19\xd7\xfc\xc1\x42\xde\x27\x1b\x95\xc2\x87\xaf\x81\xd8\xa3\xa1\xee\xca\x70\xb3\x85\xc6\x14\x46\xd6\x55\xbf\x2c\x86\x7b\x2d\x6c\x78\xac\x51\x2b\xc7\x48\xd9\xea\x4a\xb7\xa4\x7b\x2d\xc\x14\x60\x60\x61\xd3\x58\x8\x7a\xa9\xbe\xfc\xe4\xa1\x31\x14\x6d\x49\x77\x5a\x40\x21\xdf\x3c\xab\x8c\xe1\x4e\xb\x1a\x52\x5a\xc\x83\x85\x64\x2f\x97\xc4\x14\x60\x68\x65\x61\x74\xa5\xf0\xe4\x4b\xc0\xfe\xdc\xc6\xc2\xd8\xf0\xd9\x72\x97\x6d\xfb\x73\x13\xb\xeb\x9f\x65\x76\xa\xf6\xe7\x2e\x16\xda\x36\xa4\x91\xff\x23\x14\x6d\x49\x77\x59\x58\xfe\x56\x29\x40\xc1\xca\xd0\xc2\x82\x86\x64\x65\x60\x61\xd3\x2b\xe5\x51\xe4\xfa\xc0\x50\xdd\xc2\xf2\x87\x98\xf0\x87\x53\xad\xc\x3d\x2d\xac\x7e\x86\x25\x96\x5\x18\x3a\x58\xe8\x4a\xe1\xd4\x38\xb4\x3f\x57\xb6\xd0\xb5\x21\x9d\xfc\xdc\x56\x86\xc2\x16\x46\x4f\xa\x67\x3f\xb7\x6f\xb9\xd5\xb5\xb0\xfa\xe9\x15\xa3\x60\x65\xa8\x6b\x61\x35\x85\x42\x7b\x33\xc\xc5\x2d\x8c\x9e\x14\x2e\xbd\x2\xac\xc\x25\x2d\x34\x6d\x48\x17\x3f\x36\xc\x15\x2d\x8c\x96\x14\xae\x7e\x6c\x2d\xa9\xa0\x85\xa6\xd\x69\x54\xfd\x60\x95\x30\x6c\xb6\xb0\x78\x9c\x96\x5c\x16\x60\xa8\x69\x61\xa0\x60\x65\x60\x61\xc3\x23\x2b\xba\x2c\xc0\x50\xd0\x2\xa\x5a\x12\xb\x9d\x1b\xd2\xa8\xfe\x1\xab\x60\xd8\x69\x61\xed\x58\x28\xbd\x2c\x68\x49\xc5\x2c\x8c\xc5\x9f\xa4\xfe\x15\x81\xa1\x88\x85\x96\x14\x26\x7f\xea\xd0\x18\x6\xb\x21\x5e\x1b\x3d\x28\x58\x19\x6a\x58\x58\xfa\xa0\x1a\x2c\xb\x30\x94\xb1\xb0\x74\x2c\xb4\xa1\x60\x65\x28\x60\x41\x43\x82\x81\x85\xd\xd3\xb3\x13\x5\x2d\x29\xbb\x85\xa5\xef\x8b\x47\xaf\x7b\x1\x43\x6e\xb\x2b\x9f\x50\xa3\x65\x21\x1\x86\xc4\x2d\x69\x8f\x5\x14\xac\xc\x2c\x68\x48\xed\x30\xc\x16\x5c\x8b\x7d\x37\xc2\xca\x90\xd5\xc2\xca\xb1\xd0\xb0\x21\xc1\x90\xd7\x2\xa\xf6\x67\x16\x96\xbf\x25\xc2\xde\x88\xb6\x7f\x98\x31\x33\x86\xf5\x16\x56\x3e\x97\x47\x5b\xa\xf6\xe7\x8c\x16\x6\xa\x56\x6\x16\x9a\x36\xa4\x4d\xd\xc1\xca\x90\xcc\xc2\xc2\x67\xd2\x9c\x82\x95\x21\x9b\x5\xd\xc9\xca\xc0\xc2\xea\xb7\x3\xa\x30\x64\xb2\xd0\x90\xc2\xd6\x6e\x60\x7f\xce\x63\x61\xb4\xbb\x5\x9b\x6b\xb2\xfd\x39\x8b\x85\x75\xf\xa3\xf1\x37\xd9\xec\xcf\x29\x2d\x8c\x76\x57\x60\xdc\x70\x80\x5a\x52\x2\xb\xfd\x28\xdc\xf0\x22\xb4\x32\x64\xb0\xd0\xaf\x21\xdd\xd2\x9\xac\xc\x9\x2c\xc\x14\x60\xc8\x84\x61\x9d\x85\x7e\xff\xdc\x77\xdc\x76\x86\x5a\x52\x68\xb\xeb\x5e\x8\xf6\x66\x18\x72\x59\x18\xdd\xe\xfe\xc6\x36\x60\x7f\xe\x6d\xa1\x5d\x43\xba\xb5\x18\x5b\x19\x22\x5b\x18\xdd\x4e\xfd\xde\xb7\x1f\xc\x71\x2d\xa0\x60\x65\x48\xd7\x92\xd6\x58\x58\xf6\x26\xb0\x2c\xc0\x90\xcc\xc2\x40\x41\x4b\x4a\xd7\x92\x96\x58\x58\xf5\xd1\xed\xcd\x30\x24\xb3\xd0\x8d\x42\x90\xa\xa0\x25\x5\xb4\xd0\xad\x21\x8d\x30\x67\x9\x43\x30\xb\xab\xc6\x82\x65\x1\x86\x6c\x16\x6\xa\x56\x86\x8c\x2b\xc3\x7c\xb\xdd\xfe\x1a\x4d\xa4\xf7\x1d\xc\xa1\x2c\x2c\xfa\xc4\x28\x68\x49\xe9\x2c\x68\x48\x30\x24\xc5\x30\xdb\xc2\xa2\xbb\x81\x82\x96\x94\xcd\x42\xb3\x86\x14\xf0\x70\x61\x88\x62\x61\xf4\x3a\xdf\x88\x43\x3f\x34\x86\xd1\xc7\xc2\x1a\xf7\x28\x58\x19\xf2\x59\x18\xad\xe\x37\xea\xc4\x87\x21\x80\x5\x14\xb4\xa4\xc4\x2b\xc3\x4c\xb\x1a\x12\xc\x99\x31\xcc\xb4\x30\x50\x80\x21\xf1\x83\x9b\x68\x61\xd\x78\xd\xc9\xca\x90\xce\x2\xa\x30\xe4\x7e\x76\xf3\x2c\xc\x14\xb4\xa4\xd4\x4f\x6f\x9a\x85\x25\x9f\xcf\xb2\x60\x65\x48\x68\x61\xa0\xa0\x25\xe5\x7e\x80\xb3\x2c\x68\x48\x30\x64\xc7\x30\xc9\xc2\x92\xdb\x81\x82\xfd\x39\xa1\x85\xd1\xe9\x28\xb3\xfc\xb2\x5c\xfb\xf3\x1d\x16\x56\x7c\x30\xcb\x82\xfd\x39\xa1\x85\x56\x14\x72\xfd\xa5\x19\x18\x36\x5b\xe8\xd4\x90\x72\xfd\x9d\x56\x2b\xc3\x66\xb\x2b\x3e\x14\xa\x56\x86\x8c\x16\x46\xa3\x33\xcc\xf5\x17\x8b\xad\xc\x9b\x2d\xa0\x0\x43\x89\xc7\x79\xdd\xc2\x82\x49\x67\x6f\xb6\x3f\xa7\xb4\x30\xfa\x1c\x5f\x46\xa\xf6\xe7\x7d\x16\x16\x7c\x1a\xdf\x64\xb3\x3f\x67\xb4\xd0\xa9\x21\xe5\xa4\x60\x65\xd8\x65\x61\xf4\x39\xb9\x9c\xd\x9\x86\x5d\x16\x1a\x35\xa4\xbc\x14\xac\xc\x5b\x2c\x8c\x3e\xc7\x36\x5e\x5e\x60\x28\x8d\xe1\x9a\x5\x14\xb4\xa4\x3a\x8f\xf6\x92\x85\xf9\xa2\xed\xcd\x30\xe4\xb4\x30\xda\x9c\x58\xe6\x65\x21\x7e\x4b\xa\xf3\x87\x50\xcf\x5b\x98\x7f\x41\xec\xcd\x56\x86\x94\x16\xfa\x50\x48\xdf\x90\x60\x58\x6c\xa1\x4f\x43\x2a\x41\xc1\xca\xb0\xce\xc2\x74\xca\x96\x5\x18\x92\x5a\x18\x28\x68\x49\xa5\x9e\xf2\x69\xb\xa3\xcd\x41\x8d\x97\x17\x18\x3a\x60\x38\x6b\x61\xfa\x57\x8e\x82\x96\x94\xd4\x42\x9b\x86\x54\x89\x2\xc\x2b\x2c\xcc\x1e\xb\x96\x5\x18\x6e\xc7\x70\xce\x2\xa\x56\x86\x7a\x4f\xfb\x9c\x85\xd1\xe5\x80\xc6\xcb\xb\xc\x5d\x30\x9c\xb2\x30\xfb\x4b\x46\x41\x4b\xa\xf0\xc0\x4f\x59\x18\x4d\x4e\xa7\x5e\x43\x82\x61\xb2\x5\x14\x60\xa8\xf8\xcc\x4f\x58\xd0\x90\xac\xc\x25\x31\x9c\xb0\x30\x50\x80\xa1\xe2\x63\x3f\x6e\x61\x32\x5c\x14\xb4\xa4\x20\xf\xfe\xb0\x85\xc9\x14\x2c\xb\x30\x44\xc1\x70\xd8\xc2\x40\x41\x4b\xaa\xf9\xec\x8f\x5a\xd0\x90\x60\xa8\x8a\xe1\xa8\x85\x81\x2\xc\x45\x1f\xff\x41\xb\x1a\x92\x95\xa1\x2c\x86\x63\x16\xe6\xde\x11\x14\x60\x88\x74\x2\xc7\x2c\x8c\x1e\x67\x31\x5e\x5a\xc4\xca\x70\xc1\xc2\xdc\x2f\xd0\xb2\x0\x43\xa8\x43\x38\x62\x1\x5\x18\x2a\x1f\xc3\x11\xb\x3d\x1a\x52\x8f\x65\xc1\xfe\x7c\xc9\xc2\xd4\x4b\x82\x2\xc\xd1\x4e\xe2\x80\x85\x31\xf7\xff\xd7\xdb\x48\x4b\x8a\x85\xe1\x79\xb\x28\xc0\x50\xfb\x30\x9e\xb6\x30\x15\x69\xd8\x3\xe8\xd5\x90\xac\xc\xe7\x2c\x8c\xe\xcf\xbf\x1f\x5\x2b\xc3\x71\xb\x33\xbf\x2a\xdf\x64\x83\x21\x22\x86\x27\x2d\xf4\x68\x48\x2d\x29\x58\x19\xe\x5a\x18\x1d\x1e\x7d\xc7\x86\x4\xc3\x51\xb\x33\x6f\x9\xa\x5a\x52\x4c\xc\xcf\x59\x18\xd\x9e\x7b\x5f\xa\x56\x86\x3\x16\x3a\x50\xe8\xba\x2c\xc4\x6f\x49\xdb\x30\x3c\x63\xa1\x45\x43\x6a\x4d\xc1\xca\xf0\xac\x85\xd1\xe0\x91\x77\x6e\x48\xd1\x31\x4\xb2\x30\xf1\x9a\x58\x16\xac\xc\x99\x3b\x52\x7\xa\xdd\x1b\x52\xe4\xc3\x89\xb4\x3b\xf\x14\xb4\xa4\x16\x67\xf3\xa5\x85\x89\x2c\x2d\xb\x30\x44\x7e\x4d\x7d\x69\x61\xa0\x0\x43\x8f\xb3\xf9\xca\x42\x83\x86\x84\x42\xdc\x23\x8a\xf4\xb3\x79\xf3\xbe\x16\xcb\x2\xc\xc1\x5f\x53\x5f\x58\x68\xd0\x90\x50\x88\x7b\x4a\x91\xfe\x2d\xcf\x3c\x97\x96\x5\x18\xa2\xbf\xa6\x3e\xb5\x80\x82\x96\xd4\xe8\x6c\x3e\xb5\x30\x2a\x3e\x61\xd\x29\xc9\x51\x85\xfa\x9d\x30\xd3\xbe\x18\x14\x60\x48\x70\x36\x9f\x59\x18\xf3\xfe\x4f\x34\x24\x2b\x43\xf8\xd7\xd4\x27\x16\x50\x80\xa1\xd5\xc4\xfe\xd8\xc2\xb4\x8b\x82\x82\x96\x94\xe2\x6c\x3e\xb6\x30\xa\x3d\x59\xcb\x42\xb2\x23\x8b\xf5\xb7\x48\x66\x7d\x35\x28\x68\x49\x49\xce\xe6\x23\xb\x1a\x12\xc\xdd\x5e\x53\x1f\x59\x18\x28\xc0\xd0\xec\x6c\x3e\xb0\xa0\x21\x59\x19\xda\xbd\xa6\x3e\xb0\x30\x50\x80\xa1\xdb\xc4\x7e\xdf\x42\x79\xa\x1a\x52\xdc\x96\x34\x5e\x22\x59\x98\x75\x53\x2c\xb\x30\x24\x9a\xd8\xef\x5a\x18\x28\xc8\x4d\xe7\x77\xe3\xd9\xbc\x67\x61\xd2\x97\x63\x59\xb0\x32\xa4\x7a\x4d\xbd\x63\x1\x5\xb9\xed\x8\xef\x3c\x9b\x77\x2c\x68\x48\x72\xd7\x19\x8e\x97\x50\x16\x26\x5d\x15\x14\x60\x48\x76\x36\x6f\x2d\x8c\xda\x14\x34\xa4\xb8\x2d\xe9\xe6\xd7\xd4\x1b\xb\x23\xe1\x33\x44\xa1\x4\x86\xbb\x27\xf6\xaf\x16\xe6\x7c\x3d\xbe\xc9\x6\x43\xbe\xd7\xd4\xaf\x16\x8a\x37\x24\x14\xe2\x9e\xe5\x78\x89\x65\x61\xce\x5d\xb1\x2c\xc0\x90\xf0\x35\xf5\xb3\x85\xea\xd\x9\x85\xb0\xc7\x19\x60\x62\xff\x6c\x61\xa0\x20\xf7\x1c\x68\x80\xb3\xf9\xc9\xc2\x14\x9b\xf6\x66\x2d\x29\xe7\x6b\xea\x27\xb\x23\xc9\x83\x43\xa1\x1a\x86\xf1\x12\xcc\x42\x6d\xa\x1a\x52\xdc\x53\x8d\xf1\x9a\x7a\x65\xa1\x78\x43\x42\x21\xec\xb1\x6\x99\xd8\xaf\x2c\x8c\xd2\x14\x34\xa4\xb8\x7\x1b\xe4\x35\xf5\xaf\x85\x19\x97\x5\x5\x2d\x29\xef\xc4\xfe\xd7\xc2\x88\xfd\xc0\x34\xa4\xaa\x18\xc2\xbc\xa6\xfe\xb1\x30\xe3\x2b\x42\x1\x86\xc4\x13\xfb\x1f\xb\x13\x6e\x8b\xbd\xd9\xca\x90\xb9\xbc\xfe\xb0\x30\xe1\x4b\xb2\x2c\xc0\x90\xfa\x35\xf5\xc3\xc2\x98\xf1\x3f\x85\x82\x96\x94\x78\x62\x7f\xb7\x30\xe1\xba\x58\x16\x60\xc8\xfd\x9a\xfa\x6e\x61\xa0\x20\xfb\x5b\x52\xac\x89\xfd\xb7\x85\xeb\x5f\x93\x65\x1\x86\xec\xaf\xa9\xbf\x2d\xc\x14\x64\xff\x41\x7\x9b\xd8\x93\x2c\x68\x48\x56\x86\xf4\x47\xf3\x97\x85\xcb\xef\x4e\x14\x60\xc8\x3f\xb1\xa7\x58\xf0\x4d\x36\x2d\xa9\x40\x79\xfd\xcb\xc2\xa8\x4a\xc1\xb2\x10\x17\x43\xbc\xd7\xd4\x4\xb\x28\x68\x49\x25\x26\xf6\x9f\x16\x2e\x5e\x19\xcb\x2\xc\x25\x5e\x53\xd7\x2d\xa0\x0\x43\x8d\x89\xfd\xa7\x85\x4b\x77\x46\x43\xb2\x32\x14\x39\x9a\xab\x16\x50\x80\xa1\xca\xc4\xbe\x6a\x41\x43\xd2\x92\xaa\x1c\xcd\x45\xb\x28\xc0\x50\x66\x62\xff\x61\xe1\x7f\xff\x45\x41\xf6\x9d\x7d\xd8\xf2\x7a\xc9\x82\x65\xc1\xca\x50\xe8\x35\x75\xc5\x2\xa\x30\x54\x9a\xd8\x57\x2c\x68\x48\x5a\x52\xa5\xa3\xb9\x60\x1\x5\x18\x4a\x4d\xec\x3f\x2c\xfc\xa7\x1a\x5\xd\x29\x6c\x4b\xa\x7d\x34\xa7\x2d\x58\x16\xe4\xf8\x25\x8\x3d\xb1\xcf\x5a\x88\x4b\x41\x43\x8a\x8b\x21\xf6\xd1\x9c\xb5\x60\x59\x90\xc3\xf7\x20\xf8\xc4\x3e\x69\x1\x5\x39\x7c\x13\xa2\x97\xd7\x73\x16\x2c\xb\x72\xfc\x2a\x8c\x97\x82\x16\x50\x90\xe3\x97\x21\xfc\xc4\x3e\x63\xc1\xde\x2c\xc7\x5b\xd2\x78\xa9\x68\xc1\xb2\x20\x87\xef\x43\x82\x89\x7d\xc2\x82\x6f\xb2\xc9\xe1\x1b\x91\xe1\x68\x8e\x5b\xb0\x2c\xc8\xf1\x2b\x31\x5e\xa\x5a\xb0\x2c\xc8\xf1\x4b\x91\xe2\x68\xe\x5b\xb0\x2c\xc8\xe1\x5b\x91\x63\x62\x1f\xb5\x60\x59\x90\xc3\xf7\x22\xc9\xd1\x1c\xb4\x80\x82\x1c\xbe\x19\x59\x8e\xe6\x98\x5\x7b\xb3\x1c\xbf\x1a\xe3\xa5\xa0\x5\x7b\xb3\x1c\xbf\x1c\x69\x8e\xe6\x90\x5\x7b\xb3\x1c\xbe\x1d\x79\x26\xf6\x11\xb\x96\x5\x39\x7c\x3f\x12\x1d\xcd\x1\xb\x96\x5\x39\x7e\x41\xc6\x4b\x41\xb\x96\x5\x39\x7e\x45\x32\x1d\xcd\xf3\x16\x2c\xb\x72\x18\x43\xaa\xa3\x29\x60\x41\x43\xa\xbb\x32\xe4\x3a\x9a\xfc\x16\x50\x8\x8b\x21\xd9\xd1\xe4\xb7\xa0\x21\x85\x6d\x49\xe3\x85\x5\x14\x60\x48\x78\x34\xd9\x2d\x68\x48\x61\x5b\x52\xba\xa3\xc9\x6e\xc1\x58\x88\x8a\x21\xdf\x5b\x2a\xb9\x5\x63\x21\x2a\x86\x84\x27\x93\xdc\x82\xb1\x10\x75\x65\x18\x2f\x2c\x18\xb\xf2\x7\x86\x8c\x2f\xa9\xdc\x16\x8c\x85\xa0\xb7\x2a\xe5\x4b\x2a\xb5\x5\x63\x41\x58\x60\x41\x58\x50\x91\x84\x5\x16\x84\x5\x15\x49\x58\x60\x41\x58\x50\x91\x84\x5\x16\x84\x5\x15\x49\x58\x60\x41\x58\x60\x41\x58\xb0\x2e\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x8\xb\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\x20\xc2\x82\x8\xb\x22\x2c\x88\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xb0\xc0\x82\xf4\xcb\x6f\xbf\xb3\x20\xc2\x82\x8\xb\x22\x2c\x88\x7c\x78\xc1\x59\x10\x61\x41\xe4\x55\x45\x62\x41\x84\x5\x91\x9f\xee\x37\xb\x22\x2c\x88\xb0\x20\xf2\x66\x5d\x60\x41\xe4\xfb\xf5\x66\x41\xe4\xaf\xb1\xc0\x82\x8\xb\x22\x3f\xdd\x6e\x16\xc4\x58\xf8\x9d\x5\x91\x57\x97\x9b\x5\x31\x16\x58\x10\x79\x7d\xb7\x59\x10\x63\x81\x5\x91\xd7\x57\x9b\x5\x31\x16\x58\x10\x79\x45\x81\x5\xd1\x90\x58\x10\xf9\xe9\x5e\xb3\x20\x28\xb0\x20\x96\x5\x16\x44\xde\xde\x6a\x16\x4\x5\x16\x44\x43\x62\x41\xe4\xed\x9d\x66\x41\x8c\x5\x16\xc4\x58\x60\x41\xe4\xed\x8d\x66\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x44\x3e\xa0\xc0\x82\x68\x48\x2c\x88\xb1\xc0\x82\x18\xb\x2c\x88\x7c\x78\x99\x59\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\xe1\x85\x5\x91\x4f\x6f\x32\xb\x62\x2c\xb0\x20\xc6\x2\xb\x62\x2c\xb0\x20\x28\xb0\x20\xf2\xf9\x35\x66\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\xe4\x89\xb1\xc0\x82\xa0\xc0\x82\x68\x48\x2c\x88\xb1\xc0\x82\x18\xb\x2c\x8\xa\x2c\x88\x3c\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x91\x3\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x39\x3a\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x39\x79\x61\x59\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x91\xb\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x99\x70\x47\x59\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x99\x34\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x16\x8c\x85\xdf\x59\x60\x41\x56\xdc\x49\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\xc1\x9d\x30\x16\x58\x60\x1\x5\x16\x58\x90\x55\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x41\x81\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\x89\x5\x31\x16\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x60\x41\x43\x62\x81\x5\x63\x81\x5\x16\x8c\x5\x16\x58\x40\xe1\x85\x5\x16\x64\xd3\xfd\x63\x41\x8c\x5\x16\xc4\x58\x38\x63\x41\xa4\x38\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\x44\xf6\x8f\x5\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\x4\x5\x16\x44\x43\x62\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\x34\x24\x16\xc4\x58\x60\x41\x8c\x5\x16\xc4\x58\x60\x41\x50\x60\x41\xe4\xd6\x86\xc4\x82\x18\xb\x2c\x88\xb1\xc0\x82\xa0\xf0\xee\x17\xf0\xbf\xff\x3a\x5\xd1\x90\x58\x10\x63\x81\x5\x31\x16\x58\x10\x14\x58\x10\xd\xe9\xb3\xaf\xe1\xdb\x70\x10\x62\x2c\xb0\x20\xc6\x2\xb\x82\xc2\x1b\xb\xdf\x2c\xc\xa2\x21\xb1\x20\xc6\x2\xb\x62\x2c\xbc\xb1\xf0\x62\x61\x10\x63\x81\x5\x41\xe1\xb5\x5\x25\x49\x34\x24\x16\xc4\x58\x78\x6d\x41\x49\x12\x63\xe1\xbb\x5\x83\x41\x50\xf8\xdb\x82\xc1\x20\x1a\x12\xb\x62\x2c\xfc\x64\x41\x49\x12\x63\xe1\x6f\xb\x6\x83\xa0\xf0\xdd\x82\xc1\x20\xdd\x1b\xd2\xf\xb\x6\x83\xb4\x1f\xb\x3f\x2c\x18\xc\xd2\x7d\x2c\xfc\xb0\x0\x83\x74\xa7\xf0\x8f\x5\x2d\x49\x7a\x37\xa4\x57\x16\xc\x6\xe9\x4d\xe1\x5f\xb\x30\x48\xeb\x86\xf4\xda\x2\xc\xd2\x9a\xc2\x6b\xb\x56\x6\xe9\x4c\xe1\x27\xb\x26\x83\x74\xdd\x15\xde\x58\x80\x41\xfa\x52\xf8\xc5\x82\x9e\x24\x5d\x25\xbc\xb5\x60\x36\x74\x6f\xcd\x7d\xf3\x7f\xa\x4a\xdc\x0\xab\x4b\xde\x55\x0\x0\x0\x0\x49\x45\x4e\x44\xae\x42\x60\x82"